@@ -0,0 +1,10 @@
+#!/bin/bash
+cd `dirname $0`
+
+#set variables
+DIR_TLECATALOGUE=../../../ExtLibraries/TLECatalogue/
+
+mkdir -p $DIR_TLECATALOGUE
+
+# download the TLE of the active objects from CelesTrak in the three-line format
+curl "https://celestrak.org/NORAD/elements/gp.php?GROUP=active&FORMAT=tle" > $DIR_TLECATALOGUE/catalogue.tle
@@ -5,7 +5,7 @@
 
 #include "GNSSReceiver.h"
 
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 #include <Environment/Global/PhysicalConstants.hpp>
 #include <string>
@@ -18,9 +18,9 @@ GNSSReceiver::GNSSReceiver(const int prescaler, ClockGenerator* clock_gen, const
       ch_max_(ch_max),
       antenna_position_b_(ant_pos_b),
       q_b2c_(q_b2c),
-      nrs_eci_x_(0.0, noise_std[0], g_rand.MakeSeed()),
-      nrs_eci_y_(0.0, noise_std[1], g_rand.MakeSeed()),
-      nrs_eci_z_(0.0, noise_std[2], g_rand.MakeSeed()),
+      nrs_eci_x_(0.0, noise_std[0], libra::RandomContext::GetCurrent().MakeSeed("GNSSReceiver" + std::to_string(id) + "/x")),
+      nrs_eci_y_(0.0, noise_std[1], libra::RandomContext::GetCurrent().MakeSeed("GNSSReceiver" + std::to_string(id) + "/y")),
+      nrs_eci_z_(0.0, noise_std[2], libra::RandomContext::GetCurrent().MakeSeed("GNSSReceiver" + std::to_string(id) + "/z")),
       half_width_(half_width),
       gnss_id_(gnss_id),
       antenna_model_(antenna_model),
@@ -36,9 +36,9 @@ GNSSReceiver::GNSSReceiver(const int prescaler, ClockGenerator* clock_gen, Power
       ch_max_(ch_max),
       antenna_position_b_(ant_pos_b),
       q_b2c_(q_b2c),
-      nrs_eci_x_(0.0, noise_std[0], g_rand.MakeSeed()),
-      nrs_eci_y_(0.0, noise_std[1], g_rand.MakeSeed()),
-      nrs_eci_z_(0.0, noise_std[2], g_rand.MakeSeed()),
+      nrs_eci_x_(0.0, noise_std[0], libra::RandomContext::GetCurrent().MakeSeed("GNSSReceiver" + std::to_string(id) + "/x")),
+      nrs_eci_y_(0.0, noise_std[1], libra::RandomContext::GetCurrent().MakeSeed("GNSSReceiver" + std::to_string(id) + "/y")),
+      nrs_eci_z_(0.0, noise_std[2], libra::RandomContext::GetCurrent().MakeSeed("GNSSReceiver" + std::to_string(id) + "/z")),
       half_width_(half_width),
       gnss_id_(gnss_id),
       antenna_model_(antenna_model),
@@ -70,6 +70,16 @@ void GNSSReceiver::MainRoutine(int count) {
   }
 }
 
+bool GNSSReceiver::DeclareTickDependencies(TickDependencies& dependencies) const {
+  dependencies.Read(power_port_);
+  dependencies.Read(dynamics_);
+  dependencies.Read(simtime_);
+  // The interpolation of the GNSS satellites in the getters is guarded by their mutex
+  dependencies.Read(gnss_satellites_);
+  dependencies.Write(this);
+  return true;
+}
+
 void GNSSReceiver::CheckAntenna(const Vector<3> pos_true_eci_, Quaternion q_i2b) {
   if (antenna_model_ == SIMPLE)
     CheckAntennaSimple(pos_true_eci_, q_i2b);
@@ -231,3 +241,57 @@ std::string GNSSReceiver::GetLogValue() const  // For logs
 
   return str_tmp;
 }
+
+void GNSSReceiver::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("GNSSReceiver");
+  writer.Write(nrs_eci_x_);
+  writer.Write(nrs_eci_y_);
+  writer.Write(nrs_eci_z_);
+  writer.Write(position_eci_);
+  writer.Write(velocity_eci_);
+  writer.Write(position_ecef_);
+  writer.Write(velocity_ecef_);
+  writer.Write(position_llh_);
+  writer.Write(utc_);
+  writer.Write(gpstime_week_);
+  writer.Write(gpstime_sec_);
+  writer.Write(is_gnss_sats_visible_);
+  writer.Write(gnss_sats_visible_num_);
+  writer.Write((uint64_t)vec_gnssinfo_.size());
+  for (const GnssInfo& gnss_info : vec_gnssinfo_) {
+    writer.Write(gnss_info.ID);
+    writer.Write(gnss_info.latitude);
+    writer.Write(gnss_info.longitude);
+    writer.Write(gnss_info.distance);
+  }
+}
+
+void GNSSReceiver::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("GNSSReceiver")) return;
+  reader.Read(nrs_eci_x_);
+  reader.Read(nrs_eci_y_);
+  reader.Read(nrs_eci_z_);
+  reader.Read(position_eci_);
+  reader.Read(velocity_eci_);
+  reader.Read(position_ecef_);
+  reader.Read(velocity_ecef_);
+  reader.Read(position_llh_);
+  reader.Read(utc_);
+  reader.Read(gpstime_week_);
+  reader.Read(gpstime_sec_);
+  reader.Read(is_gnss_sats_visible_);
+  reader.Read(gnss_sats_visible_num_);
+  uint64_t num_gnssinfo = 0;
+  reader.Read(num_gnssinfo);
+  vec_gnssinfo_.clear();
+  for (uint64_t i = 0; i < num_gnssinfo && reader.IsValid(); i++) {
+    GnssInfo gnss_info;
+    reader.Read(gnss_info.ID);
+    reader.Read(gnss_info.latitude);
+    reader.Read(gnss_info.longitude);
+    reader.Read(gnss_info.distance);
+    vec_gnssinfo_.push_back(gnss_info);
+  }
+}
@@ -89,6 +89,11 @@ class GNSSReceiver : public ComponentBase, public ILoggable {
    * @brief Main routine for sensor observation
    */
   void MainRoutine(int count);
+  /**
+   * @fn DeclareTickDependencies
+   * @brief Declare the power port, the dynamics, the time, and the GNSS satellites as read and the sensor itself as written
+   */
+  bool DeclareTickDependencies(TickDependencies& dependencies) const override;
 
   // Getter
   /**
@@ -135,6 +140,18 @@ class GNSSReceiver : public ComponentBase, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the noise states and the observed values
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
  protected:
   // Parameters for receiver
   const int id_;                  //!< Receiver ID (not used now)
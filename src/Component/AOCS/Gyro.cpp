@@ -24,6 +24,13 @@ void Gyro::MainRoutine(int count) {
   omega_c_ = Measure(omega_c_);                                         // Add noises
 }
 
+bool Gyro::DeclareTickDependencies(TickDependencies& dependencies) const {
+  dependencies.Read(power_port_);
+  dependencies.Read(dynamics_);
+  dependencies.Write(this);
+  return true;
+}
+
 std::string Gyro::GetLogHeader() const {
   std::string str_tmp = "";
   const std::string st_sensor_id = std::to_string(static_cast<long long>(sensor_id_));
@@ -41,3 +48,17 @@ std::string Gyro::GetLogValue() const {
 
   return str_tmp;
 }
+
+void Gyro::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("Gyro");
+  SaveSensorState(writer);
+  writer.Write(omega_c_);
+}
+
+void Gyro::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("Gyro")) return;
+  LoadSensorState(reader);
+  reader.Read(omega_c_);
+}
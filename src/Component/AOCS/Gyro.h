@@ -59,6 +59,11 @@ class Gyro : public ComponentBase, public SensorBase<kGyroDim>, public ILoggable
    * @brief Main routine for sensor observation
    */
   void MainRoutine(int count) override;
+  /**
+   * @fn DeclareTickDependencies
+   * @brief Declare the power port and the dynamics as read and the sensor itself as written
+   */
+  bool DeclareTickDependencies(TickDependencies& dependencies) const override;
 
   // Override ILoggable
   /**
@@ -72,6 +77,18 @@ class Gyro : public ComponentBase, public SensorBase<kGyroDim>, public ILoggable
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the noise states and the observed angular velocity
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   /**
    * @fn GetOmegaC
    * @brief Return observed angular velocity of the component frame with respect to the inertial frame
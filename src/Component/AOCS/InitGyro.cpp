@@ -41,7 +41,8 @@ Gyro InitGyro(ClockGenerator* clock_gen, int sensor_id, const std::string fname,
   Vector<kGyroDim> nr_stddev_c;
   gyro_conf.ReadVector(GSection, "nr_stddev_c", nr_stddev_c);
 
-  SensorBase<kGyroDim> gyro_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c);
+  SensorBase<kGyroDim> gyro_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c,
+                               "Gyro" + std::to_string(sensor_id));
 
   Gyro gyro(prescaler, clock_gen, gyro_sb, sensor_id, q_b2c, dynamics);
 
@@ -84,7 +85,8 @@ Gyro InitGyro(ClockGenerator* clock_gen, PowerPort* power_port, int sensor_id, c
   Vector<kGyroDim> nr_stddev_c;
   gyro_conf.ReadVector(GSection, "nr_stddev_c", nr_stddev_c);
 
-  SensorBase<kGyroDim> gyro_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c);
+  SensorBase<kGyroDim> gyro_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c,
+                               "Gyro" + std::to_string(sensor_id));
 
   // PowerPort
   double minimum_voltage = gyro_conf.ReadDouble(GSection, "minimum_voltage");
@@ -41,7 +41,8 @@ MagSensor InitMagSensor(ClockGenerator* clock_gen, int sensor_id, const std::str
   Vector<kMagDim> nr_stddev_c;
   magsensor_conf.ReadVector(MSSection, "nr_stddev_c", nr_stddev_c);
 
-  SensorBase<kMagDim> mag_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c);
+  SensorBase<kMagDim> mag_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c,
+                             "MagSensor" + std::to_string(sensor_id));
 
   MagSensor magsensor(prescaler, clock_gen, mag_sb, sensor_id, q_b2c, magnet);
   return magsensor;
@@ -83,7 +84,8 @@ MagSensor InitMagSensor(ClockGenerator* clock_gen, PowerPort* power_port, int se
   Vector<kMagDim> nr_stddev_c;
   magsensor_conf.ReadVector(MSSection, "nr_stddev_c", nr_stddev_c);
 
-  SensorBase<kMagDim> mag_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c);
+  SensorBase<kMagDim> mag_sb(scale_factor, range_to_const_c, range_to_zero_c, bias_c, nr_stddev_c, rw_stepwidth, rw_stddev_c, rw_limit_c,
+                             "MagSensor" + std::to_string(sensor_id));
 
   // PowerPort
   double minimum_voltage = magsensor_conf.ReadDouble(MSSection, "minimum_voltage");
@@ -21,6 +21,13 @@ void MagSensor::MainRoutine(int count) {
   mag_c_ = Measure(mag_c_);                         // Add noises
 }
 
+bool MagSensor::DeclareTickDependencies(TickDependencies& dependencies) const {
+  dependencies.Read(power_port_);
+  dependencies.Read(magnet_);
+  dependencies.Write(this);
+  return true;
+}
+
 std::string MagSensor::GetLogHeader() const {
   std::string str_tmp = "";
   const std::string st_sensor_id = std::to_string(static_cast<long long>(sensor_id_));
@@ -38,3 +45,17 @@ std::string MagSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+void MagSensor::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("MagSensor");
+  SaveSensorState(writer);
+  writer.Write(mag_c_);
+}
+
+void MagSensor::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("MagSensor")) return;
+  LoadSensorState(reader);
+  reader.Read(mag_c_);
+}
@@ -59,6 +59,11 @@ class MagSensor : public ComponentBase, public SensorBase<kMagDim>, public ILogg
    * @brief Main routine for sensor observation
    */
   void MainRoutine(int count) override;
+  /**
+   * @fn DeclareTickDependencies
+   * @brief Declare the power port and the environment as read and the sensor itself as written
+   */
+  bool DeclareTickDependencies(TickDependencies& dependencies) const override;
 
   // Override ILoggable
   /**
@@ -72,6 +77,18 @@ class MagSensor : public ComponentBase, public SensorBase<kMagDim>, public ILogg
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the noise states and the observed magnetic field
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   /**
    * @fn GetMagC
    * @brief Return observed magnetic field on the component frame
@@ -6,7 +6,7 @@
 #include "MagTorquer.h"
 
 #include <Interface/LogOutput/Logger.h>
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 #include <Library/math/MatVec.hpp>
 #include <Library/math/Quaternion.hpp>
@@ -23,10 +23,10 @@ MagTorquer::MagTorquer(const int prescaler, ClockGenerator* clock_gen, const int
       max_c_(max_c),
       min_c_(min_c),
       bias_c_(bias_c),
-      n_rw_c_(rw_stepwidth, rw_stddev_c, rw_limit_c),
+      n_rw_c_(rw_stepwidth, rw_stddev_c, rw_limit_c, "MagTorquer" + std::to_string(id) + "/rw"),
       mag_env_(mag_env) {
   for (size_t i = 0; i < kMtqDim; i++) {
-    nrs_c_[i].set_param(0.0, nr_stddev_c[i]);  // g_rand.MakeSeed()
+    nrs_c_[i].set_param(0.0, nr_stddev_c[i], libra::RandomContext::GetCurrent().MakeSeed("MagTorquer" + std::to_string(id) + "/nr"));
   }
 }
 
@@ -42,10 +42,10 @@ MagTorquer::MagTorquer(const int prescaler, ClockGenerator* clock_gen, PowerPort
       max_c_(max_c),
       min_c_(min_c),
       bias_c_(bias_c),
-      n_rw_c_(rw_stepwidth, rw_stddev_c, rw_limit_c),
+      n_rw_c_(rw_stepwidth, rw_stddev_c, rw_limit_c, "MagTorquer" + std::to_string(id) + "/rw"),
       mag_env_(mag_env) {
   for (size_t i = 0; i < kMtqDim; i++) {
-    nrs_c_[i].set_param(0.0, nr_stddev_c[i]);  // g_rand.MakeSeed()
+    nrs_c_[i].set_param(0.0, nr_stddev_c[i], libra::RandomContext::GetCurrent().MakeSeed("MagTorquer" + std::to_string(id) + "/nr"));
   }
 }
 
@@ -101,3 +101,23 @@ std::string MagTorquer::GetLogValue() const {
 
   return str_tmp;
 }
+
+void MagTorquer::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("MagTorquer");
+  writer.Write(torque_b_);
+  writer.Write(mag_moment_c_);
+  writer.Write(mag_moment_b_);
+  n_rw_c_.SaveState(writer);
+  writer.Write(nrs_c_);
+}
+
+void MagTorquer::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("MagTorquer")) return;
+  reader.Read(torque_b_);
+  reader.Read(mag_moment_c_);
+  reader.Read(mag_moment_b_);
+  n_rw_c_.LoadState(reader);
+  reader.Read(nrs_c_);
+}
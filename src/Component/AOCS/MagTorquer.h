@@ -93,6 +93,18 @@ class MagTorquer : public ComponentBase, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the noise states and the output magnetic moment and torque
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   /**
    * @fn GetMagMoment_b
    * @brief Return output magnetic moment in the body fixed frame [Am2]
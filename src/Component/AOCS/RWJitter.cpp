@@ -123,3 +123,43 @@ void RWJitter::CalcCoef() {
   coef_[5] = 4.0 - 4.0 * damping_factor_ * jitter_update_interval_ * structural_resonance_angular_freq_ +
              pow(jitter_update_interval_, 2.0) * pow(structural_resonance_angular_freq_, 2.0);
 }
+
+void RWJitter::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("RWJitter");
+  writer.Write(jitter_force_rot_phase_);
+  writer.Write(jitter_torque_rot_phase_);
+  writer.Write(unfiltered_jitter_force_n_c_);
+  writer.Write(unfiltered_jitter_force_n_1_c_);
+  writer.Write(unfiltered_jitter_force_n_2_c_);
+  writer.Write(unfiltered_jitter_torque_n_c_);
+  writer.Write(unfiltered_jitter_torque_n_1_c_);
+  writer.Write(unfiltered_jitter_torque_n_2_c_);
+  writer.Write(filtered_jitter_force_n_c_);
+  writer.Write(filtered_jitter_force_n_1_c_);
+  writer.Write(filtered_jitter_force_n_2_c_);
+  writer.Write(filtered_jitter_torque_n_c_);
+  writer.Write(filtered_jitter_torque_n_1_c_);
+  writer.Write(filtered_jitter_torque_n_2_c_);
+  writer.Write(jitter_force_b_);
+  writer.Write(jitter_torque_b_);
+}
+
+void RWJitter::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("RWJitter")) return;
+  reader.Read(jitter_force_rot_phase_);
+  reader.Read(jitter_torque_rot_phase_);
+  reader.Read(unfiltered_jitter_force_n_c_);
+  reader.Read(unfiltered_jitter_force_n_1_c_);
+  reader.Read(unfiltered_jitter_force_n_2_c_);
+  reader.Read(unfiltered_jitter_torque_n_c_);
+  reader.Read(unfiltered_jitter_torque_n_1_c_);
+  reader.Read(unfiltered_jitter_torque_n_2_c_);
+  reader.Read(filtered_jitter_force_n_c_);
+  reader.Read(filtered_jitter_force_n_1_c_);
+  reader.Read(filtered_jitter_force_n_2_c_);
+  reader.Read(filtered_jitter_torque_n_c_);
+  reader.Read(filtered_jitter_torque_n_1_c_);
+  reader.Read(filtered_jitter_torque_n_2_c_);
+  reader.Read(jitter_force_b_);
+  reader.Read(jitter_torque_b_);
+}
@@ -5,6 +5,7 @@
 
 #pragma once
 #include <Library/math/Quaternion.hpp>
+#include <Library/utils/Checkpoint.hpp>
 #include <Library/math/Vector.hpp>
 #include <vector>
 
@@ -12,7 +13,7 @@
  * @class RWJitter
  * @brief Class to calculate RW high-frequency jitter effect
  */
-class RWJitter {
+class RWJitter : public ICheckpointable {
  public:
   /**
    * @fn RWJitter
@@ -67,6 +68,18 @@ class RWJitter {
     return considers_structural_resonance_ ? filtered_jitter_torque_n_c_ : unfiltered_jitter_torque_n_c_;
   }
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the rotation phases and the states of the difference equations
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   std::vector<std::vector<double>> radial_force_harmonics_coef_;   //!< Coefficients for radial force harmonics
   std::vector<std::vector<double>> radial_torque_harmonics_coef_;  //!< Coefficients for radial torque harmonics
@@ -209,3 +209,35 @@ std::string RWModel::GetLogValue() const {
 
   return str_tmp;
 }
+
+void RWModel::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("RWModel");
+  writer.Write(drive_flag_);
+  writer.Write(velocity_limit_rpm_);
+  writer.Write(target_accl_);
+  writer.Write(delay_buffer_accl_);
+  writer.Write(angular_acceleration_);
+  writer.Write(angular_velocity_rpm_);
+  writer.Write(angular_velocity_rad_);
+  writer.Write(output_torque_b_);
+  writer.Write(angular_momentum_b_);
+  ode_angular_velocity_.SaveState(writer);
+  rw_jitter_.SaveState(writer);
+}
+
+void RWModel::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("RWModel")) return;
+  reader.Read(drive_flag_);
+  reader.Read(velocity_limit_rpm_);
+  reader.Read(target_accl_);
+  reader.Read(delay_buffer_accl_);
+  reader.Read(angular_acceleration_);
+  reader.Read(angular_velocity_rpm_);
+  reader.Read(angular_velocity_rad_);
+  reader.Read(output_torque_b_);
+  reader.Read(angular_momentum_b_);
+  ode_angular_velocity_.LoadState(reader);
+  rw_jitter_.LoadState(reader);
+}
@@ -125,6 +125,18 @@ class RWModel : public ComponentBase, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the control inputs, the delay buffer, the rotor dynamics, and the jitter states
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   // Getter
   /**
    * @fn GetOutputTorqueB
@@ -6,7 +6,7 @@
 #include "STT.h"
 
 #include <Interface/LogOutput/LogUtility.h>
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 #include <Environment/Global/PhysicalConstants.hpp>
 #include <Library/math/Constant.hpp>
@@ -23,9 +23,9 @@ STT::STT(const int prescaler, ClockGenerator* clock_gen, const int id, const lib
     : ComponentBase(prescaler, clock_gen),
       id_(id),
       q_b2c_(q_b2c),
-      rot_(g_rand.MakeSeed()),
-      n_ortho_(0.0, sigma_ortho, g_rand.MakeSeed()),
-      n_sight_(0.0, sigma_sight, g_rand.MakeSeed()),
+      rot_(libra::RandomContext::GetCurrent().MakeSeed("STT" + std::to_string(id) + "/rot")),
+      n_ortho_(0.0, sigma_ortho, libra::RandomContext::GetCurrent().MakeSeed("STT" + std::to_string(id) + "/ortho")),
+      n_sight_(0.0, sigma_sight, libra::RandomContext::GetCurrent().MakeSeed("STT" + std::to_string(id) + "/sight")),
       pos_(0),
       step_time_(step_time),
       output_delay_(output_delay),
@@ -46,9 +46,9 @@ STT::STT(const int prescaler, ClockGenerator* clock_gen, PowerPort* power_port,
     : ComponentBase(prescaler, clock_gen, power_port),
       id_(id),
       q_b2c_(q_b2c),
-      rot_(g_rand.MakeSeed()),
-      n_ortho_(0.0, sigma_ortho, g_rand.MakeSeed()),
-      n_sight_(0.0, sigma_sight, g_rand.MakeSeed()),
+      rot_(libra::RandomContext::GetCurrent().MakeSeed("STT" + std::to_string(id) + "/rot")),
+      n_ortho_(0.0, sigma_ortho, libra::RandomContext::GetCurrent().MakeSeed("STT" + std::to_string(id) + "/ortho")),
+      n_sight_(0.0, sigma_sight, libra::RandomContext::GetCurrent().MakeSeed("STT" + std::to_string(id) + "/sight")),
       pos_(0),
       step_time_(step_time),
       output_delay_(output_delay),
@@ -66,6 +66,11 @@ STT::STT(const int prescaler, ClockGenerator* clock_gen, PowerPort* power_port,
 void STT::Initialize() {
   q_stt_i2c_ = Quaternion(0.0, 0.0, 0.0, 1.0);
 
+  // Resolve the celestial bodies used in the judgements
+  sun_id_ = local_env_->GetCelesInfo().CalcBodyIdFromName("SUN");
+  earth_id_ = local_env_->GetCelesInfo().CalcBodyIdFromName("EARTH");
+  moon_id_ = local_env_->GetCelesInfo().CalcBodyIdFromName("MOON");
+
   // Decide delay buffer size
   MAX_DELAY = int(output_delay_ * 2 / step_time_);
   if (MAX_DELAY <= 0) MAX_DELAY = 1;
@@ -124,9 +129,9 @@ void STT::update(const LocalCelestialInformation* local_celes_info, const Attitu
 
 void STT::AllJudgement(const LocalCelestialInformation* local_celes_info, const Attitude* attinfo) {
   int judgement = 0;
-  judgement = SunJudgement(local_celes_info->GetPosFromSC_b("SUN"));
-  judgement += EarthJudgement(local_celes_info->GetPosFromSC_b("EARTH"));
-  judgement += MoonJudgement(local_celes_info->GetPosFromSC_b("MOON"));
+  judgement = SunJudgement(local_celes_info->GetPosFromSC_b(sun_id_));
+  judgement += EarthJudgement(local_celes_info->GetPosFromSC_b(earth_id_));
+  judgement += MoonJudgement(local_celes_info->GetPosFromSC_b(moon_id_));
   judgement += CaptureRateJudgement(attinfo->GetOmega_b());
   if (judgement > 0)
     error_flag_ = true;
@@ -209,3 +214,37 @@ void STT::MainRoutine(int count) {
 
   measure(&(local_env_->GetCelesInfo()), &(dynamics_->GetAttitude()));
 }
+
+bool STT::DeclareTickDependencies(TickDependencies& dependencies) const {
+  dependencies.Read(power_port_);
+  dependencies.Read(dynamics_);
+  dependencies.Read(local_env_);
+  dependencies.Write(this);
+  return true;
+}
+
+void STT::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("STT");
+  writer.Write(q_stt_i2c_);
+  writer.Write(rot_);
+  writer.Write(n_ortho_);
+  writer.Write(n_sight_);
+  writer.Write(q_buffer_);
+  writer.Write(pos_);
+  writer.Write(count_);
+  writer.Write(error_flag_);
+}
+
+void STT::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("STT")) return;
+  reader.Read(q_stt_i2c_);
+  reader.Read(rot_);
+  reader.Read(n_ortho_);
+  reader.Read(n_sight_);
+  reader.Read(q_buffer_);
+  reader.Read(pos_);
+  reader.Read(count_);
+  reader.Read(error_flag_);
+}
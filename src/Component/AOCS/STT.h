@@ -81,6 +81,11 @@ class STT : public ComponentBase, public ILoggable {
    * @brief Main routine for sensor observation
    */
   void MainRoutine(int count) override;
+  /**
+   * @fn DeclareTickDependencies
+   * @brief Declare the power port, the dynamics, and the local environment as read and the sensor itself as written
+   */
+  bool DeclareTickDependencies(TickDependencies& dependencies) const override;
 
   // Override ILoggable
   /**
@@ -94,6 +99,18 @@ class STT : public ComponentBase, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the noise states, the delay buffer, and the observed quaternion
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   /**
    * @fn GetObsQuaternion
    * @brief Return observed quaternion from the inertial frame to the component frame
@@ -134,6 +151,9 @@ class STT : public ComponentBase, public ILoggable {
   double earth_forbidden_angle_;  //!< Earth forbidden angle [rad]
   double moon_forbidden_angle_;   //!< Moon forbidden angle [rad]
   double capture_rate_;           //!< Angular rate limit to get correct attitude [rad/s]
+  int sun_id_;                    //!< ID of the sun in CelestialInformation list
+  int earth_id_;                  //!< ID of the earth in CelestialInformation list
+  int moon_id_;                   //!< ID of the moon in CelestialInformation list
 
   // Observed variables
   const Dynamics* dynamics_;           //!< Dynamics information
@@ -9,7 +9,7 @@
 #include <Library/math/NormalRand.hpp>
 using libra::NormalRand;
 #include <Interface/LogOutput/LogUtility.h>
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 using namespace std;
 
@@ -40,14 +40,17 @@ SunSensor::SunSensor(const int prescaler, ClockGenerator* clock_gen, PowerPort*
 }
 
 void SunSensor::Initialize(const double nr_stddev_c, const double nr_bias_stddev_c) {
+  sun_id_ = local_celes_info_->CalcBodyIdFromName("SUN");
+
   // Bias
-  NormalRand nr(0.0, nr_bias_stddev_c, g_rand.MakeSeed());
+  const std::string stream_name = "SunSensor" + std::to_string(id_);
+  NormalRand nr(0.0, nr_bias_stddev_c, libra::RandomContext::GetCurrent().MakeSeed(stream_name + "/bias"));
   bias_alpha_ += nr;
   bias_beta_ += nr;
 
   // Normal Random
-  nrs_alpha_.set_param(0.0, nr_stddev_c);  // g_rand.MakeSeed()
-  nrs_beta_.set_param(0.0, nr_stddev_c);   // g_rand.MakeSeed()
+  nrs_alpha_.set_param(0.0, nr_stddev_c, libra::RandomContext::GetCurrent().MakeSeed(stream_name + "/alpha"));
+  nrs_beta_.set_param(0.0, nr_stddev_c, libra::RandomContext::GetCurrent().MakeSeed(stream_name + "/beta"));
 }
 void SunSensor::MainRoutine(int count) {
   UNUSED(count);
@@ -55,8 +58,16 @@ void SunSensor::MainRoutine(int count) {
   measure();
 }
 
+bool SunSensor::DeclareTickDependencies(TickDependencies& dependencies) const {
+  dependencies.Read(power_port_);
+  dependencies.Read(srp_);
+  dependencies.Read(local_celes_info_);
+  dependencies.Write(this);
+  return true;
+}
+
 void SunSensor::measure() {
-  Vector<3> sun_pos_b = local_celes_info_->GetPosFromSC_b("SUN");
+  Vector<3> sun_pos_b = local_celes_info_->GetPosFromSC_b(sun_id_);
   Vector<3> sun_dir_b = normalize(sun_pos_b);
 
   sun_c_ = q_b2c_.frame_conv(sun_dir_b);  // Frame conversion from body to component
@@ -146,3 +157,33 @@ string SunSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+void SunSensor::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("SunSensor");
+  writer.Write(sun_c_);
+  writer.Write(measured_sun_c_);
+  writer.Write(alpha_);
+  writer.Write(beta_);
+  writer.Write(solar_illuminance_);
+  writer.Write(sun_detected_flag_);
+  writer.Write(nrs_alpha_);
+  writer.Write(nrs_beta_);
+  writer.Write(bias_alpha_);
+  writer.Write(bias_beta_);
+}
+
+void SunSensor::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("SunSensor")) return;
+  reader.Read(sun_c_);
+  reader.Read(measured_sun_c_);
+  reader.Read(alpha_);
+  reader.Read(beta_);
+  reader.Read(solar_illuminance_);
+  reader.Read(sun_detected_flag_);
+  reader.Read(nrs_alpha_);
+  reader.Read(nrs_beta_);
+  reader.Read(bias_alpha_);
+  reader.Read(bias_beta_);
+}
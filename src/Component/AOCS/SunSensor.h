@@ -64,6 +64,11 @@ class SunSensor : public ComponentBase, public ILoggable {
    * @brief Main routine for sensor observation
    */
   void MainRoutine(int count) override;
+  /**
+   * @fn DeclareTickDependencies
+   * @brief Declare the power port and the environment as read and the sensor itself as written
+   */
+  bool DeclareTickDependencies(TickDependencies& dependencies) const override;
 
   // Override ILoggable
   /**
@@ -77,6 +82,18 @@ class SunSensor : public ComponentBase, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the noise states and the observed values
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   // Getter
   inline bool GetSunDetectedFlag() const { return sun_detected_flag_; };
   inline const Vector<3> GetMeasuredSun_c() const { return measured_sun_c_; };
@@ -107,6 +124,7 @@ class SunSensor : public ComponentBase, public ILoggable {
   // Measured variables
   const SRPEnvironment* srp_;                          //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celes_info_;  //!< Local celestial information
+  int sun_id_;                                         //!< ID of the sun in CelestialInformation list
 
   // functions
   /**
@@ -44,3 +44,17 @@ void RwOde::RHS(double x, const Vector<1> &state, Vector<1> &rhs) {
 void RwOde::setTargetAngularVelocity(double angular_velocity) { target_angular_velocity_ = angular_velocity; }
 
 void RwOde::setLagCoef(const Vector<3> lag_coef) { lag_coef_ = lag_coef; }
+
+void RwOde::SaveState(CheckpointWriter& writer) const {
+  libra::ODE<1>::SaveState(writer);
+  writer.WriteSection("RwOde");
+  writer.Write(lag_coef_);
+  writer.Write(target_angular_velocity_);
+}
+
+void RwOde::LoadState(CheckpointReader& reader) {
+  libra::ODE<1>::LoadState(reader);
+  if (!reader.ReadSection("RwOde")) return;
+  reader.Read(lag_coef_);
+  reader.Read(target_angular_velocity_);
+}
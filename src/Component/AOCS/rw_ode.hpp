@@ -11,6 +11,8 @@
 /*
  * @file RwOde
  * @brief Ordinary differential equation of angular velocity of reaction wheel with first-order lag
+ * @note The equation is always integrated with the fixed step RK4 by RWModel. The target angular velocity changes at every component update,
+ * so each integration covers only one component period of the linear lag, where the adaptive step width would not enlarge the step.
  */
 class RwOde : public libra::ODE<1> {
  public:
@@ -61,6 +63,18 @@ class RwOde : public libra::ODE<1> {
    */
   void setLagCoef(libra::Vector<3> lag_coef);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the integration and the target angular velocity
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
  private:
   RwOde(double step_width);            //!< Prohibit calling constructor
   libra::Vector<3> lag_coef_;          //!< Coefficients for the first order lag
@@ -19,10 +19,9 @@ ComponentBase::ComponentBase(int prescaler, ClockGenerator* clock_gen, PowerPort
   fast_prescaler_ = (fast_prescaler > 0) ? fast_prescaler : 1;
 }
 
-ComponentBase::ComponentBase(const ComponentBase& obj) {
+ComponentBase::ComponentBase(const ComponentBase& obj) : ITickable(obj) {
   prescaler_ = obj.prescaler_;
   fast_prescaler_ = obj.fast_prescaler_;
-  needs_fast_update_ = obj.needs_fast_update_;
   clock_gen_ = obj.clock_gen_;
   clock_gen_->RegisterComponent(this);
   power_port_ = obj.power_port_;
@@ -47,3 +46,7 @@ void ComponentBase::FastTick(int count) {
     PowerOffRoutine();
   }
 }
+
+void ComponentBase::SaveState(CheckpointWriter& writer) const { power_port_->SaveState(writer); }
+
+void ComponentBase::LoadState(CheckpointReader& reader) { power_port_->LoadState(reader); }
@@ -58,6 +58,28 @@ class ComponentBase : public ITickable {
    * @brief The methods to input fast clock. This will be called periodically.
    */
   virtual void FastTick(int fast_count);
+  /**
+   * @fn GetPrescaler
+   * @brief Return the frequency scale factor for normal update
+   */
+  virtual int GetPrescaler() const { return prescaler_; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return the frequency scale factor for fast update
+   */
+  virtual int GetFastPrescaler() const { return fast_prescaler_; }
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the power port
+   * @note Components which have internal states (e.g. noise, delay buffer, and outputs held between the updates) override this and call it first.
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
  protected:
   int prescaler_;           //!< Frequency scale factor for normal update
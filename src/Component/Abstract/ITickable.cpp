@@ -0,0 +1,14 @@
+/**
+ * @file ITickable.cpp
+ * @brief Interface class for time update of components
+ */
+
+#include "ITickable.h"
+
+#include <Environment/Global/ClockGenerator.h>
+
+void ITickable::SetNeedsFastUpdate(bool need_fast_update) {
+  if (needs_fast_update_ == need_fast_update) return;
+  needs_fast_update_ = need_fast_update;
+  if (registered_clock_gen_ != nullptr) registered_clock_gen_->UpdateSchedule();
+}
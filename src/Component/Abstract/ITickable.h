@@ -4,12 +4,75 @@
  */
 
 #pragma once
+
+#include <Library/utils/Checkpoint.hpp>
+#include <Library/utils/Macros.hpp>
+#include <vector>
+
+class ClockGenerator;
+
+/**
+ * @class TickDependencies
+ * @brief Objects which a component reads and writes in its tick functions
+ * @details The objects are identified by their addresses (e.g. power port, dynamics, environment, or the component itself). The clock generator
+ * runs the components which do not conflict with each other concurrently and keeps the registration order of the conflicting components.
+ * @note Spacecraft also declare the dependencies of their updates with this class (Spacecraft::DeclareUpdateDependencies).
+ */
+class TickDependencies {
+ public:
+  /**
+   * @fn Read
+   * @brief Declare an object read in the tick functions
+   */
+  inline void Read(const void* object) { reads_.push_back(object); }
+  /**
+   * @fn Write
+   * @brief Declare an object written in the tick functions. The object is also regarded as read.
+   */
+  inline void Write(const void* object) { writes_.push_back(object); }
+
+  /**
+   * @fn GetReads
+   * @brief Return the declared objects to read
+   */
+  inline const std::vector<const void*>& GetReads() const { return reads_; }
+  /**
+   * @fn GetWrites
+   * @brief Return the declared objects to write
+   */
+  inline const std::vector<const void*>& GetWrites() const { return writes_; }
+
+ private:
+  std::vector<const void*> reads_;   //!< Objects to read
+  std::vector<const void*> writes_;  //!< Objects to write
+};
+
 /**
  * @class ITickable
  * @brief Interface class for time update of components
+ * @note The states of the components are saved in a checkpoint through the clock generator with ICheckpointable.
  */
-class ITickable {
+class ITickable : public ICheckpointable {
  public:
+  /**
+   * @fn ITickable
+   * @brief Constructor
+   */
+  ITickable() = default;
+  /**
+   * @fn ITickable
+   * @brief Copy constructor. The registration to the clock generator is not copied.
+   */
+  ITickable(const ITickable& obj) : needs_fast_update_(obj.needs_fast_update_) {}
+  /**
+   * @fn operator=
+   * @brief Copy assignment. The registration to the clock generator is not copied.
+   */
+  ITickable& operator=(const ITickable& obj) {
+    SetNeedsFastUpdate(obj.needs_fast_update_);
+    return *this;
+  }
+
   /**
    * @fn Tick
    * @brief Pure virtual function to update clock of components
@@ -22,6 +85,30 @@ class ITickable {
    */
   virtual void FastTick(int fast_count) = 0;
 
+  /**
+   * @fn GetPrescaler
+   * @brief Return the frequency scale factor of Tick. The clock generator calls Tick only when the count is a multiple of it.
+   * @note The value must not be changed after the registration to the clock generator.
+   */
+  virtual int GetPrescaler() const { return 1; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return the frequency scale factor of FastTick. The clock generator calls FastTick only when the count is a multiple of it.
+   * @note The value must not be changed after the registration to the clock generator.
+   */
+  virtual int GetFastPrescaler() const { return 1; }
+  /**
+   * @fn DeclareTickDependencies
+   * @brief Declare all objects read and written in Tick and FastTick
+   * @note Components which do not declare them are executed after all previous components and before all following components.
+   * @param [out] dependencies: Objects read and written in the tick functions
+   * @return True when the dependencies are declared
+   */
+  virtual bool DeclareTickDependencies(TickDependencies& dependencies) const {
+    UNUSED(dependencies);
+    return false;
+  }
+
   // Whether or not high-frequency disturbances need to be calculated
   /**
    * @fn GetNeedsFastUpdate
@@ -30,10 +117,14 @@ class ITickable {
   inline bool GetNeedsFastUpdate() { return needs_fast_update_; }
   /**
    * @fn SetNeedsFastUpdate
-   * @brief Set fast update flag
+   * @brief Set fast update flag and update the schedule of the clock generator where this is registered
    */
-  inline void SetNeedsFastUpdate(bool need_fast_update) { needs_fast_update_ = need_fast_update; }
+  void SetNeedsFastUpdate(bool need_fast_update);
 
  protected:
   bool needs_fast_update_ = false;  //!< Whether or not high-frequency disturbances need to be calculated
-};
\ No newline at end of file
+
+ private:
+  friend class ClockGenerator;
+  ClockGenerator* registered_clock_gen_ = nullptr;  //!< Clock generator where this is registered
+};
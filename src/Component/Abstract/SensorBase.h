@@ -8,6 +8,7 @@
 #include <Library/math/NormalRand.hpp>
 #include <Library/math/RandomWalk.hpp>
 #include <Library/math/Vector.hpp>
+#include <string>
 
 /**
  * @class SensorBase
@@ -28,10 +29,11 @@ class SensorBase {
    * @param [in] rw_stepwidth: Step width for random walk calculation [sec]
    * @param [in] rw_stddev_c: Standard deviation of random wark at the component frame
    * @param [in] rw_limit_c: Limit of random walk at the component frame
+   * @param [in] random_stream_name: Name of the random streams in the current RandomContext. Use a name unique in the spacecraft (e.g. Gyro0).
    */
   SensorBase(const libra::Matrix<N, N>& scale_factor, const libra::Vector<N>& range_to_const_c, const libra::Vector<N>& range_to_zero_c,
              const libra::Vector<N>& bias_c, const libra::Vector<N>& nr_stddev_c, double rw_stepwidth, const libra::Vector<N>& rw_stddev_c,
-             const libra::Vector<N>& rw_limit_c);
+             const libra::Vector<N>& rw_limit_c, const std::string& random_stream_name = "SensorBase");
   /**
    * @fn ~SensorBase
    * @brief Destructor
@@ -46,6 +48,18 @@ class SensorBase {
    * @return Observed value with noise at the component frame
    */
   libra::Vector<N> Measure(const libra::Vector<N> true_value_c);
+  /**
+   * @fn SaveSensorState
+   * @brief Write the states of the normal random and the random walk noises
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveSensorState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadSensorState
+   * @brief Read the states written by SaveSensorState
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadSensorState(CheckpointReader& reader);
 
  private:
   libra::Matrix<N, N> scale_factor_;   //!< Scale factor matrix
@@ -5,19 +5,19 @@
 
 #pragma once
 
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 template <size_t N>
 SensorBase<N>::SensorBase(const libra::Matrix<N, N>& scale_factor, const libra::Vector<N>& range_to_const_c, const libra::Vector<N>& range_to_zero_c,
                           const libra::Vector<N>& bias_c, const libra::Vector<N>& nr_stddev_c, double rw_stepwidth,
-                          const libra::Vector<N>& rw_stddev_c, const libra::Vector<N>& rw_limit_c)
+                          const libra::Vector<N>& rw_stddev_c, const libra::Vector<N>& rw_limit_c, const std::string& random_stream_name)
     : scale_factor_(scale_factor),
       range_to_const_c_(range_to_const_c),
       range_to_zero_c_(range_to_zero_c),
       bias_c_(bias_c),
-      n_rw_c_(rw_stepwidth, rw_stddev_c, rw_limit_c) {
+      n_rw_c_(rw_stepwidth, rw_stddev_c, rw_limit_c, random_stream_name + "/rw") {
   for (size_t i = 0; i < N; i++) {
-    nrs_c_[i].set_param(0.0, nr_stddev_c[i], g_rand.MakeSeed());
+    nrs_c_[i].set_param(0.0, nr_stddev_c[i], libra::RandomContext::GetCurrent().MakeSeed(random_stream_name + "/nr"));
   }
   RangeCheck();
 }
@@ -38,6 +38,20 @@ libra::Vector<N> SensorBase<N>::Measure(const libra::Vector<N> true_value_c) {
   return Clip(calc_value_c);
 }
 
+template <size_t N>
+void SensorBase<N>::SaveSensorState(CheckpointWriter& writer) const {
+  writer.WriteSection("SensorBase");
+  writer.Write(nrs_c_);
+  n_rw_c_.SaveState(writer);
+}
+
+template <size_t N>
+void SensorBase<N>::LoadSensorState(CheckpointReader& reader) {
+  if (!reader.ReadSection("SensorBase")) return;
+  reader.Read(nrs_c_);
+  n_rw_c_.LoadState(reader);
+}
+
 template <size_t N>
 libra::Vector<N> SensorBase<N>::Clip(const libra::Vector<N> input_c) {
   libra::Vector<N> output_c;
@@ -37,6 +37,20 @@ void GScalculator::Update(const Spacecraft& spacecraft, const Antenna& sc_tx_ant
   }
 }
 
+void GScalculator::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("GScalculator");
+  writer.Write(downlink_bitrate_bps_);
+  writer.Write(receive_margin_dB_);
+  writer.Write(max_bitrate_Mbps_);
+}
+
+void GScalculator::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("GScalculator")) return;
+  reader.Read(downlink_bitrate_bps_);
+  reader.Read(receive_margin_dB_);
+  reader.Read(max_bitrate_Mbps_);
+}
+
 // Private functions
 double GScalculator::CalcMaxBitrate(const Dynamics& dynamics, const Antenna& sc_tx_ant, const GroundStation& ground_station,
                                     const Antenna& gs_rx_ant) {
@@ -22,7 +22,7 @@ using libra::Vector;
  * @class GScalculator
  * @brief Emulation of analysis and calculation for Ground Stations
  */
-class GScalculator : public ILoggable {
+class GScalculator : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn GScalculator
@@ -68,6 +68,18 @@ class GScalculator : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the downlink bitrate and the calculated values
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   // Getter
   /**
    * @fn GetMaxBitrate
@@ -103,3 +103,25 @@ libra::Quaternion ForceGenerator::GenerateDirectionNoiseQuaternion(libra::Vector
   libra::Quaternion error_quaternion(rotation_axis, error_angle_rad);
   return error_quaternion;
 }
+
+void ForceGenerator::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("ForceGenerator");
+  writer.Write(ordered_force_b_N_);
+  writer.Write(generated_force_b_N_);
+  writer.Write(generated_force_i_N_);
+  writer.Write(generated_force_rtn_N_);
+  writer.Write(magnitude_noise_);
+  writer.Write(direction_noise_);
+}
+
+void ForceGenerator::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("ForceGenerator")) return;
+  reader.Read(ordered_force_b_N_);
+  reader.Read(generated_force_b_N_);
+  reader.Read(generated_force_i_N_);
+  reader.Read(generated_force_rtn_N_);
+  reader.Read(magnitude_noise_);
+  reader.Read(direction_noise_);
+}
@@ -76,3 +76,21 @@ libra::Quaternion TorqueGenerator::GenerateDirectionNoiseQuaternion(libra::Vecto
   libra::Quaternion error_quaternion(rotation_axis, error_angle_rad);
   return error_quaternion;
 }
+
+void TorqueGenerator::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("TorqueGenerator");
+  writer.Write(ordered_torque_b_Nm_);
+  writer.Write(generated_torque_b_Nm_);
+  writer.Write(magnitude_noise_);
+  writer.Write(direction_noise_);
+}
+
+void TorqueGenerator::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("TorqueGenerator")) return;
+  reader.Read(ordered_torque_b_Nm_);
+  reader.Read(generated_torque_b_Nm_);
+  reader.Read(magnitude_noise_);
+  reader.Read(direction_noise_);
+}
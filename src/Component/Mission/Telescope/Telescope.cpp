@@ -28,6 +28,10 @@ Telescope::Telescope(ClockGenerator* clock_gen, libra::Quaternion& q_b2c, double
       attitude_(attitude),
       hipp_(hipp),
       local_celes_info_(local_celes_info) {
+  sun_id_ = local_celes_info_->CalcBodyIdFromName("SUN");
+  earth_id_ = local_celes_info_->CalcBodyIdFromName("EARTH");
+  moon_id_ = local_celes_info_->CalcBodyIdFromName("MOON");
+
   is_sun_in_forbidden_angle = true;
   is_earth_in_forbidden_angle = true;
   is_moon_in_forbidden_angle = true;
@@ -59,13 +63,13 @@ Telescope::~Telescope() {}
 void Telescope::MainRoutine(int count) {
   UNUSED(count);
   // Check forbidden angle
-  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b("SUN"), sun_forbidden_angle_);
-  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b("EARTH"), earth_forbidden_angle_);
-  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b("MOON"), moon_forbidden_angle_);
+  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b(sun_id_), sun_forbidden_angle_);
+  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b(earth_id_), earth_forbidden_angle_);
+  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celes_info_->GetPosFromSC_b(moon_id_), moon_forbidden_angle_);
   // Position calculation of celestial bodies from CelesInfo
-  Observe(sun_pos_imgsensor, local_celes_info_->GetPosFromSC_b("SUN"));
-  Observe(earth_pos_imgsensor, local_celes_info_->GetPosFromSC_b("EARTH"));
-  Observe(moon_pos_imgsensor, local_celes_info_->GetPosFromSC_b("MOON"));
+  Observe(sun_pos_imgsensor, local_celes_info_->GetPosFromSC_b(sun_id_));
+  Observe(earth_pos_imgsensor, local_celes_info_->GetPosFromSC_b(earth_id_));
+  Observe(moon_pos_imgsensor, local_celes_info_->GetPosFromSC_b(moon_id_));
   // Position calculation of stars from Hipparcos Catalogue
   // No update when Hipparocos Catalogue was not readed
   if (hipp_->IsCalcEnabled) ObserveStars();
@@ -106,45 +110,38 @@ void Telescope::ObserveStars() {
   Quaternion q_i2b = attitude_->GetQuaternion_i2b();
 
   star_in_sight.clear();  // Clear first
-  int count = 0;          // Counter for while loop
+  vector<int> ranks;      // Ranks of the stars in the field of view
+  hipp_->FindStarsInRectangle(q_i2b * q_b2c_, x_field_of_view_rad, y_field_of_view_rad, num_of_logged_stars_, ranks);
 
-  while (star_in_sight.size() < num_of_logged_stars_) {
-    Vector<3> target_b = hipp_->GetStarDir_b(count, q_i2b);
+  for (int rank : ranks) {
+    Vector<3> target_b = hipp_->GetStarDir_b(rank, q_i2b);
     Vector<3> target_c = q_b2c_.frame_conv(target_b);
 
     double arg_x = atan2(target_c[2], target_c[0]);  // Angle from X-axis on XZ plane in the component frame
     double arg_y = atan2(target_c[1], target_c[0]);  // Angle from X-axis on XY plane in the component frame
 
-    if (abs(arg_x) <= x_field_of_view_rad && abs(arg_y) <= y_field_of_view_rad) {
-      Star star;
-      star.hipdata.hip_num = hipp_->GetHipID(count);
-      star.hipdata.vmag = hipp_->GetVmag(count);
-      star.hipdata.ra = hipp_->GetRA(count);
-      star.hipdata.de = hipp_->GetDE(count);
-      star.pos_imgsensor[0] = x_num_of_pix_ / 2.0 * tan(arg_x) / tan(x_field_of_view_rad) + x_num_of_pix_ / 2.0;
-      star.pos_imgsensor[1] = y_num_of_pix_ / 2.0 * tan(arg_y) / tan(y_field_of_view_rad) + y_num_of_pix_ / 2.0;
-
-      star_in_sight.push_back(star);
-    }
-
-    count++;
+    Star star;
+    star.hipdata.hip_num = hipp_->GetHipID(rank);
+    star.hipdata.vmag = hipp_->GetVmag(rank);
+    star.hipdata.ra = hipp_->GetRA(rank);
+    star.hipdata.de = hipp_->GetDE(rank);
+    star.pos_imgsensor[0] = x_num_of_pix_ / 2.0 * tan(arg_x) / tan(x_field_of_view_rad) + x_num_of_pix_ / 2.0;
+    star.pos_imgsensor[1] = y_num_of_pix_ / 2.0 * tan(arg_y) / tan(y_field_of_view_rad) + y_num_of_pix_ / 2.0;
 
-    // If read all catalogue, fill -1 and break the loop
-    if (count >= hipp_->GetCatalogueSize()) {
-      while (star_in_sight.size() < num_of_logged_stars_) {
-        Star star;
-        star.hipdata.hip_num = -1;
-        star.hipdata.vmag = -1;
-        star.hipdata.ra = -1;
-        star.hipdata.de = -1;
-        star.pos_imgsensor[0] = -1;
-        star.pos_imgsensor[1] = -1;
+    star_in_sight.push_back(star);
+  }
 
-        star_in_sight.push_back(star);
-      }
+  // If there are not enough stars in the field of view, fill -1
+  while (star_in_sight.size() < num_of_logged_stars_) {
+    Star star;
+    star.hipdata.hip_num = -1;
+    star.hipdata.vmag = -1;
+    star.hipdata.ra = -1;
+    star.hipdata.de = -1;
+    star.pos_imgsensor[0] = -1;
+    star.pos_imgsensor[1] = -1;
 
-      break;
-    }
+    star_in_sight.push_back(star);
   }
 }
 
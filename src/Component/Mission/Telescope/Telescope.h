@@ -99,6 +99,9 @@ class Telescope : public ComponentBase, public ILoggable {
   const Attitude* attitude_;                           //!< Attitude information
   const HipparcosCatalogue* hipp_;                     //!< Star information
   const LocalCelestialInformation* local_celes_info_;  //!< Local celestial information
+  int sun_id_;                                         //!< ID of the sun in CelestialInformation list
+  int earth_id_;                                       //!< ID of the earth in CelestialInformation list
+  int moon_id_;                                        //!< ID of the moon in CelestialInformation list
 
   // Override ILoggable
   /**
@@ -51,3 +51,25 @@ std::string PCU::GetLogValue() const {
   std::string str_tmp = "";
   return str_tmp;
 }
+
+void PCU::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("PCU");
+  writer.Write((uint64_t)ports_.size());
+  for (auto port : ports_) {
+    writer.Write(port.first);
+    port.second->SaveState(writer);
+  }
+}
+
+void PCU::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("PCU")) return;
+  if (!reader.ReadSize(ports_.size(), "PCU ports")) return;
+  for (auto port : ports_) {
+    int port_id = 0;
+    reader.Read(port_id);
+    if (reader.IsValid() && port_id != port.first) reader.SetError("PCU port " + std::to_string(port.first) + " is not found");
+    port.second->LoadState(reader);
+  }
+}
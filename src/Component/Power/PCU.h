@@ -55,6 +55,18 @@ class PCU : public ComponentBase, public ILoggable {
    */
   std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the connected power ports
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   /**
    * @fn GetPowerPort
    * @brief Return power port information
@@ -17,6 +17,7 @@ SAP::SAP(const int prescaler, ClockGenerator* clock_gen, int id, int number_of_s
       srp_(srp),
       local_celes_info_(local_celes_info),
       compo_step_time_(compo_step_time) {
+  sun_id_ = local_celes_info_->CalcBodyIdFromName("SUN");
   voltage_ = 0.0;
   power_generation_ = 0.0;
 }
@@ -50,6 +51,7 @@ SAP::SAP(ClockGenerator* clock_gen, int id, int number_of_series, int number_of_
       srp_(srp),
       local_celes_info_(local_celes_info),
       compo_step_time_(0.1) {
+  sun_id_ = local_celes_info_->CalcBodyIdFromName("SUN");
   voltage_ = 0.0;
   power_generation_ = 0.0;
 }
@@ -65,6 +67,7 @@ SAP::SAP(const SAP& obj)
       transmission_efficiency_(obj.transmission_efficiency_),
       srp_(obj.srp_),
       local_celes_info_(obj.local_celes_info_),
+      sun_id_(obj.sun_id_),
       compo_step_time_(obj.compo_step_time_) {
   voltage_ = 0.0;
   power_generation_ = 0.0;
@@ -98,7 +101,7 @@ void SAP::MainRoutine(int time_count) {
                         cell_area_ * number_of_parallel_ * number_of_series_ * inner_product(normal_vector_, normalized_sun_direction_body);
   } else {
     const auto power_density = srp_->CalcPowerDensity();
-    libra::Vector<3> sun_pos_b = local_celes_info_->GetPosFromSC_b("SUN");
+    libra::Vector<3> sun_pos_b = local_celes_info_->GetPosFromSC_b(sun_id_);
     libra::Vector<3> sun_dir_b = libra::normalize(sun_pos_b);
     power_generation_ = cell_efficiency_ * transmission_efficiency_ * power_density * cell_area_ * number_of_parallel_ * number_of_series_ *
                         inner_product(normal_vector_, sun_dir_b);
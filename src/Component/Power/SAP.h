@@ -112,6 +112,7 @@ class SAP : public ComponentBase, public ILoggable {
 
   const SRPEnvironment* const srp_;                    //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celes_info_;  //!< Local celestial information
+  int sun_id_ = 0;                                     //!< ID of the sun in CelestialInformation list
 
   double voltage_;           //!< Voltage [V]
   double power_generation_;  //!< Generated power [W]
@@ -4,7 +4,7 @@
  */
 #include "SimpleThruster.h"
 
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 #include <Library/math/Constant.hpp>
 #include <cfloat>
@@ -41,8 +41,10 @@ SimpleThruster::SimpleThruster(const int prescaler, ClockGenerator* clock_gen, P
 SimpleThruster::~SimpleThruster() {}
 
 void SimpleThruster::Initialize(const double mag_err, const double dir_err) {
-  mag_nr_.set_param(0.0, mag_err);
-  dir_nr_.set_param(0.0, dir_err);
+  const std::string stream_name = "SimpleThruster" + std::to_string(id_);
+  mag_nr_.set_param(0.0, mag_err, libra::RandomContext::GetCurrent().MakeSeed(stream_name + "/magnitude"));
+  dir_nr_.set_param(0.0, dir_err, libra::RandomContext::GetCurrent().MakeSeed(stream_name + "/direction"));
+  dir_axis_rand_.init_seed(libra::RandomContext::GetCurrent().MakeSeed(stream_name + "/axis"));
   thrust_dir_b_ = normalize(thrust_dir_b_);
 }
 
@@ -100,13 +102,7 @@ Vector<3> SimpleThruster::CalcThrustDir() {
     ex[0] = 1.0;
     ex[1] = 0.0;
     ex[2] = 0.0;
-    int flag = rand() % 2;
-    double make_axis_rot_rad;
-    if (flag == 0) {
-      make_axis_rot_rad = libra::pi * (double)rand() / RAND_MAX;
-    } else {
-      make_axis_rot_rad = -libra::pi * (double)rand() / RAND_MAX;
-    }
+    double make_axis_rot_rad = libra::pi * (2.0 * dir_axis_rand_ - 1.0);  // Uniform in [-pi, pi)
 
     Quaternion make_axis_rot(thrust_dir_b_true, make_axis_rot_rad);
     Vector<3> axis_rot = make_axis_rot.frame_conv(ex);
@@ -117,3 +113,25 @@ Vector<3> SimpleThruster::CalcThrustDir() {
 
   return thrust_dir_b_true;
 }
+
+void SimpleThruster::SaveState(CheckpointWriter& writer) const {
+  ComponentBase::SaveState(writer);
+  writer.WriteSection("SimpleThruster");
+  writer.Write(duty_);
+  writer.Write(mag_nr_);
+  writer.Write(dir_nr_);
+  writer.Write(dir_axis_rand_);
+  writer.Write(thrust_b_);
+  writer.Write(torque_b_);
+}
+
+void SimpleThruster::LoadState(CheckpointReader& reader) {
+  ComponentBase::LoadState(reader);
+  if (!reader.ReadSection("SimpleThruster")) return;
+  reader.Read(duty_);
+  reader.Read(mag_nr_);
+  reader.Read(dir_nr_);
+  reader.Read(dir_axis_rand_);
+  reader.Read(thrust_b_);
+  reader.Read(torque_b_);
+}
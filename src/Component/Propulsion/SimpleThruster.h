@@ -10,6 +10,7 @@
 
 #include <Library/math/NormalRand.hpp>
 #include <Library/math/Quaternion.hpp>
+#include <Library/math/Ran1.hpp>
 #include <Library/math/Vector.hpp>
 
 #include "../Abstract/ComponentBase.h"
@@ -84,6 +85,18 @@ class SimpleThruster : public ComponentBase, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the duty, the noise states, and the generated thrust and torque
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   // Getter
   /**
    * @fn GetThrustB
@@ -113,6 +126,7 @@ class SimpleThruster : public ComponentBase, public ILoggable {
   double thrust_dir_err_ = 0.0;        //!< Standard deviation of thrust direction error [rad]
   libra::NormalRand mag_nr_;           //!< Normal random for thrust magnitude error
   libra::NormalRand dir_nr_;           //!< Normal random for thrust direction error
+  libra::Ran1 dir_axis_rand_;          //!< Uniform random for the rotation axis of thrust direction error
   // outputs
   Vector<3> thrust_b_{0.0};  //!< Generated thrust on the body fixed frame [N]
   Vector<3> torque_b_{0.0};  //!< Generated torque on the body fixed frame [N]
@@ -38,4 +38,20 @@ class AccelerationDisturbance : public Disturbance, public ILoggable {
    * @brief Pure virtual function to define the disturbance calculation
    */
   virtual void Update(const LocalEnvironment& local_env, const Dynamics& dynamics) = 0;
+
+  /**
+   * @fn CalcAccelerationI
+   * @brief Calculate the acceleration at a state near the last Update for the evaluation in the orbit integration stages
+   * @note The default implementation returns the acceleration of the last Update. The position dependent disturbances override it.
+   * @param [in] position_i: Spacecraft position in the inertial frame [m]
+   * @param [in] velocity_i: Spacecraft velocity in the inertial frame [m/s]
+   * @param [in] time_from_update_s: Time from the last Update [sec]
+   * @return Acceleration in the inertial frame [m/s2]
+   */
+  virtual Vector<3> CalcAccelerationI(const Vector<3>& position_i, const Vector<3>& velocity_i, const double time_from_update_s) {
+    (void)position_i;
+    (void)velocity_i;
+    (void)time_from_update_s;
+    return acceleration_i_;
+  }
 };
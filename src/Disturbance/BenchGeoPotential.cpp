@@ -0,0 +1,187 @@
+/**
+ * @file BenchGeoPotential.cpp
+ * @brief Micro-benchmark of the GeoPotential acceleration calculation (single position and batched)
+ * @note The legacy implementation (nested vectors allocated in each call) is kept here as a reference for the latency and the accuracy comparison.
+ */
+
+#include <Environment/Global/PhysicalConstants.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "GeoPotential.h"
+
+namespace {
+
+using std::vector;
+
+/**
+ * @fn LegacyCalcAccelerationECEF
+ * @brief Geo-potential calculation with the algorithm used before the table based implementation
+ */
+Vector<3> LegacyCalcAccelerationECEF(const Vector<3>& position_ecef, const int degree, const vector<vector<double>>& c_,
+                                     const vector<vector<double>>& s_) {
+  const double re = environment::earth_equatorial_radius_m;
+  double x = position_ecef[0], y = position_ecef[1], z = position_ecef[2];
+  double r = sqrt(x * x + y * y + z * z);
+
+  int degree_vw = degree + 1;
+  vector<vector<double>> v(degree_vw + 1, vector<double>(degree_vw + 1, 0.0));
+  vector<vector<double>> w(degree_vw + 1, vector<double>(degree_vw + 1, 0.0));
+  v[0][0] = re / r;
+  w[0][0] = 0.0;
+
+  double tmp = re / (r * r);
+  for (int m = 0; m < degree_vw; m++) {
+    for (int n = m + 1; n <= degree_vw; n++) {
+      double m_d = (double)m, n_d = (double)n;
+      double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize = 1.0;
+      if (n > 1) c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+      double v_prev2 = (n <= m + 1) ? 0.0 : v[n - 2][m];
+      double w_prev2 = (n <= m + 1) ? 0.0 : w[n - 2][m];
+      v[n][m] = c_normalize * (c1 * z * tmp * v[n - 1][m] - c2 * c2_normalize * re * tmp * v_prev2);
+      w[n][m] = c_normalize * (c1 * z * tmp * w[n - 1][m] - c2 * c2_normalize * re * tmp * w_prev2);
+    }
+    int n = m + 1;
+    double n_d = (double)n;
+    double c_normalize = (n == 1) ? (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0) : sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+    v[n][n] = c_normalize * (x * tmp * v[n - 1][n - 1] - y * tmp * w[n - 1][n - 1]);
+    w[n][n] = c_normalize * (x * tmp * w[n - 1][n - 1] + y * tmp * v[n - 1][n - 1]);
+  }
+
+  Vector<3> acc(0.0);
+  for (int n = 0; n <= degree; n++) {
+    double n_d = (double)n;
+    double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+    double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    acc[0] += -c_[n][0] * v[n + 1][1] * normalize_xy;
+    acc[1] += -c_[n][0] * w[n + 1][1] * normalize_xy;
+    acc[2] += (n + 1.0) * (-c_[n][0] * v[n + 1][0] - s_[n][0] * w[n + 1][0]) * normalize;
+    for (int m = 1; m <= n; m++) {
+      double m_d = (double)m;
+      double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+      double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+      double normalize_xy2 = normalize * sqrt(factorial) * ((m == 1) ? sqrt(2.0) : 1.0);
+      double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+      acc[0] += 0.5 * (normalize_xy1 * (-c_[n][m] * v[n + 1][m + 1] - s_[n][m] * w[n + 1][m + 1]) +
+                       normalize_xy2 * (c_[n][m] * v[n + 1][m - 1] + s_[n][m] * w[n + 1][m - 1]));
+      acc[1] += 0.5 * (normalize_xy1 * (-c_[n][m] * w[n + 1][m + 1] + s_[n][m] * v[n + 1][m + 1]) +
+                       normalize_xy2 * (-c_[n][m] * w[n + 1][m - 1] + s_[n][m] * v[n + 1][m - 1]));
+      acc[2] += (n_d - m_d + 1.0) * (-c_[n][m] * v[n + 1][m] - s_[n][m] * w[n + 1][m]) * normalize_z;
+    }
+  }
+  acc *= environment::earth_gravitational_constant_m3_s2 / (re * re);
+  return acc;
+}
+
+/**
+ * @fn WriteSyntheticCoefficients
+ * @brief Write EGM96 format coefficients with realistic magnitude so that the benchmark does not depend on the external table
+ */
+void WriteSyntheticCoefficients(const std::string& file_name, const int degree, vector<vector<double>>& c, vector<vector<double>>& s) {
+  std::mt19937 mt(12345);
+  std::normal_distribution<double> dist(0.0, 1.0);
+  c.assign(degree + 1, vector<double>(degree + 1, 0.0));
+  s.assign(degree + 1, vector<double>(degree + 1, 0.0));
+  std::ofstream ofs(file_name);
+  ofs.precision(15);
+  for (int n = 2; n <= degree; n++) {
+    for (int m = 0; m <= n; m++) {
+      c[n][m] = 1.0e-5 / (n * n) * dist(mt);
+      s[n][m] = (m == 0) ? 0.0 : 1.0e-5 / (n * n) * dist(mt);
+      ofs << n << " " << m << " " << c[n][m] << " " << s[n][m] << " 0.0 0.0\n";
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  const std::string file_name = "bench_geopotential_coeff.txt";
+  const int degrees[] = {10, 70, 180, 360};
+  const int num_positions = 64;
+
+  // Positions distributed over LEO altitudes
+  std::mt19937 mt(1);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  vector<Vector<3>> positions(num_positions);
+  for (auto& pos : positions) {
+    for (int i = 0; i < 3; i++) pos[i] = dist(mt);
+    pos *= (environment::earth_equatorial_radius_m + 500.0e3) / norm(pos);
+  }
+
+  vector<double> pos_x(num_positions), pos_y(num_positions), pos_z(num_positions);
+  for (int i = 0; i < num_positions; i++) {
+    pos_x[i] = positions[i][0];
+    pos_y[i] = positions[i][1];
+    pos_z[i] = positions[i][2];
+  }
+  vector<double> acc_x(num_positions), acc_y(num_positions), acc_z(num_positions);
+
+  printf("degree, legacy [us/call], table [us/call], batch [us/position], speedup (table), speedup (batch), max relative difference (table), ");
+  printf("max relative difference (batch vs table)\n");
+  for (const int degree : degrees) {
+    vector<vector<double>> c, s;
+    WriteSyntheticCoefficients(file_name, degree, c, s);
+    GeoPotential geop(degree, file_name);
+
+    // Repeat so that every degree runs for a comparable time
+    const int num_repeat = std::max(1, 200000 / (degree * degree));
+
+    double max_relative_diff = 0.0;
+    for (const auto& pos : positions) {
+      Vector<3> acc_legacy = LegacyCalcAccelerationECEF(pos, degree, c, s);
+      geop.CalcAccelerationECEF(pos);
+      Vector<3> acc_table = geop.GetAccelerationECEF();
+      max_relative_diff = std::max(max_relative_diff, norm(acc_table - acc_legacy) / norm(acc_legacy));
+    }
+    double max_batch_diff = 0.0;
+    geop.CalcAccelerationECEFBatch(num_positions, pos_x.data(), pos_y.data(), pos_z.data(), acc_x.data(), acc_y.data(), acc_z.data());
+    for (int i = 0; i < num_positions; i++) {
+      geop.CalcAccelerationECEF(positions[i]);
+      Vector<3> acc_table = geop.GetAccelerationECEF();
+      Vector<3> acc_batch;
+      acc_batch[0] = acc_x[i];
+      acc_batch[1] = acc_y[i];
+      acc_batch[2] = acc_z[i];
+      max_batch_diff = std::max(max_batch_diff, norm(acc_batch - acc_table) / norm(acc_table));
+    }
+
+    double sink = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_repeat; i++) {
+      for (const auto& pos : positions) sink += LegacyCalcAccelerationECEF(pos, degree, c, s)[0];
+    }
+    auto end = std::chrono::steady_clock::now();
+    double legacy_us = std::chrono::duration<double, std::micro>(end - start).count() / (num_repeat * num_positions);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_repeat; i++) {
+      for (const auto& pos : positions) geop.CalcAccelerationECEF(pos);
+    }
+    end = std::chrono::steady_clock::now();
+    double table_us = std::chrono::duration<double, std::micro>(end - start).count() / (num_repeat * num_positions);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_repeat; i++) {
+      geop.CalcAccelerationECEFBatch(num_positions, pos_x.data(), pos_y.data(), pos_z.data(), acc_x.data(), acc_y.data(), acc_z.data());
+    }
+    end = std::chrono::steady_clock::now();
+    double batch_us = std::chrono::duration<double, std::micro>(end - start).count() / (num_repeat * num_positions);
+
+    printf("%d, %.3f, %.3f, %.3f, %.2f, %.2f, %.3e, %.3e\n", degree, legacy_us, table_us, batch_us, legacy_us / table_us, legacy_us / batch_us,
+           max_relative_diff, max_batch_diff);
+    if (sink == 0.123) printf("\n");  // prevent the legacy loop from being optimized out
+  }
+  std::remove(file_name.c_str());
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file BenchOrbitStageAcceleration.cpp
+ * @brief Comparison of the position error and the wall time of the RK4 orbit propagation with the geo-potential acceleration held constant in
+ * each update interval and evaluated in each RK stage
+ * @note The reference orbit is propagated with the evaluation in each stage and a small step width.
+ */
+
+#include <Dynamics/Orbit/Rk4OrbitPropagation.h>
+
+#include <Environment/Global/PhysicalConstants.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "GeoPotential.h"
+
+namespace {
+
+using std::vector;
+
+/**
+ * @class RotatingGeoPotential
+ * @brief Geo-potential acceleration with the Earth rotating around the Z axis of the inertial frame
+ */
+class RotatingGeoPotential : public OrbitAccelerationModel {
+ public:
+  explicit RotatingGeoPotential(GeoPotential& geopotential) : geopotential_(geopotential) {}
+
+  virtual Vector<3> CalcAcceleration_i(const double time_s, const Vector<3>& position_i, const Vector<3>& velocity_i) {
+    (void)velocity_i;
+    const double theta_rad = environment::earth_mean_angular_velocity_rad_s * time_s;
+    Matrix<3, 3> dcm_i2ecef;
+    unitalize(dcm_i2ecef);
+    dcm_i2ecef[0][0] = cos(theta_rad);
+    dcm_i2ecef[0][1] = sin(theta_rad);
+    dcm_i2ecef[1][0] = -sin(theta_rad);
+    dcm_i2ecef[1][1] = cos(theta_rad);
+    geopotential_.CalcAccelerationECEF(dcm_i2ecef * position_i);
+    num_evaluations_++;
+    return transpose(dcm_i2ecef) * geopotential_.GetAccelerationECEF();
+  }
+
+  size_t num_evaluations_ = 0;  //!< Number of the evaluations
+
+ private:
+  GeoPotential& geopotential_;  //!< Geo-potential model
+};
+
+/**
+ * @fn WriteSyntheticCoefficients
+ * @brief Write EGM96 format coefficients with the actual J2 and realistic magnitude of the other terms
+ */
+void WriteSyntheticCoefficients(const std::string& file_name, const int degree) {
+  std::mt19937 mt(12345);
+  std::normal_distribution<double> dist(0.0, 1.0);
+  std::ofstream ofs(file_name);
+  ofs.precision(15);
+  for (int n = 2; n <= degree; n++) {
+    for (int m = 0; m <= n; m++) {
+      const double c = (n == 2 && m == 0) ? -4.84165371736e-4 : 1.0e-5 / (n * n) * dist(mt);
+      const double s = (m == 0) ? 0.0 : 1.0e-5 / (n * n) * dist(mt);
+      ofs << n << " " << m << " " << c << " " << s << " 0.0 0.0\n";
+    }
+  }
+}
+
+/**
+ * @fn Propagate
+ * @brief Propagate the orbit and return the positions at every sampling time
+ * @param [in] is_stage: Evaluate the acceleration in each RK stage. Otherwise, the acceleration is evaluated at the beginning of each update
+ * interval as the Spacecraft class does.
+ * @param [out] wall_time_ms: Wall time of the propagation [ms]
+ */
+vector<Vector<3>> Propagate(const CelestialInformation* celes_info, RotatingGeoPotential& model, const double step_s, const double duration_s,
+                            const double sampling_s, const bool is_stage, double& wall_time_ms) {
+  Vector<3> position_i, velocity_i;
+  position_i[0] = -2111769.7723711144;
+  position_i[1] = -5360353.2254375768;
+  position_i[2] = 3596181.6497774957;
+  velocity_i[0] = 4200.4344740455268;
+  velocity_i[1] = -4637.540129059361;
+  velocity_i[2] = -4429.2361258448807;
+  Rk4OrbitPropagation orbit(celes_info, environment::earth_gravitational_constant_m3_s2, step_s, position_i, velocity_i);
+  orbit.SetIsCalcEnabled(true);
+  orbit.SetIsStageAccelerationEnabled(is_stage);
+  orbit.SetAccelerationModel(&model);
+
+  vector<Vector<3>> positions;
+  const int num_steps = (int)std::round(duration_s / step_s);
+  const int sampling_steps = (int)std::round(sampling_s / step_s);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_steps; i++) {
+    const double time_s = i * step_s;
+    if (is_stage) {
+      orbit.SetAcceleration_i(Vector<3>(0.0));
+    } else {
+      orbit.SetAcceleration_i(model.CalcAcceleration_i(time_s, orbit.GetSatPosition_i(), orbit.GetSatVelocity_i()));
+    }
+    orbit.Propagate(time_s + step_s, 0.0);
+    if ((i + 1) % sampling_steps == 0) positions.push_back(orbit.GetSatPosition_i());
+  }
+  auto end = std::chrono::steady_clock::now();
+  wall_time_ms = std::chrono::duration<double, std::milli>(end - start).count();
+  return positions;
+}
+
+}  // namespace
+
+int main() {
+  const std::string file_name = "bench_orbit_stage_coeff.txt";
+  const int degree = 20;
+  WriteSyntheticCoefficients(file_name, degree);
+  GeoPotential geopotential(degree, file_name);
+  std::remove(file_name.c_str());
+  RotatingGeoPotential model(geopotential);
+
+  // Celestial information without SPICE bodies. The Earth rotation is handled in RotatingGeoPotential.
+  CelestialInformation celes_info("J2000", "NONE", "EARTH", Idle, 0, new int[0]);
+
+  const double duration_s = 3.0 * 5580.0;  // about three orbits (multiple of all step widths)
+  const double sampling_s = 60.0;
+  double wall_time_ms;
+  vector<Vector<3>> reference = Propagate(&celes_info, model, 0.5, duration_s, sampling_s, true, wall_time_ms);
+
+  const double steps_s[] = {1.0, 5.0, 10.0, 20.0, 30.0, 60.0};
+  printf("degree %d, duration %.0f sec, reference: stage evaluation with 0.5 sec step\n", degree, duration_s);
+  printf("step [sec], mode, max position error [m], wall time [ms], acceleration evaluations\n");
+  for (const double step_s : steps_s) {
+    for (int is_stage = 0; is_stage <= 1; is_stage++) {
+      model.num_evaluations_ = 0;
+      vector<Vector<3>> positions = Propagate(&celes_info, model, step_s, duration_s, sampling_s, is_stage, wall_time_ms);
+      double max_error_m = 0.0;
+      for (size_t i = 0; i < positions.size(); i++) max_error_m = std::max(max_error_m, norm(positions[i] - reference[i]));
+      printf("%.0f, %s, %.3e, %.2f, %zu\n", step_s, is_stage ? "stage" : "update", max_error_m, wall_time_ms, model.num_evaluations_);
+    }
+  }
+
+  return 0;
+}
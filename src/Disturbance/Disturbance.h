@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <Library/utils/Checkpoint.hpp>
+
 #include "../Library/math/Vector.hpp"
 using libra::Vector;
 
@@ -12,7 +14,7 @@ using libra::Vector;
  * @class Disturbance
  * @brief Base class for a disturbance
  */
-class Disturbance {
+class Disturbance : public ICheckpointable {
  public:
   /**
    * @fn Disturbance
@@ -46,6 +48,30 @@ class Disturbance {
    */
   virtual inline Vector<3> GetAccelerationI() { return acceleration_i_; }
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the disturbance force, torque, and acceleration held until the next update
+   */
+  virtual void SaveState(CheckpointWriter& writer) const {
+    writer.WriteSection("Disturbance");
+    writer.Write(force_b_);
+    writer.Write(torque_b_);
+    writer.Write(acceleration_b_);
+    writer.Write(acceleration_i_);
+  }
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader) {
+    if (!reader.ReadSection("Disturbance")) return;
+    reader.Read(force_b_);
+    reader.Read(torque_b_);
+    reader.Read(acceleration_b_);
+    reader.Read(acceleration_i_);
+  }
+
   bool IsCalcEnabled = true;  //!< Flag to calculate the disturbance
 
  protected:
@@ -44,6 +44,7 @@ void Disturbances::Update(const LocalEnvironment& local_env, const Dynamics& dyn
   // Update disturbances that depend only on the position
   if (sim_time->GetOrbitPropagateFlag()) {
     InitializeAcceleration();
+    acceleration_update_time_s_ = sim_time->GetElapsedSec();
     for (auto acc_dist : acc_disturbances_) {
       acc_dist->UpdateIfEnabled(local_env, dynamics);
       sum_acceleration_i_ += acc_dist->GetAccelerationI();
@@ -62,12 +63,53 @@ void Disturbances::LogSetup(Logger& logger) {
   logger.CopyFileToLogDir(ini_fname_);
 }
 
+void Disturbances::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("Disturbances");
+  writer.Write(sum_torque_);
+  writer.Write(sum_force_);
+  writer.Write(sum_acceleration_i_);
+  writer.Write(acceleration_update_time_s_);
+  writer.Write((uint64_t)disturbances_.size());
+  for (auto dist : disturbances_) {
+    dist->SaveState(writer);
+  }
+  writer.Write((uint64_t)acc_disturbances_.size());
+  for (auto acc_dist : acc_disturbances_) {
+    acc_dist->SaveState(writer);
+  }
+}
+
+void Disturbances::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("Disturbances")) return;
+  reader.Read(sum_torque_);
+  reader.Read(sum_force_);
+  reader.Read(sum_acceleration_i_);
+  reader.Read(acceleration_update_time_s_);
+  if (!reader.ReadSize(disturbances_.size(), "disturbances")) return;
+  for (auto dist : disturbances_) {
+    dist->LoadState(reader);
+  }
+  if (!reader.ReadSize(acc_disturbances_.size(), "acceleration disturbances")) return;
+  for (auto acc_dist : acc_disturbances_) {
+    acc_dist->LoadState(reader);
+  }
+}
+
 Vector<3> Disturbances::GetTorque() { return sum_torque_; }
 
 Vector<3> Disturbances::GetForce() { return sum_force_; }
 
 Vector<3> Disturbances::GetAccelerationI() { return sum_acceleration_i_; }
 
+Vector<3> Disturbances::CalcAcceleration_i(const double time_s, const Vector<3>& position_i, const Vector<3>& velocity_i) {
+  Vector<3> acc_i(0.0);
+  for (auto acc_dist : acc_disturbances_) {
+    if (!acc_dist->IsCalcEnabled) continue;
+    acc_i += acc_dist->CalcAccelerationI(position_i, velocity_i, time_s - acceleration_update_time_s_);
+  }
+  return acc_i;
+}
+
 void Disturbances::InitializeInstances(const SimulationConfig* sim_config, const int sat_id, const Structure* structure,
                                        const GlobalEnvironment* glo_env) {
   IniAccess iniAccess = IniAccess(sim_config->sat_file_[sat_id]);
@@ -18,7 +18,7 @@ class Logger;
  * @class Disturbances
  * @brief Class to manage all disturbances
  */
-class Disturbances {
+class Disturbances : public OrbitAccelerationModel {
  public:
   /**
    * @fn Disturbances
@@ -41,6 +41,18 @@ class Disturbances {
    * @brief log setup for all disturbances
    */
   void LogSetup(Logger& logger);
+  /**
+   * @fn SaveState
+   * @brief Write the total disturbances and the states of all disturbances
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetTorque
@@ -58,6 +70,13 @@ class Disturbances {
    */
   Vector<3> GetAccelerationI();
 
+  // Override OrbitAccelerationModel
+  /**
+   * @fn CalcAcceleration_i
+   * @brief Calculate total acceleration of the enabled acceleration disturbances at the state of an orbit integration stage
+   */
+  virtual Vector<3> CalcAcceleration_i(const double time_s, const Vector<3>& position_i, const Vector<3>& velocity_i);
+
  private:
   std::string ini_fname_;  //!< Initialization file name
 
@@ -66,6 +85,7 @@ class Disturbances {
   Vector<3> sum_force_;                                //!< Total disturbance force in the body frame [N]
   vector<AccelerationDisturbance*> acc_disturbances_;  //!< List of acceleration disturbances
   Vector<3> sum_acceleration_i_;                       //!< Total disturbance acceleration in the inertial frame [m/s2]
+  double acceleration_update_time_s_ = 0.0;            //!< Elapsed time of the last update of the acceleration disturbances [sec]
 
   /**
    * @fn InitializeInstances
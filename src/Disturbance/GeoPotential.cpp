@@ -6,6 +6,7 @@
 #include "GeoPotential.h"
 
 #include <Environment/Global/PhysicalConstants.hpp>
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <fstream>
@@ -20,6 +21,7 @@ using namespace std;
 GeoPotential::GeoPotential(const int degree, const string file_path) : degree_(degree) {
   // Initialize
   acc_ecef_ = Vector<3>(0);
+  unitalize(dcm_eci2ecef_);
   debug_pos_ecef_ = Vector<3>(0);
   // degree
   if (degree_ > 360) {
@@ -30,12 +32,11 @@ GeoPotential::GeoPotential(const int degree, const string file_path) : degree_(d
   } else if (degree_ <= 1) {
     degree_ = 0;
   }
-  // coefficients
-  c_.assign(degree_ + 1, vector<double>(degree_ + 1, 0.0));
-  s_.assign(degree_ + 1, vector<double>(degree_ + 1, 0.0));
+  // coefficients and calculation buffers
+  InitializeTables();
   // For actual EGM model, c_[0][0] should be 1.0
   // In S2E, 0 degree term is inside the SimpleCircularOrbit calculation
-  c_[0][0] = 0.0;
+  c_[0] = 0.0;
   if (degree_ >= 2) {
     if (!ReadCoefficientsEGM96(file_path)) {
       degree_ = 0;
@@ -60,8 +61,8 @@ bool GeoPotential::ReadCoefficientsEGM96(string file_name) {
     istringstream streamline(line);
     streamline >> n_ >> m_ >> c_nm_norm >> s_nm_norm;
 
-    c_[n_][m_] = c_nm_norm;
-    s_[n_][m_] = s_nm_norm;
+    c_[TriangularIndex(n_, m_)] = c_nm_norm;
+    s_[TriangularIndex(n_, m_)] = s_nm_norm;
   }
   return true;
 }
@@ -79,113 +80,282 @@ void GeoPotential::Update(const LocalEnvironment &local_env, const Dynamics &dyn
   time_ = static_cast<double>(chrono::duration_cast<chrono::microseconds>(end - start).count() / 1000.0);
 #endif
 
-  Matrix<3, 3> trans_eci2ecef_ = local_env.GetCelesInfo().GetGlobalInfo().GetEarthRotation().GetDCMJ2000toXCXF();
-  Matrix<3, 3> trans_ecef2eci = transpose(trans_eci2ecef_);
+  dcm_eci2ecef_ = local_env.GetCelesInfo().GetGlobalInfo().GetEarthRotation().GetDCMJ2000toXCXF();
+  Matrix<3, 3> trans_ecef2eci = transpose(dcm_eci2ecef_);
   acceleration_i_ = trans_ecef2eci * acc_ecef_;
 }
 
-void GeoPotential::CalcAccelerationECEF(const Vector<3> &position_ecef) {
-  x = position_ecef[0], y = position_ecef[1], z = position_ecef[2];
-  r = sqrt(x * x + y * y + z * z);
+Vector<3> GeoPotential::CalcAccelerationI(const Vector<3> &position_i, const Vector<3> &velocity_i, const double time_from_update_s) {
+  (void)velocity_i;
+
+  // Rotation of the Earth from the last Update
+  const double theta_rad = environment::earth_mean_angular_velocity_rad_s * time_from_update_s;
+  Matrix<3, 3> dcm_rotation;
+  unitalize(dcm_rotation);
+  dcm_rotation[0][0] = cos(theta_rad);
+  dcm_rotation[0][1] = sin(theta_rad);
+  dcm_rotation[1][0] = -sin(theta_rad);
+  dcm_rotation[1][1] = cos(theta_rad);
+  Matrix<3, 3> dcm_eci2ecef = dcm_rotation * dcm_eci2ecef_;
+
+  // Keep the acceleration of the last Update for the log output
+  Vector<3> acc_ecef_update = acc_ecef_;
+  CalcAccelerationECEF(dcm_eci2ecef * position_i);
+  Vector<3> acc_i = transpose(dcm_eci2ecef) * acc_ecef_;
+  acc_ecef_ = acc_ecef_update;
+  return acc_i;
+}
 
-  // Calc V and W
-  int degree_vw = degree_ + 1;
-  vector<vector<double>> v(degree_vw + 1, vector<double>(degree_vw + 1, 0.0));
-  vector<vector<double>> w(degree_vw + 1, vector<double>(degree_vw + 1, 0.0));
-  // n=m=0
-  v[0][0] = environment::earth_equatorial_radius_m / r;
-  w[0][0] = 0.0;
-  m = 0;
-
-  while (m < degree_vw) {
-    for (n = m + 1; n <= degree_vw; n++) {
-      if (n <= m + 1)
-        v_w_nm_update(&v[n][m], &w[n][m], v[n - 1][m], w[n - 1][m], 0.0, 0.0);
+void GeoPotential::InitializeTables() {
+  const size_t num_coeff = TriangularIndex(degree_ + 1, 0);
+  c_.assign(num_coeff, 0.0);
+  s_.assign(num_coeff, 0.0);
+
+  // V and W are required up to degree_ + 1
+  const int degree_vw = degree_ + 1;
+  const size_t num_vw = TriangularIndex(degree_vw + 1, 0);
+  v_.assign(num_vw, 0.0);
+  w_.assign(num_vw, 0.0);
+  v_batch_.assign(num_vw * kBatchLanes, 0.0);
+  w_batch_.assign(num_vw * kBatchLanes, 0.0);
+
+  // Normalization factors of the V and W recursion
+  vw_nn_coeff_.assign(degree_vw + 1, 0.0);
+  vw_nm_coeff1_.assign(num_vw, 0.0);
+  vw_nm_coeff2_.assign(num_vw, 0.0);
+  for (int n = 1; n <= degree_vw; n++) {
+    double n_d = (double)n;
+    if (n == 1)
+      vw_nn_coeff_[n] = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+    else
+      vw_nn_coeff_[n] = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+
+    for (int m = 0; m < n; m++) {
+      double m_d = (double)m;
+      double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize;
+      if (n <= 1)
+        c2_normalize = 1.0;
       else
-        v_w_nm_update(&v[n][m], &w[n][m], v[n - 1][m], w[n - 1][m], v[n - 2][m], w[n - 2][m]);
+        c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+
+      vw_nm_coeff1_[TriangularIndex(n, m)] = c_normalize * c1;
+      vw_nm_coeff2_[TriangularIndex(n, m)] = c_normalize * c2 * c2_normalize;
     }
-    // next step
-    m++;
-    n = m;
-    v_w_nn_update(&v[n][m], &w[n][m], v[n - 1][m - 1], w[n - 1][m - 1]);
   }
 
-  // Calc Acceleration
-  acc_ecef_ *= 0.0;
-  for (n = 0; n <= degree_; n++)  // this loop can integrate with previous loop
-  {
-    m = 0;
+  // Normalization factors of the acceleration
+  // m = 0 terms are stored at the (n, 0) element of acc_norm_xy1_ and acc_norm_z_
+  acc_norm_xy1_.assign(num_coeff, 0.0);
+  acc_norm_xy2_.assign(num_coeff, 0.0);
+  acc_norm_z_.assign(num_coeff, 0.0);
+  for (int n = 0; n <= degree_; n++) {
     double n_d = (double)n;
     double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
-    double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
-    // m==0
-    acc_ecef_[0] += -c_[n][0] * v[n + 1][1] * normalize_xy;
-    acc_ecef_[1] += -c_[n][0] * w[n + 1][1] * normalize_xy;
-    acc_ecef_[2] += (n + 1.0) * (-c_[n][0] * v[n + 1][0] - s_[n][0] * w[n + 1][0]) * normalize;
-    for (m = 1; m <= n; m++) {
+    acc_norm_xy1_[TriangularIndex(n, 0)] = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    acc_norm_z_[TriangularIndex(n, 0)] = (n_d + 1.0) * normalize;
+    for (int m = 1; m <= n; m++) {
       double m_d = (double)m;
       double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
-      double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
-      double normalize_xy2;
+      acc_norm_xy1_[TriangularIndex(n, m)] = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
       if (m == 1)
-        normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
+        acc_norm_xy2_[TriangularIndex(n, m)] = normalize * sqrt(factorial) * sqrt(2.0);
       else
-        normalize_xy2 = normalize * sqrt(factorial);
-      double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
-
-      acc_ecef_[0] += 0.5 * (normalize_xy1 * (-c_[n][m] * v[n + 1][m + 1] - s_[n][m] * w[n + 1][m + 1]) +
-                             normalize_xy2 * (c_[n][m] * v[n + 1][m - 1] + s_[n][m] * w[n + 1][m - 1]));
-      acc_ecef_[1] += 0.5 * (normalize_xy1 * (-c_[n][m] * w[n + 1][m + 1] + s_[n][m] * v[n + 1][m + 1]) +
-                             normalize_xy2 * (-c_[n][m] * w[n + 1][m - 1] + s_[n][m] * v[n + 1][m - 1]));
-      acc_ecef_[2] += (n_d - m_d + 1.0) * (-c_[n][m] * v[n + 1][m] - s_[n][m] * w[n + 1][m]) * normalize_z;
+        acc_norm_xy2_[TriangularIndex(n, m)] = normalize * sqrt(factorial);
+      acc_norm_z_[TriangularIndex(n, m)] = (n_d - m_d + 1.0) * normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+    }
+  }
+}
+
+void GeoPotential::CalcAccelerationECEF(const Vector<3> &position_ecef) {
+  CalcVW(position_ecef);
+
+  const double *v = v_.data();
+  const double *w = w_.data();
+  double acc_x = 0.0, acc_y = 0.0, acc_z = 0.0;
+  for (int n = 0; n <= degree_; n++) {
+    const size_t nm = TriangularIndex(n, 0);
+    const size_t n1m = TriangularIndex(n + 1, 0);
+    // m==0
+    acc_x += -c_[nm] * v[n1m + 1] * acc_norm_xy1_[nm];
+    acc_y += -c_[nm] * w[n1m + 1] * acc_norm_xy1_[nm];
+    acc_z += (-c_[nm] * v[n1m] - s_[nm] * w[n1m]) * acc_norm_z_[nm];
+    for (int m = 1; m <= n; m++) {
+      const double c = c_[nm + m];
+      const double s = s_[nm + m];
+      const double v_p = v[n1m + m + 1], w_p = w[n1m + m + 1];  // (n+1, m+1)
+      const double v_0 = v[n1m + m], w_0 = w[n1m + m];          // (n+1, m)
+      const double v_m = v[n1m + m - 1], w_m = w[n1m + m - 1];  // (n+1, m-1)
+
+      acc_x += 0.5 * (acc_norm_xy1_[nm + m] * (-c * v_p - s * w_p) + acc_norm_xy2_[nm + m] * (c * v_m + s * w_m));
+      acc_y += 0.5 * (acc_norm_xy1_[nm + m] * (-c * w_p + s * v_p) + acc_norm_xy2_[nm + m] * (-c * w_m + s * v_m));
+      acc_z += (-c * v_0 - s * w_0) * acc_norm_z_[nm + m];
     }
   }
-  acc_ecef_ *= environment::earth_gravitational_constant_m3_s2 / (environment::earth_equatorial_radius_m * environment::earth_equatorial_radius_m);
+  const double coeff = environment::earth_gravitational_constant_m3_s2 / (environment::earth_equatorial_radius_m * environment::earth_equatorial_radius_m);
+  acc_ecef_[0] = acc_x * coeff;
+  acc_ecef_[1] = acc_y * coeff;
+  acc_ecef_[2] = acc_z * coeff;
 
   return;
 }
 
-void GeoPotential::v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev) {
-  if (n != m) return;
-
-  double n_d = (double)n;
+void GeoPotential::CalcVW(const Vector<3> &position_ecef) {
+  const double x = position_ecef[0], y = position_ecef[1], z = position_ecef[2];
+  const double r2 = x * x + y * y + z * z;
+  const double r = sqrt(r2);
 
-  double tmp = environment::earth_equatorial_radius_m / (r * r);
-  double x_tmp = x * tmp;
-  double y_tmp = y * tmp;
-  double c_normalize;
-  if (n == 1)
-    c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
-  else
-    c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+  const double tmp = environment::earth_equatorial_radius_m / r2;
+  const double x_tmp = x * tmp;
+  const double y_tmp = y * tmp;
+  const double z_tmp = z * tmp;
+  const double re_tmp = environment::earth_equatorial_radius_m * tmp;
 
-  *v_nn = c_normalize * (x_tmp * v_prev - y_tmp * w_prev);
-  *w_nn = c_normalize * (x_tmp * w_prev + y_tmp * v_prev);
-  return;
+  double *v = v_.data();
+  double *w = w_.data();
+  const int degree_vw = degree_ + 1;
+  // n=m=0
+  v[0] = environment::earth_equatorial_radius_m / r;
+  w[0] = 0.0;
+
+  for (int m = 0; m < degree_vw; m++) {
+    // n = m + 1
+    size_t nm = TriangularIndex(m + 1, m);
+    size_t prev = TriangularIndex(m, m);
+    v[nm] = vw_nm_coeff1_[nm] * z_tmp * v[prev];
+    w[nm] = vw_nm_coeff1_[nm] * z_tmp * w[prev];
+    // n > m + 1
+    for (int n = m + 2; n <= degree_vw; n++) {
+      size_t prev2 = prev;
+      prev = nm;
+      nm = TriangularIndex(n, m);
+      v[nm] = vw_nm_coeff1_[nm] * z_tmp * v[prev] - vw_nm_coeff2_[nm] * re_tmp * v[prev2];
+      w[nm] = vw_nm_coeff1_[nm] * z_tmp * w[prev] - vw_nm_coeff2_[nm] * re_tmp * w[prev2];
+    }
+    // n = m = m + 1
+    const size_t mm = TriangularIndex(m, m);
+    const size_t next = TriangularIndex(m + 1, m + 1);
+    v[next] = vw_nn_coeff_[m + 1] * (x_tmp * v[mm] - y_tmp * w[mm]);
+    w[next] = vw_nn_coeff_[m + 1] * (x_tmp * w[mm] + y_tmp * v[mm]);
+  }
 }
 
-void GeoPotential::v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2) {
-  if (n == m) return;
-
-  double m_d = (double)m;
-  double n_d = (double)n;
+void GeoPotential::CalcAccelerationECEFBatch(const size_t num_positions, const double *position_x_m, const double *position_y_m,
+                                             const double *position_z_m, double *acc_x_m_s2, double *acc_y_m_s2, double *acc_z_m_s2) {
+  const size_t lanes = kBatchLanes;
+  double x[kBatchLanes], y[kBatchLanes], z[kBatchLanes];
+  double acc_x[kBatchLanes], acc_y[kBatchLanes], acc_z[kBatchLanes];
+
+  for (size_t head = 0; head < num_positions; head += lanes) {
+    const size_t num_valid = std::min(lanes, num_positions - head);
+    // Unused lanes of the last block repeat the last position to avoid zero division
+    for (size_t k = 0; k < lanes; k++) {
+      const size_t idx = head + std::min(k, num_valid - 1);
+      x[k] = position_x_m[idx];
+      y[k] = position_y_m[idx];
+      z[k] = position_z_m[idx];
+    }
+    CalcAccelerationECEFBlock(x, y, z, acc_x, acc_y, acc_z);
+    for (size_t k = 0; k < num_valid; k++) {
+      acc_x_m_s2[head + k] = acc_x[k];
+      acc_y_m_s2[head + k] = acc_y[k];
+      acc_z_m_s2[head + k] = acc_z[k];
+    }
+  }
+}
 
-  double tmp = environment::earth_equatorial_radius_m / (r * r);
-  double z_tmp = z * tmp;
-  double re_tmp = environment::earth_equatorial_radius_m * tmp;
-  double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
-  double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
-  double c_normalize, c2_normalize;
+void GeoPotential::CalcAccelerationECEFBlock(const double *position_x_m, const double *position_y_m, const double *position_z_m, double *acc_x_m_s2,
+                                             double *acc_y_m_s2, double *acc_z_m_s2) {
+  const int L = kBatchLanes;
+  const double re = environment::earth_equatorial_radius_m;
+  double x_tmp[L], y_tmp[L], z_tmp[L], re_tmp[L];
+
+  double *v = v_batch_.data();
+  double *w = w_batch_.data();
+  for (int k = 0; k < L; k++) {
+    const double r2 = position_x_m[k] * position_x_m[k] + position_y_m[k] * position_y_m[k] + position_z_m[k] * position_z_m[k];
+    const double tmp = re / r2;
+    x_tmp[k] = position_x_m[k] * tmp;
+    y_tmp[k] = position_y_m[k] * tmp;
+    z_tmp[k] = position_z_m[k] * tmp;
+    re_tmp[k] = re * tmp;
+    // n=m=0
+    v[k] = re / sqrt(r2);
+    w[k] = 0.0;
+  }
 
-  c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
-  if (n <= 1)
-    c2_normalize = 1.0;
-  else
-    c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+  // Calc V and W
+  const int degree_vw = degree_ + 1;
+  for (int m = 0; m < degree_vw; m++) {
+    // n = m + 1
+    size_t nm = TriangularIndex(m + 1, m);
+    size_t prev = TriangularIndex(m, m);
+    double coeff1 = vw_nm_coeff1_[nm];
+    for (int k = 0; k < L; k++) {
+      v[nm * L + k] = coeff1 * z_tmp[k] * v[prev * L + k];
+      w[nm * L + k] = coeff1 * z_tmp[k] * w[prev * L + k];
+    }
+    // n > m + 1
+    for (int n = m + 2; n <= degree_vw; n++) {
+      size_t prev2 = prev;
+      prev = nm;
+      nm = TriangularIndex(n, m);
+      coeff1 = vw_nm_coeff1_[nm];
+      const double coeff2 = vw_nm_coeff2_[nm];
+      for (int k = 0; k < L; k++) {
+        v[nm * L + k] = coeff1 * z_tmp[k] * v[prev * L + k] - coeff2 * re_tmp[k] * v[prev2 * L + k];
+        w[nm * L + k] = coeff1 * z_tmp[k] * w[prev * L + k] - coeff2 * re_tmp[k] * w[prev2 * L + k];
+      }
+    }
+    // n = m = m + 1
+    const size_t mm = TriangularIndex(m, m) * L;
+    const size_t next = TriangularIndex(m + 1, m + 1) * L;
+    const double coeff_nn = vw_nn_coeff_[m + 1];
+    for (int k = 0; k < L; k++) {
+      v[next + k] = coeff_nn * (x_tmp[k] * v[mm + k] - y_tmp[k] * w[mm + k]);
+      w[next + k] = coeff_nn * (x_tmp[k] * w[mm + k] + y_tmp[k] * v[mm + k]);
+    }
+  }
 
-  *v_nm = c_normalize * (c1 * z_tmp * v_prev - c2 * c2_normalize * re_tmp * v_prev2);
-  *w_nm = c_normalize * (c1 * z_tmp * w_prev - c2 * c2_normalize * re_tmp * w_prev2);
-  return;
+  // Calc Acceleration
+  for (int k = 0; k < L; k++) {
+    acc_x_m_s2[k] = 0.0;
+    acc_y_m_s2[k] = 0.0;
+    acc_z_m_s2[k] = 0.0;
+  }
+  for (int n = 0; n <= degree_; n++) {
+    const size_t nm = TriangularIndex(n, 0);
+    const size_t n1m = TriangularIndex(n + 1, 0);
+    // m==0
+    const double c0 = c_[nm], s0 = s_[nm];
+    const double norm_xy0 = acc_norm_xy1_[nm], norm_z0 = acc_norm_z_[nm];
+    for (int k = 0; k < L; k++) {
+      acc_x_m_s2[k] += -c0 * v[(n1m + 1) * L + k] * norm_xy0;
+      acc_y_m_s2[k] += -c0 * w[(n1m + 1) * L + k] * norm_xy0;
+      acc_z_m_s2[k] += (-c0 * v[n1m * L + k] - s0 * w[n1m * L + k]) * norm_z0;
+    }
+    for (int m = 1; m <= n; m++) {
+      const double c = c_[nm + m];
+      const double s = s_[nm + m];
+      const double norm_xy1 = acc_norm_xy1_[nm + m], norm_xy2 = acc_norm_xy2_[nm + m], norm_z = acc_norm_z_[nm + m];
+      const double *v_p = &v[(n1m + m + 1) * L], *w_p = &w[(n1m + m + 1) * L];  // (n+1, m+1)
+      const double *v_0 = &v[(n1m + m) * L], *w_0 = &w[(n1m + m) * L];          // (n+1, m)
+      const double *v_m = &v[(n1m + m - 1) * L], *w_m = &w[(n1m + m - 1) * L];  // (n+1, m-1)
+      for (int k = 0; k < L; k++) {
+        acc_x_m_s2[k] += 0.5 * (norm_xy1 * (-c * v_p[k] - s * w_p[k]) + norm_xy2 * (c * v_m[k] + s * w_m[k]));
+        acc_y_m_s2[k] += 0.5 * (norm_xy1 * (-c * w_p[k] + s * v_p[k]) + norm_xy2 * (-c * w_m[k] + s * v_m[k]));
+        acc_z_m_s2[k] += (-c * v_0[k] - s * w_0[k]) * norm_z;
+      }
+    }
+  }
+  const double coeff = environment::earth_gravitational_constant_m3_s2 / (re * re);
+  for (int k = 0; k < L; k++) {
+    acc_x_m_s2[k] *= coeff;
+    acc_y_m_s2[k] *= coeff;
+    acc_z_m_s2[k] *= coeff;
+  }
 }
 
 string GeoPotential::GetLogHeader() const {
@@ -212,3 +382,19 @@ string GeoPotential::GetLogValue() const {
 
   return str_tmp;
 }
+
+void GeoPotential::SaveState(CheckpointWriter& writer) const {
+  Disturbance::SaveState(writer);
+  writer.WriteSection("GeoPotential");
+  writer.Write(acc_ecef_);
+  writer.Write(dcm_eci2ecef_);
+  writer.Write(debug_pos_ecef_);
+}
+
+void GeoPotential::LoadState(CheckpointReader& reader) {
+  Disturbance::LoadState(reader);
+  if (!reader.ReadSection("GeoPotential")) return;
+  reader.Read(acc_ecef_);
+  reader.Read(dcm_eci2ecef_);
+  reader.Read(debug_pos_ecef_);
+}
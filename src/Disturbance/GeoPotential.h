@@ -6,6 +6,7 @@
 #ifndef __GEOPOTENTIAL_H__
 #define __GEOPOTENTIAL_H__
 #include <string>
+#include <vector>
 
 #include "../Interface/LogOutput/ILoggable.h"
 #include "../Library/math/MatVec.hpp"
@@ -33,6 +34,12 @@ class GeoPotential : public AccelerationDisturbance {
    * @brief Override Updates function of SimpleDisturbance
    */
   virtual void Update(const LocalEnvironment &local_env, const Dynamics &dynamics);
+  /**
+   * @fn CalcAccelerationI
+   * @brief Override CalcAccelerationI function of AccelerationDisturbance
+   * @note The ECEF frame of the last Update is rotated with the mean angular velocity of the Earth. The logged acceleration is not changed.
+   */
+  virtual Vector<3> CalcAccelerationI(const Vector<3> &position_i, const Vector<3> &velocity_i, const double time_from_update_s);
 
   // Override ILoggable
   /**
@@ -46,12 +53,47 @@ class GeoPotential : public AccelerationDisturbance {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the disturbance outputs and the acceleration at the last update
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   /**
    * @fn CalcAccelerationECEF
    * @brief Calculate the high-order earth gravity in the ECEF frame
    * @param [in] position_ecef: Position of the spacecraft in the ECEF fram [m]
    */
   void CalcAccelerationECEF(const Vector<3> &position_ecef);
+  /**
+   * @fn GetAccelerationECEF
+   * @brief Return the acceleration calculated by the last CalcAccelerationECEF call in the ECEF frame [m/s2]
+   */
+  inline Vector<3> GetAccelerationECEF() const { return acc_ecef_; }
+  /**
+   * @fn CalcAccelerationECEFBatch
+   * @brief Calculate the high-order earth gravity in the ECEF frame for multiple positions at once
+   * @note Positions are processed in blocks of kBatchLanes and the (n, m) recursion runs over all positions of a block, so that the compiler
+   * vectorizes the inner loops with the enabled instruction set (e.g. AVX2, AVX-512). Without SIMD the same code runs as a scalar loop.
+   * The arithmetic order of each position is the same as CalcAccelerationECEF, so the results agree within a relative error of 1e-14
+   * (bitwise identical when floating-point contraction is disabled).
+   * The acc_ecef_ of this instance is not updated.
+   * @param [in] num_positions: Number of positions
+   * @param [in] position_x_m: X components of the positions in the ECEF frame [m]
+   * @param [in] position_y_m: Y components of the positions in the ECEF frame [m]
+   * @param [in] position_z_m: Z components of the positions in the ECEF frame [m]
+   * @param [out] acc_x_m_s2: X components of the accelerations in the ECEF frame [m/s2]
+   * @param [out] acc_y_m_s2: Y components of the accelerations in the ECEF frame [m/s2]
+   * @param [out] acc_z_m_s2: Z components of the accelerations in the ECEF frame [m/s2]
+   */
+  void CalcAccelerationECEFBatch(const size_t num_positions, const double *position_x_m, const double *position_y_m, const double *position_z_m,
+                                 double *acc_x_m_s2, double *acc_y_m_s2, double *acc_z_m_s2);
 
   /**
    * @fn ReadCoefficientsEGM96
@@ -61,25 +103,52 @@ class GeoPotential : public AccelerationDisturbance {
   bool ReadCoefficientsEGM96(std::string file_name);
 
  private:
-  int degree_;                //!< Maximum degree setting to calculate the geo-potential
-  vector<vector<double>> c_;  //!< Cosine coefficients
-  vector<vector<double>> s_;  //!< Sine coefficients
-  Vector<3> acc_ecef_;        //!< Calculated acceleration in the ECEF frame [m/s2]
-  // calculation
-  double r = 0.0;                    //!< Radius [m]
-  double x = 0.0, y = 0.0, z = 0.0;  //!< Spacecraft position in ECEF frame [m]
-  int n = 0, m = 0;                  //!< Degree and order
+  int degree_;                 //!< Maximum degree setting to calculate the geo-potential
+  std::vector<double> c_;      //!< Cosine coefficients packed in triangular order (see TriangularIndex)
+  std::vector<double> s_;      //!< Sine coefficients packed in triangular order (see TriangularIndex)
+  Vector<3> acc_ecef_;         //!< Calculated acceleration in the ECEF frame [m/s2]
+  Matrix<3, 3> dcm_eci2ecef_;  //!< Direction cosine matrix from the ECI frame to the ECEF frame at the last Update
+
+  // Normalization tables generated once from degree_
+  std::vector<double> vw_nn_coeff_;   //!< Sectoral (n = m) recursion factor of V and W for each n
+  std::vector<double> vw_nm_coeff1_;  //!< Zonal/tesseral (n > m) recursion factor for the (n-1, m) term
+  std::vector<double> vw_nm_coeff2_;  //!< Zonal/tesseral (n > m) recursion factor for the (n-2, m) term
+  std::vector<double> acc_norm_xy1_;  //!< Normalization factor for the (n+1, m+1) term of the x/y acceleration
+  std::vector<double> acc_norm_xy2_;  //!< Normalization factor for the (n+1, m-1) term of the x/y acceleration
+  std::vector<double> acc_norm_z_;    //!< Normalization factor (including n-m+1) for the (n+1, m) term of the z acceleration
+
+  // Calculation buffers allocated once in the constructor
+  std::vector<double> v_;  //!< V function values packed in triangular order up to degree_ + 1
+  std::vector<double> w_;  //!< W function values packed in triangular order up to degree_ + 1
+
+  static const int kBatchLanes = 8;  //!< Number of positions calculated together in CalcAccelerationECEFBatch
+  std::vector<double> v_batch_;      //!< V function values for a block of positions, [triangular index][lane]
+  std::vector<double> w_batch_;      //!< W function values for a block of positions, [triangular index][lane]
 
   /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
+   * @fn TriangularIndex
+   * @brief Return the packed index of the degree n and order m element (m <= n)
+   */
+  static inline size_t TriangularIndex(const int n, const int m) { return static_cast<size_t>(n) * (n + 1) / 2 + m; }
+  /**
+   * @fn InitializeTables
+   * @brief Allocate the coefficient and calculation buffers and calculate normalization tables for degree_
+   */
+  void InitializeTables();
+  /**
+   * @fn CalcVW
+   * @brief Calculate V and W functions up to degree_ + 1 into v_ and w_
+   * @param [in] position_ecef: Position of the spacecraft in the ECEF fram [m]
    */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
+  void CalcVW(const Vector<3> &position_ecef);
   /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
+   * @fn CalcAccelerationECEFBlock
+   * @brief Calculate the acceleration of kBatchLanes positions with v_batch_ and w_batch_
+   * @param [in] position_x_m, position_y_m, position_z_m: Position components of each lane in the ECEF frame [m]
+   * @param [out] acc_x_m_s2, acc_y_m_s2, acc_z_m_s2: Acceleration components of each lane in the ECEF frame [m/s2]
    */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+  void CalcAccelerationECEFBlock(const double *position_x_m, const double *position_y_m, const double *position_z_m, double *acc_x_m_s2,
+                                 double *acc_y_m_s2, double *acc_z_m_s2);
 
   // debug
   Vector<3> debug_pos_ecef_;  //!< Spacecraft position in ECEF frame [m]
@@ -10,12 +10,15 @@ using libra::NormalRand;
 #include <Library/utils/Macros.hpp>
 
 #include "../Interface/LogOutput/LogUtility.h"
-#include "../Library/math/GlobalRand.h"
+#include "../Library/math/RandomContext.hpp"
 #include "../Library/math/RandomWalk.hpp"
 
 using namespace std;
 
-MagDisturbance::MagDisturbance(const RMMParams& rmm_params) : rmm_params_(rmm_params) {
+MagDisturbance::MagDisturbance(const RMMParams& rmm_params)
+    : rmm_params_(rmm_params),
+      rw_(0.1, Vector<3>(rmm_params.GetRMMRWDev()), Vector<3>(rmm_params.GetRMMRWLimit()), "MagDisturbance/rw"),
+      nr_(0.0, rmm_params.GetRMMWNVar(), libra::RandomContext::GetCurrent().MakeSeed("MagDisturbance")) {
   for (int i = 0; i < 3; ++i) {
     torque_b_[i] = 0;
   }
@@ -36,16 +39,11 @@ void MagDisturbance::Update(const LocalEnvironment& local_env, const Dynamics& d
 }
 
 void MagDisturbance::CalcRMM() {
-  static Vector<3> stddev(rmm_params_.GetRMMRWDev());
-  static Vector<3> limit(rmm_params_.GetRMMRWLimit());
-  static RandomWalk<3> rw(0.1, stddev, limit);
-  static NormalRand nr(0.0, rmm_params_.GetRMMWNVar(), g_rand.MakeSeed());
-
   rmm_b_ = rmm_params_.GetRMMConst_b();
   for (int i = 0; i < 3; ++i) {
-    rmm_b_[i] += rw[i] + nr;
+    rmm_b_[i] += rw_[i] + nr_;
   }
-  ++rw;  // Update random walk
+  ++rw_;  // Update random walk
 }
 
 void MagDisturbance::PrintTorque() {
@@ -70,3 +68,19 @@ string MagDisturbance::GetLogValue() const {
 
   return str_tmp;
 }
+
+void MagDisturbance::SaveState(CheckpointWriter& writer) const {
+  Disturbance::SaveState(writer);
+  writer.WriteSection("MagDisturbance");
+  writer.Write(rmm_b_);
+  rw_.SaveState(writer);
+  writer.Write(nr_);
+}
+
+void MagDisturbance::LoadState(CheckpointReader& reader) {
+  Disturbance::LoadState(reader);
+  if (!reader.ReadSection("MagDisturbance")) return;
+  reader.Read(rmm_b_);
+  rw_.LoadState(reader);
+  reader.Read(nr_);
+}
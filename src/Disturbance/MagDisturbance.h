@@ -8,6 +8,8 @@
 
 #include <string>
 
+#include "../Library/math/NormalRand.hpp"
+#include "../Library/math/RandomWalk.hpp"
 #include "../Library/math/Vector.hpp"
 using libra::Vector;
 
@@ -61,11 +63,25 @@ class MagDisturbance : public SimpleDisturbance {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the disturbance outputs and the states of the RMM noise
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   double mag_unit_;  //!< Constant value to change the unit [nT] -> [T]
 
   Vector<3> rmm_b_;              //!< True RMM of the spacecraft in the body frame [Am2]
   const RMMParams& rmm_params_;  //!< RMM parameters
+  RandomWalk<3> rw_;             //!< Random walk of the RMM
+  libra::NormalRand nr_;         //!< White noise of the RMM
 };
 
 #endif  //__MagDisturbance_H__
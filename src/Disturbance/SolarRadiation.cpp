@@ -14,7 +14,8 @@ SolarRadiation::SolarRadiation(const vector<Surface>& surfaces, const Vector<3>&
 void SolarRadiation::Update(const LocalEnvironment& local_env, const Dynamics& dynamics) {
   UNUSED(dynamics);
 
-  Vector<3> tmp = local_env.GetCelesInfo().GetPosFromSC_b("SUN");
+  if (sun_id_ < 0) sun_id_ = local_env.GetCelesInfo().CalcBodyIdFromName("SUN");
+  Vector<3> tmp = local_env.GetCelesInfo().GetPosFromSC_b(sun_id_);
   CalcTorqueForce(tmp, local_env.GetSrp().CalcTruePressure());
 }
 
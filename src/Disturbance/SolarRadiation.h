@@ -51,6 +51,8 @@ class SolarRadiation : public SurfaceForce {
    * @param [in] item: Solar pressure [N/m^2]
    */
   virtual void CalcCoef(Vector<3>& input_b, double item);
+
+  int sun_id_ = -1;  //!< ID of the sun in CelestialInformation list (resolved at the first Update)
 };
 
 #endif /* SolarRadiation_h */
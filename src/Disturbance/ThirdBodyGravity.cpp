@@ -12,18 +12,42 @@ ThirdBodyGravity::~ThirdBodyGravity() {}
 void ThirdBodyGravity::Update(const LocalEnvironment& local_env, const Dynamics& dynamics) {
   acceleration_i_ = libra::Vector<3>(0);  // initialize
 
+  if (third_body_ids_.size() != third_body_list_.size()) {
+    third_body_ids_.clear();
+    gravity_constants_.clear();
+    for (auto third_body : third_body_list_) {
+      const int id = local_env.GetCelesInfo().CalcBodyIdFromName(third_body.c_str());
+      third_body_ids_.push_back(id);
+      gravity_constants_.push_back(local_env.GetCelesInfo().GetGlobalInfo().GetGravityConstant(id));
+    }
+    third_body_pos_i_.assign(third_body_ids_.size(), libra::Vector<3>(0.0));
+  }
+
   libra::Vector<3> sat_pos_i = dynamics.GetOrbit().GetSatPosition_i();  // position of the spacecraft
                                                                         // from the center object
-  for (auto third_body : third_body_list_) {
+  for (size_t i = 0; i < third_body_ids_.size(); i++) {
     libra::Vector<3> third_body_pos_from_sc_i =
-        local_env.GetCelesInfo().GetPosFromSC_i(third_body.c_str());           // position of the third body from the spacecraft
+        local_env.GetCelesInfo().GetPosFromSC_i(third_body_ids_[i]);           // position of the third body from the spacecraft
     libra::Vector<3> third_body_pos_i = sat_pos_i + third_body_pos_from_sc_i;  // position of the third body
                                                                                // from the center object
-    double gravity_constant = local_env.GetCelesInfo().GetGlobalInfo().GetGravityConstant(third_body.c_str());
 
-    thirdbody_acc_i_ = CalcAcceleration(third_body_pos_i, third_body_pos_from_sc_i, gravity_constant);
+    thirdbody_acc_i_ = CalcAcceleration(third_body_pos_i, third_body_pos_from_sc_i, gravity_constants_[i]);
     acceleration_i_ += thirdbody_acc_i_;
+
+    third_body_pos_i_[i] = third_body_pos_i;
+  }
+}
+
+libra::Vector<3> ThirdBodyGravity::CalcAccelerationI(const libra::Vector<3>& position_i, const libra::Vector<3>& velocity_i,
+                                                     const double time_from_update_s) {
+  (void)velocity_i;
+  (void)time_from_update_s;
+
+  libra::Vector<3> acc_i(0.0);
+  for (size_t i = 0; i < third_body_pos_i_.size(); i++) {
+    acc_i += CalcAcceleration(third_body_pos_i_[i], third_body_pos_i_[i] - position_i, gravity_constants_[i]);
   }
+  return acc_i;
 }
 
 libra::Vector<3> ThirdBodyGravity::CalcAcceleration(libra::Vector<3> s, libra::Vector<3> sr, double GM) {
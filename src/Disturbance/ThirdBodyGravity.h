@@ -7,6 +7,7 @@
 #include <cassert>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "../Interface/LogOutput/ILoggable.h"
 #include "../Library/math/Vector.hpp"
@@ -34,6 +35,13 @@ class ThirdBodyGravity : public AccelerationDisturbance {
    * @brief Update third body disturbance
    */
   virtual void Update(const LocalEnvironment& local_env, const Dynamics& dynamics);
+  /**
+   * @fn CalcAccelerationI
+   * @brief Override CalcAccelerationI function of AccelerationDisturbance
+   * @note The positions of the third bodies at the last Update are used since they move slowly in the update interval
+   */
+  virtual libra::Vector<3> CalcAccelerationI(const libra::Vector<3>& position_i, const libra::Vector<3>& velocity_i,
+                                             const double time_from_update_s);
 
  private:
   // Override classes for ILoggable
@@ -60,4 +68,8 @@ class ThirdBodyGravity : public AccelerationDisturbance {
 
   std::set<std::string> third_body_list_;  //!< List of celestial bodies to calculate the third body disturbances
   libra::Vector<3> thirdbody_acc_i_{0};    //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
+
+  std::vector<int> third_body_ids_;                 //!< IDs of the third bodies in CelestialInformation list (resolved at the first Update)
+  std::vector<libra::Vector<3>> third_body_pos_i_;  //!< Positions of the third bodies from the origin at the last Update [m]
+  std::vector<double> gravity_constants_;           //!< Gravity constants of the third bodies [m3/s2]
 };
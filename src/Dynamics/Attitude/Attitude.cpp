@@ -18,28 +18,20 @@ Attitude::Attitude(const std::string& sim_object_name) : SimulationObject(sim_ob
   k_sc_J_ = 0.0;
 }
 
-std::string Attitude::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("omega_true", "b", "rad/s", 3);
-  str_tmp += WriteVector("quaternion_true", "i2b", "-", 4);
-  str_tmp += WriteVector("torque_true", "b", "Nm", 3);
-  str_tmp += WriteScalar("h_total", "Nms");
-  str_tmp += WriteScalar("k_sc", "J");
-
-  return str_tmp;
+void Attitude::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddVector("omega_true", "b", "rad/s", 3);
+  channels.AddVector("quaternion_true", "i2b", "-", 4);
+  channels.AddVector("torque_true", "b", "Nm", 3);
+  channels.AddScalar("h_total", "Nms");
+  channels.AddScalar("k_sc", "J");
 }
 
-std::string Attitude::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(omega_b_rad_s_);
-  str_tmp += WriteQuaternion(quaternion_i2b_);
-  str_tmp += WriteVector(torque_b_Nm_);
-  str_tmp += WriteScalar(h_total_Nms_);
-  str_tmp += WriteScalar(k_sc_J_);
-
-  return str_tmp;
+void Attitude::WriteLogValues(LogValueSpan& values) const {
+  values.Write(omega_b_rad_s_);
+  values.Write(quaternion_i2b_);
+  values.Write(torque_b_Nm_);
+  values.Write(h_total_Nms_);
+  values.Write(k_sc_J_);
 }
 
 void Attitude::SetParameters(const MCSimExecutor& mc_sim) { GetInitParameterQuaternion(mc_sim, "Q_i2b", quaternion_i2b_); }
@@ -53,3 +45,33 @@ void Attitude::CalcAngMom(void) {
 }
 
 void Attitude::CalcSatRotationalKineticEnergy(void) { k_sc_J_ = 0.5 * libra::inner_product(h_sc_b_Nms_, omega_b_rad_s_); }
+
+void Attitude::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("Attitude");
+  writer.Write(omega_b_rad_s_);
+  writer.Write(quaternion_i2b_);
+  writer.Write(torque_b_Nm_);
+  writer.Write(inertia_tensor_kgm2_);
+  writer.Write(inv_inertia_tensor_);
+  writer.Write(h_sc_b_Nms_);
+  writer.Write(h_rw_b_Nms_);
+  writer.Write(h_total_b_Nms_);
+  writer.Write(h_total_i_Nms_);
+  writer.Write(h_total_Nms_);
+  writer.Write(k_sc_J_);
+}
+
+void Attitude::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("Attitude")) return;
+  reader.Read(omega_b_rad_s_);
+  reader.Read(quaternion_i2b_);
+  reader.Read(torque_b_Nm_);
+  reader.Read(inertia_tensor_kgm2_);
+  reader.Read(inv_inertia_tensor_);
+  reader.Read(h_sc_b_Nms_);
+  reader.Read(h_rw_b_Nms_);
+  reader.Read(h_total_b_Nms_);
+  reader.Read(h_total_i_Nms_);
+  reader.Read(h_total_Nms_);
+  reader.Read(k_sc_J_);
+}
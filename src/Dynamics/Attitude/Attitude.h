@@ -5,18 +5,19 @@
 #ifndef __attitude_H__
 #define __attitude_H__
 
-#include <Interface/LogOutput/ILoggable.h>
+#include <Interface/LogOutput/ITypedLoggable.h>
 #include <Simulation/MCSim/SimulationObject.h>
 
 #include <Library/math/MatVec.hpp>
 #include <Library/math/Quaternion.hpp>
+#include <Library/utils/Checkpoint.hpp>
 #include <string>
 
 /**
  * @class Attitude
  * @brief Base class for attitude of spacecraft
  */
-class Attitude : public ILoggable, public SimulationObject {
+class Attitude : public ITypedLoggable, public SimulationObject, public ICheckpointable {
  public:
   /**
    * @fn Attitude
@@ -135,17 +136,29 @@ class Attitude : public ILoggable, public SimulationObject {
    */
   virtual void Propagate(const double endtime_s) = 0;
 
-  // Override ILoggable
+  // Override ITypedLoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the attitude, angular velocity, torque, inertia tensor, and angular momentum
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
   // SimulationObject for McSim
   virtual void SetParameters(const MCSimExecutor& mc_sim);
@@ -139,3 +139,15 @@ void AttitudeRK4::RungeOneStep(double t, double dt) {
   }
   quaternion_i2b_.normalize();
 }
+
+void AttitudeRK4::SaveState(CheckpointWriter& writer) const {
+  Attitude::SaveState(writer);
+  writer.WriteSection("AttitudeRK4");
+  writer.Write(prop_time_s_);
+}
+
+void AttitudeRK4::LoadState(CheckpointReader& reader) {
+  Attitude::LoadState(reader);
+  if (!reader.ReadSection("AttitudeRK4")) return;
+  reader.Read(prop_time_s_);
+}
@@ -1,6 +1,8 @@
 /**
  * @file AttitudeRK4.h
  * @brief Class to calculate spacecraft attitude with Runge-Kutta method
+ * @note The attitude is always integrated with the fixed step AttitudeRKStepSec. It does not derive from libra::ODE and has no adaptive step
+ * width.
  */
 #ifndef __attitude_rk4_H__
 #define __attitude_rk4_H__
@@ -50,6 +52,18 @@ class AttitudeRK4 : public Attitude {
    */
   virtual void Propagate(const double endtime_s);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the attitude and the propagation time
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   /**
    * @fn SetParameters
    * @brief Set parameters for Monte-Carlo simulation
@@ -23,6 +23,8 @@ ControlledAttitude::ControlledAttitude(const AttCtrlMode main_mode, const AttCtr
       pointing_sub_t_b_(pointing_sub_t_b),
       local_celes_info_(local_celes_info),
       orbit_(orbit) {
+  sun_id_ = local_celes_info_->CalcBodyIdFromName("SUN");
+  earth_id_ = local_celes_info_->CalcBodyIdFromName("EARTH");
   quaternion_i2b_ = quaternion_i2b;
   inertia_tensor_kgm2_ = inertia_tensor_kgm2;  // FIXME: inertia tensor should be initialized in the Attitude base class
   inv_inertia_tensor_ = invert(inertia_tensor_kgm2_);
@@ -82,9 +84,9 @@ void ControlledAttitude::Propagate(const double endtime_s) {
 Vector<3> ControlledAttitude::CalcTargetDirection(AttCtrlMode mode) {
   Vector<3> direction;
   if (mode == SUN_POINTING) {
-    direction = local_celes_info_->GetPosFromSC_i("SUN");
+    direction = local_celes_info_->GetPosFromSC_i(sun_id_);
   } else if (mode == EARTH_CENTER_POINTING) {
-    direction = local_celes_info_->GetPosFromSC_i("EARTH");
+    direction = local_celes_info_->GetPosFromSC_i(earth_id_);
   } else if (mode == VELOCITY_DIRECTION_POINTING) {
     direction = orbit_->GetSatVelocity_i();
   } else if (mode == ORBIT_NORMAL_POINTING) {
@@ -167,3 +169,25 @@ void ControlledAttitude::CalcAngularVelocity(const double current_time_s) {
   prev_quaternion_i2b_ = quaternion_i2b_;
   prev_omega_b_rad_s_ = omega_b_rad_s_;
 }
+
+void ControlledAttitude::SaveState(CheckpointWriter& writer) const {
+  Attitude::SaveState(writer);
+  writer.WriteSection("ControlledAttitude");
+  writer.Write(main_mode_);
+  writer.Write(sub_mode_);
+  writer.Write(pointing_t_b_);
+  writer.Write(pointing_sub_t_b_);
+  writer.Write(prev_quaternion_i2b_);
+  writer.Write(prev_omega_b_rad_s_);
+}
+
+void ControlledAttitude::LoadState(CheckpointReader& reader) {
+  Attitude::LoadState(reader);
+  if (!reader.ReadSection("ControlledAttitude")) return;
+  reader.Read(main_mode_);
+  reader.Read(sub_mode_);
+  reader.Read(pointing_t_b_);
+  reader.Read(pointing_sub_t_b_);
+  reader.Read(prev_quaternion_i2b_);
+  reader.Read(prev_omega_b_rad_s_);
+}
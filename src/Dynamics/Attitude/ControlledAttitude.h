@@ -95,6 +95,18 @@ class ControlledAttitude : public Attitude {
    */
   virtual void Propagate(const double endtime_s);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the attitude and the control modes
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   AttCtrlMode main_mode_;                  //!< Main control mode
   AttCtrlMode sub_mode_;                   //!< Sub control mode
@@ -106,6 +118,8 @@ class ControlledAttitude : public Attitude {
 
   // Inputs
   const LocalCelestialInformation* local_celes_info_;  //!< Local celestial information
+  int sun_id_;                                         //!< ID of the sun in CelestialInformation list
+  int earth_id_;                                       //!< ID of the earth in CelestialInformation list
   const Orbit* orbit_;                                 //!< Orbit information
 
   // Local functions
@@ -30,6 +30,7 @@ void Dynamics::Initialize(SimulationConfig* sim_config, const SimTime* sim_time,
   attitude_ = InitAttitude(sim_config->sat_file_[sat_id], orbit_, local_celes_info, sim_time->GetAttitudeRKStepSec(),
                            structure->GetKinematicsParams().GetInertiaTensor(), sat_id);
   temperature_ = InitTemperature(sim_config->sat_file_[sat_id], sim_time->GetThermalRKStepSec());
+  sun_id_ = local_celes_info->CalcBodyIdFromName("SUN");
 
   // To get initial value
   orbit_->UpdateAtt(attitude_->GetQuaternion_i2b());
@@ -49,11 +50,7 @@ void Dynamics::Update(const SimTime* sim_time, const LocalCelestialInformation*
 
   // Thermal
   if (sim_time->GetThermalPropagateFlag()) {
-    std::string sun_str = "SUN";
-    char* c_sun = new char[sun_str.size() + 1];
-    std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
-    temperature_->Propagate(local_celes_info->GetPosFromSC_b(c_sun), sim_time->GetElapsedSec());
-    delete[] c_sun;
+    temperature_->Propagate(local_celes_info->GetPosFromSC_b(sun_id_), sim_time->GetElapsedSec());
   }
 }
 
@@ -63,6 +60,18 @@ void Dynamics::ClearForceTorque(void) {
   orbit_->SetAcceleration_i(zero);
 }
 
+void Dynamics::SaveState(CheckpointWriter& writer) const {
+  attitude_->SaveState(writer);
+  orbit_->SaveState(writer);
+  temperature_->SaveState(writer);
+}
+
+void Dynamics::LoadState(CheckpointReader& reader) {
+  attitude_->LoadState(reader);
+  orbit_->LoadState(reader);
+  temperature_->LoadState(reader);
+}
+
 void Dynamics::LogSetup(Logger& logger) {
   logger.AddLoggable(attitude_);
   logger.AddLoggable(orbit_);
@@ -76,6 +85,8 @@ void Dynamics::AddForce_b(Vector<3> force_b) {
 
 void Dynamics::AddAcceleration_i(Vector<3> acceleration_i) { orbit_->AddAcceleration_i(acceleration_i); }
 
+void Dynamics::SetOrbitAccelerationModel(OrbitAccelerationModel* acceleration_model) { orbit_->SetAccelerationModel(acceleration_model); }
+
 Vector<3> Dynamics::GetPosition_i() const { return orbit_->GetSatPosition_i(); }
 
 Quaternion Dynamics::GetQuaternion_i2b() const { return attitude_->GetQuaternion_i2b(); }
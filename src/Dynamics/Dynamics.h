@@ -92,11 +92,29 @@ class Dynamics {
    * @param [in] acceleration_b: Force in the body fixed frame [N]
    */
   void AddAcceleration_i(Vector<3> acceleration_i);
+  /**
+   * @fn SetOrbitAccelerationModel
+   * @brief Set the acceleration model evaluated in each integration stage of the orbit propagation
+   * @param [in] acceleration_model: Acceleration model
+   */
+  void SetOrbitAccelerationModel(OrbitAccelerationModel* acceleration_model);
   /**
    * @fn ClearForceTorque
    * @brief Clear force, acceleration, and torque for the dynamics propagation
    */
   void ClearForceTorque(void);
+  /**
+   * @fn SaveState
+   * @brief Write the states of the attitude, orbit, and thermal dynamics
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetAttitude
@@ -136,6 +154,7 @@ class Dynamics {
   Orbit* orbit_;                //!< Orbit dynamics
   Temperature* temperature_;    //!< Thermal dynamics
   const Structure* structure_;  //!< Structure information
+  int sun_id_;                  //!< ID of the sun in CelestialInformation list
 };
 
 #endif  //__dynamics_H__
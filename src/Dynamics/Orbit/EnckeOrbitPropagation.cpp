@@ -55,30 +55,24 @@ void EnckeOrbitPropagation::Propagate(double endtime, double current_jd) {
   UpdateSatOrbit();
 }
 
-std::string EnckeOrbitPropagation::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("sat_position", "i", "m", 3);
-  str_tmp += WriteVector("sat_velocity", "i", "m/s", 3);
-  str_tmp += WriteVector("sat_velocity", "b", "m/s", 3);
-  str_tmp += WriteVector("sat_acc", "i", "m/s^2", 3);
-  str_tmp += WriteScalar("lat", "rad");
-  str_tmp += WriteScalar("lon", "rad");
-  str_tmp += WriteScalar("alt", "m");
-  return str_tmp;
+void EnckeOrbitPropagation::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddVector("sat_position", "i", "m", 3, 16);
+  channels.AddVector("sat_velocity", "i", "m/s", 3, 10);
+  channels.AddVector("sat_velocity", "b", "m/s", 3, 10);
+  channels.AddVector("sat_acc", "i", "m/s^2", 3, 10);
+  channels.AddScalar("lat", "rad");
+  channels.AddScalar("lon", "rad");
+  channels.AddScalar("alt", "m");
 }
 
-std::string EnckeOrbitPropagation::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(sat_position_i_, 16);
-  str_tmp += WriteVector(sat_velocity_i_, 10);
-  str_tmp += WriteVector(sat_velocity_b_, 10);
-  str_tmp += WriteVector(acc_i_, 10);
-  str_tmp += WriteScalar(sat_position_geo_.GetLat_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetLon_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetAlt_m());
-  return str_tmp;
+void EnckeOrbitPropagation::WriteLogValues(LogValueSpan& values) const {
+  values.Write(sat_position_i_);
+  values.Write(sat_velocity_i_);
+  values.Write(sat_velocity_b_);
+  values.Write(acc_i_);
+  values.Write(sat_position_geo_.GetLat_rad());
+  values.Write(sat_position_geo_.GetLon_rad());
+  values.Write(sat_position_geo_.GetAlt_m());
 }
 
 // Functions for ODE
@@ -145,3 +139,27 @@ double EnckeOrbitPropagation::CalcQFunction(Vector<3> diff_pos_i) {
 
   return q_func;
 }
+
+void EnckeOrbitPropagation::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  writer.WriteSection("EnckeOrbitPropagation");
+  libra::ODE<6>::SaveState(writer);
+  writer.Write(prop_time_s_);
+  writer.Write(ref_position_i_m_);
+  writer.Write(ref_velocity_i_m_s_);
+  ref_kepler_orbit.SaveState(writer);
+  writer.Write(diff_position_i_m_);
+  writer.Write(diff_velocity_i_m_s_);
+}
+
+void EnckeOrbitPropagation::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  if (!reader.ReadSection("EnckeOrbitPropagation")) return;
+  libra::ODE<6>::LoadState(reader);
+  reader.Read(prop_time_s_);
+  reader.Read(ref_position_i_m_);
+  reader.Read(ref_velocity_i_m_s_);
+  ref_kepler_orbit.LoadState(reader);
+  reader.Read(diff_position_i_m_);
+  reader.Read(diff_velocity_i_m_s_);
+}
@@ -10,6 +10,8 @@
 /**
  * @class EnckeOrbitPropagation
  * @brief Class to propagate spacecraft orbit with Encke's method
+ * @note The difference orbit is always integrated with the fixed step RK4. The RHS holds the reference orbit and the spacecraft position of the
+ * start of the update interval, so the error control of the adaptive step width would not bound the error of the orbit.
  */
 class EnckeOrbitPropagation : public Orbit, public libra::ODE<6> {
  public:
@@ -41,17 +43,29 @@ class EnckeOrbitPropagation : public Orbit, public libra::ODE<6> {
    */
   virtual void Propagate(double endtime, double current_jd);
 
-  // Override ILoggable
+  // Override ITypedLoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the orbit, the reference orbit, and the integration of the difference orbit
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
   // Override ODE
   /**
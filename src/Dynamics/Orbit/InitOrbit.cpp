@@ -33,7 +33,14 @@ Orbit* InitOrbit(const CelestialInformation* celes_info, std::string ini_path, d
       position_i_m[i] = pos_vel[i];
       velocity_i_m_s[i] = pos_vel[i + 3];
     }
-    orbit = new Rk4OrbitPropagation(celes_info, gravity_constant, stepSec, position_i_m, velocity_i_m_s);
+    Rk4OrbitPropagation* rk4_orbit = new Rk4OrbitPropagation(celes_info, gravity_constant, stepSec, position_i_m, velocity_i_m_s);
+    double abs_tolerance = conf.ReadDouble(section_, "rk_abs_tolerance");
+    double rel_tolerance = conf.ReadDouble(section_, "rk_rel_tolerance");
+    if (abs_tolerance > 0.0 && rel_tolerance > 0.0) {
+      rk4_orbit->setAdaptiveStep(abs_tolerance, rel_tolerance);
+    }
+    rk4_orbit->SetIsStageAccelerationEnabled(conf.ReadEnable(section_, "stage_acceleration"));
+    orbit = rk4_orbit;
   } else if (propagate_mode == "SGP4") {
     // Initialize SGP4 orbit propagator
     int wgs = conf.ReadInt(section_, "wgs");
@@ -58,8 +65,14 @@ Orbit* InitOrbit(const CelestialInformation* celes_info, std::string ini_path, d
     // the orbit of the reference sat is initialized, create temporary initial orbit of the reference sat
     int reference_sat_id = conf.ReadInt(section_, "reference_sat_id");
 
-    orbit = new RelativeOrbit(celes_info, gravity_constant, stepSec, reference_sat_id, init_relative_position_lvlh, init_relative_velocity_lvlh,
-                              update_method, relative_dynamics_model_type, stm_model_type, rel_info);
+    RelativeOrbit* relative_orbit = new RelativeOrbit(celes_info, gravity_constant, stepSec, reference_sat_id, init_relative_position_lvlh,
+                                                      init_relative_velocity_lvlh, update_method, relative_dynamics_model_type, stm_model_type, rel_info);
+    double abs_tolerance = conf.ReadDouble(section_, "rk_abs_tolerance");
+    double rel_tolerance = conf.ReadDouble(section_, "rk_rel_tolerance");
+    if (update_method == RelativeOrbit::RK4 && abs_tolerance > 0.0 && rel_tolerance > 0.0) {
+      relative_orbit->setAdaptiveStep(abs_tolerance, rel_tolerance);
+    }
+    orbit = relative_orbit;
   } else if (propagate_mode == "KEPLER") {
     // initialize orbit for Kepler propagation
     std::string init_mode_kepler = conf.ReadString(section_, "init_mode_kepler");
@@ -99,6 +112,8 @@ Orbit* InitOrbit(const CelestialInformation* celes_info, std::string ini_path, d
       velocity_i_m_s[i] = pos_vel[i + 3];
     }
 
+    // rk_abs_tolerance and rk_rel_tolerance are not used. The RHS holds the reference orbit and the spacecraft position of the start of the update
+    // interval, so the local error of the adaptive step width would not bound the error of the orbit.
     double error_tolerance = conf.ReadDouble(section_, "error_tolerance");
     orbit = new EnckeOrbitPropagation(celes_info, gravity_constant, stepSec, current_jd, position_i_m, velocity_i_m_s, error_tolerance);
   } else {
@@ -23,32 +23,24 @@ void KeplerOrbitPropagation::Propagate(double endtime, double current_jd) {
   UpdateState(current_jd);
 }
 
-std::string KeplerOrbitPropagation::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("sat_position", "i", "m", 3);
-  str_tmp += WriteVector("sat_velocity", "i", "m/s", 3);
-  str_tmp += WriteVector("sat_velocity", "b", "m/s", 3);
-  str_tmp += WriteVector("sat_acc_i", "i", "m/s^2", 3);
-  str_tmp += WriteScalar("lat", "rad");
-  str_tmp += WriteScalar("lon", "rad");
-  str_tmp += WriteScalar("alt", "m");
-
-  return str_tmp;
+void KeplerOrbitPropagation::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddVector("sat_position", "i", "m", 3, 16);
+  channels.AddVector("sat_velocity", "i", "m/s", 3, 10);
+  channels.AddVector("sat_velocity", "b", "m/s", 3, 10);
+  channels.AddVector("sat_acc_i", "i", "m/s^2", 3, 10);
+  channels.AddScalar("lat", "rad");
+  channels.AddScalar("lon", "rad");
+  channels.AddScalar("alt", "m");
 }
 
-std::string KeplerOrbitPropagation::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(sat_position_i_, 16);
-  str_tmp += WriteVector(sat_velocity_i_, 10);
-  str_tmp += WriteVector(sat_velocity_b_, 10);
-  str_tmp += WriteVector(acc_i_, 10);
-  str_tmp += WriteScalar(sat_position_geo_.GetLat_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetLon_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetAlt_m());
-
-  return str_tmp;
+void KeplerOrbitPropagation::WriteLogValues(LogValueSpan& values) const {
+  values.Write(sat_position_i_);
+  values.Write(sat_velocity_i_);
+  values.Write(sat_velocity_b_);
+  values.Write(acc_i_);
+  values.Write(sat_position_geo_.GetLat_rad());
+  values.Write(sat_position_geo_.GetLon_rad());
+  values.Write(sat_position_geo_.GetAlt_m());
 }
 
 // Private Function
@@ -59,3 +51,15 @@ void KeplerOrbitPropagation::UpdateState(const double current_jd) {
   TransEciToEcef();
   TransEcefToGeo();
 }
+
+void KeplerOrbitPropagation::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  writer.WriteSection("KeplerOrbitPropagation");
+  KeplerOrbit::SaveState(writer);
+}
+
+void KeplerOrbitPropagation::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  if (!reader.ReadSection("KeplerOrbitPropagation")) return;
+  KeplerOrbit::LoadState(reader);
+}
@@ -51,4 +51,28 @@ OrbitInitializeMode SetOrbitInitializeMode(const std::string initialize_mode) {
   } else {
     return OrbitInitializeMode::kDefault;
   }
-}
\ No newline at end of file
+}
+
+void Orbit::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("Orbit");
+  writer.Write(is_calc_enabled_);
+  writer.Write(sat_position_i_);
+  writer.Write(sat_position_ecef_);
+  writer.Write(sat_position_geo_);
+  writer.Write(sat_velocity_i_);
+  writer.Write(sat_velocity_b_);
+  writer.Write(sat_velocity_ecef_);
+  writer.Write(acc_i_);
+}
+
+void Orbit::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("Orbit")) return;
+  reader.Read(is_calc_enabled_);
+  reader.Read(sat_position_i_);
+  reader.Read(sat_position_ecef_);
+  reader.Read(sat_position_geo_);
+  reader.Read(sat_velocity_i_);
+  reader.Read(sat_velocity_b_);
+  reader.Read(sat_velocity_ecef_);
+  reader.Read(acc_i_);
+}
@@ -16,10 +16,13 @@ using libra::Quaternion;
 using libra::Vector;
 
 #include <Environment/Global/CelestialInformation.h>
-#include <Interface/LogOutput/ILoggable.h>
+#include <Interface/LogOutput/ITypedLoggable.h>
 
 #include <Environment/Global/PhysicalConstants.hpp>
 #include <Library/Geodesy/GeodeticPosition.hpp>
+#include <Library/utils/Checkpoint.hpp>
+
+#include "OrbitAccelerationModel.h"
 
 /**
  * @enum OrbitPropagateMode
@@ -47,7 +50,7 @@ enum class OrbitInitializeMode {
  * @class Orbit
  * @brief Base class of orbit propagation
  */
-class Orbit : public ILoggable {
+class Orbit : public ITypedLoggable, public ICheckpointable {
  public:
   /**
    * @fn Orbit
@@ -84,6 +87,25 @@ class Orbit : public ILoggable {
    */
   inline virtual void AddPositionOffset(Vector<3> offset_i) { (void)offset_i; }
 
+  /**
+   * @fn SetAccelerationModel
+   * @brief Set the acceleration model evaluated in each integration stage
+   * @note The model is ignored by the propagators which do not support the evaluation in the integration stages
+   * @param [in] acceleration_model: Acceleration model
+   */
+  inline virtual void SetAccelerationModel(OrbitAccelerationModel* acceleration_model) { (void)acceleration_model; }
+  /**
+   * @fn GetIsAccelerationModelUsed
+   * @brief Return true when the acceleration model is evaluated in the integration stages
+   * @note The acceleration of the model should not be added with AddAcceleration_i in this case
+   */
+  inline virtual bool GetIsAccelerationModelUsed() const { return false; }
+  /**
+   * @fn GetReferenceSatId
+   * @brief Return the ID of the spacecraft whose orbit is read in the propagation, or -1 when the orbit does not depend on other spacecraft
+   */
+  inline virtual int GetReferenceSatId() const { return -1; }
+
   // Getters
   /**
    * @fn GetIsCalcEnabled
@@ -182,17 +204,29 @@ class Orbit : public ILoggable {
    */
   Quaternion CalcQuaternionI2LVLH() const;
 
-  // Override ILoggable
+  // Override ITypedLoggable
+  /**
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
+   */
+  virtual void DeclareLogChannels(LogChannelList& channels) const = 0;
+  /**
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
+   */
+  virtual void WriteLogValues(LogValueSpan& values) const = 0;
+
+  // Override ICheckpointable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn SaveState
+   * @brief Write the position, velocity, and acceleration of the spacecraft
    */
-  virtual std::string GetLogHeader() const = 0;
+  virtual void SaveState(CheckpointWriter& writer) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LoadState
+   * @brief Read the states written by SaveState
    */
-  virtual std::string GetLogValue() const = 0;
+  virtual void LoadState(CheckpointReader& reader);
 
  protected:
   const CelestialInformation* celes_info_;  //!< Celestial information
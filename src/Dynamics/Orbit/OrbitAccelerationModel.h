@@ -0,0 +1,35 @@
+/**
+ * @file OrbitAccelerationModel.h
+ * @brief Interface of the acceleration model evaluated in each stage of the orbit integration
+ */
+#ifndef __orbit_acceleration_model_H__
+#define __orbit_acceleration_model_H__
+
+#include <Library/math/Vector.hpp>
+
+/**
+ * @class OrbitAccelerationModel
+ * @brief Interface of the acceleration model evaluated in each stage of the orbit integration
+ * @details The orbit propagator calls CalcAcceleration_i with the position and velocity of each stage instead of holding the acceleration of the
+ * update time constant over the update interval.
+ */
+class OrbitAccelerationModel {
+ public:
+  /**
+   * @fn ~OrbitAccelerationModel
+   * @brief Destructor
+   */
+  virtual ~OrbitAccelerationModel() {}
+
+  /**
+   * @fn CalcAcceleration_i
+   * @brief Calculate the acceleration at the state of an integration stage
+   * @param [in] time_s: Elapsed time of the stage [sec]
+   * @param [in] position_i: Spacecraft position in the inertial frame [m]
+   * @param [in] velocity_i: Spacecraft velocity in the inertial frame [m/s]
+   * @return Acceleration in the inertial frame [m/s2]
+   */
+  virtual libra::Vector<3> CalcAcceleration_i(const double time_s, const libra::Vector<3>& position_i, const libra::Vector<3>& velocity_i) = 0;
+};
+
+#endif  //__orbit_acceleration_model_H__
@@ -115,14 +115,19 @@ void RelativeOrbit::Propagate(double endtime, double current_jd) {
 }
 
 void RelativeOrbit::PropagateRK4(double elapsed_sec) {
-  setStepWidth(prop_step_);  // Re-set propagation dt
-  while (elapsed_sec - prop_time_ - prop_step_ > 1.0e-6) {
-    Update();  // Propagation methods of the ODE class
-    prop_time_ += prop_step_;
+  if (method() == libra::OdeMethod::kDormandPrince54) {
+    Integrate(elapsed_sec);  // The step width is controlled by the ODE class
+    prop_time_ = elapsed_sec;
+  } else {
+    setStepWidth(prop_step_);  // Re-set propagation dt
+    while (elapsed_sec - prop_time_ - prop_step_ > 1.0e-6) {
+      Update();  // Propagation methods of the ODE class
+      prop_time_ += prop_step_;
+    }
+    setStepWidth(elapsed_sec - prop_time_);  // Adjust the last propagation dt
+    Update();
+    prop_time_ = elapsed_sec;
   }
-  setStepWidth(elapsed_sec - prop_time_);  // Adjust the last propagation dt
-  Update();
-  prop_time_ = elapsed_sec;
 
   relative_position_lvlh_[0] = state()[0];
   relative_position_lvlh_[1] = state()[1];
@@ -151,34 +156,50 @@ void RelativeOrbit::RHS(double t, const Vector<6>& state, Vector<6>& rhs)  // on
   (void)t;
 }
 
-std::string RelativeOrbit::GetLogHeader() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector("sat_position", "i", "m", 3);
-  str_tmp += WriteVector("sat_velocity", "i", "m/s", 3);
-  str_tmp += WriteVector("sat_velocity", "b", "m/s", 3);
-  str_tmp += WriteVector("sat_position_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3);
-  str_tmp += WriteVector("sat_velocity_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3);
-  str_tmp += WriteVector("sat_acc_i", "i", "m/s^2", 3);
-  str_tmp += WriteScalar("lat", "rad");
-  str_tmp += WriteScalar("lon", "rad");
-  str_tmp += WriteScalar("alt", "m");
-
-  return str_tmp;
+void RelativeOrbit::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddVector("sat_position", "i", "m", 3, 16);
+  channels.AddVector("sat_velocity", "i", "m/s", 3, 10);
+  channels.AddVector("sat_velocity", "b", "m/s", 3, 10);
+  channels.AddVector("sat_position_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3, 10);
+  channels.AddVector("sat_velocity_relative_to_sat" + std::to_string(reference_sat_id_), "LVLH", "m", 3, 10);
+  channels.AddVector("sat_acc_i", "i", "m/s^2", 3, 10);
+  channels.AddScalar("lat", "rad");
+  channels.AddScalar("lon", "rad");
+  channels.AddScalar("alt", "m");
 }
 
-std::string RelativeOrbit::GetLogValue() const {
-  std::string str_tmp = "";
+void RelativeOrbit::WriteLogValues(LogValueSpan& values) const {
+  values.Write(sat_position_i_);
+  values.Write(sat_velocity_i_);
+  values.Write(sat_velocity_b_);
+  values.Write(relative_position_lvlh_);
+  values.Write(relative_velocity_lvlh_);
+  values.Write(acc_i_);
+  values.Write(sat_position_geo_.GetLat_rad());
+  values.Write(sat_position_geo_.GetLon_rad());
+  values.Write(sat_position_geo_.GetAlt_m());
+}
 
-  str_tmp += WriteVector(sat_position_i_, 16);
-  str_tmp += WriteVector(sat_velocity_i_, 10);
-  str_tmp += WriteVector(sat_velocity_b_, 10);
-  str_tmp += WriteVector(relative_position_lvlh_, 10);
-  str_tmp += WriteVector(relative_velocity_lvlh_, 10);
-  str_tmp += WriteVector(acc_i_, 10);
-  str_tmp += WriteScalar(sat_position_geo_.GetLat_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetLon_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetAlt_m());
+void RelativeOrbit::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  writer.WriteSection("RelativeOrbit");
+  libra::ODE<6>::SaveState(writer);
+  writer.Write(prop_time_);
+  writer.Write(system_matrix_);
+  writer.Write(stm_);
+  writer.Write(initial_state_);
+  writer.Write(relative_position_lvlh_);
+  writer.Write(relative_velocity_lvlh_);
+}
 
-  return str_tmp;
+void RelativeOrbit::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  if (!reader.ReadSection("RelativeOrbit")) return;
+  libra::ODE<6>::LoadState(reader);
+  reader.Read(prop_time_);
+  reader.Read(system_matrix_);
+  reader.Read(stm_);
+  reader.Read(initial_state_);
+  reader.Read(relative_position_lvlh_);
+  reader.Read(relative_velocity_lvlh_);
 }
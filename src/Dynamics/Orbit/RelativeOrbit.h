@@ -53,6 +53,11 @@ class RelativeOrbit : public Orbit, public libra::ODE<6> {
    * @param [in] current_jd: Current Julian day [day]
    */
   virtual void Propagate(double endtime, double current_jd);
+  /**
+   * @fn GetReferenceSatId
+   * @brief Return the ID of the reference spacecraft
+   */
+  inline virtual int GetReferenceSatId() const { return reference_sat_id_; }
 
   // Override ODE
   /**
@@ -64,17 +69,29 @@ class RelativeOrbit : public Orbit, public libra::ODE<6> {
    */
   virtual void RHS(double t, const Vector<6>& state, Vector<6>& rhs);
 
-  // Override ILoggable
+  // Override ITypedLoggable
+  /**
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
+   */
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
+  /**
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
+   */
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  // Override ICheckpointable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn SaveState
+   * @brief Write the states of the orbit and the relative motion
    */
-  virtual std::string GetLogHeader() const;
+  virtual void SaveState(CheckpointWriter& writer) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LoadState
+   * @brief Read the states written by SaveState
    */
-  virtual std::string GetLogValue() const;
+  virtual void LoadState(CheckpointReader& reader);
 
  private:
   double mu_;             //!< Gravity constant of the center body [m3/s2]
@@ -122,7 +139,7 @@ class RelativeOrbit : public Orbit, public libra::ODE<6> {
   void CalculateSTM(STMModel stm_model_type, const Orbit* reference_sat_orbit, double mu, double elapsed_sec);
   /**
    * @fn PropagateRK4
-   * @brief Propagate relative orbit with RK4
+   * @brief Propagate relative orbit with RK4, or with the adaptive step width after setAdaptiveStep
    * @param [in] elapsed_sec: Elapsed time [sec]
    */
   void PropagateRK4(double elapsed_sec);
@@ -30,14 +30,28 @@ void Rk4OrbitPropagation::RHS(double t, const Vector<N>& state, Vector<N>& rhs)
 
   double r3 = pow(x * x + y * y + z * z, 1.5);
 
+  // The acceleration of the model is evaluated at the state of each stage
+  Vector<3> acc_i = acc_i_;
+  if (acceleration_model_ != nullptr) {
+    Vector<3> position_i, velocity_i;
+    for (int i = 0; i < 3; i++) {
+      position_i[i] = state[i];
+      velocity_i[i] = state[i + 3];
+    }
+    acc_i += acceleration_model_->CalcAcceleration_i(t, position_i, velocity_i);
+  }
+
   rhs[0] = vx;
   rhs[1] = vy;
   rhs[2] = vz;
-  rhs[3] = acc_i_[0] - mu / r3 * x;
-  rhs[4] = acc_i_[1] - mu / r3 * y;
-  rhs[5] = acc_i_[2] - mu / r3 * z;
+  rhs[3] = acc_i[0] - mu / r3 * x;
+  rhs[4] = acc_i[1] - mu / r3 * y;
+  rhs[5] = acc_i[2] - mu / r3 * z;
+}
 
-  (void)t;
+void Rk4OrbitPropagation::SetAccelerationModel(OrbitAccelerationModel* acceleration_model) {
+  if (!is_stage_acceleration_enabled_) return;
+  acceleration_model_ = acceleration_model;
 }
 
 void Rk4OrbitPropagation::Initialize(Vector<3> init_position, Vector<3> init_velocity, double init_time) {
@@ -69,14 +83,19 @@ void Rk4OrbitPropagation::Propagate(double endtime, double current_jd) {
 
   if (!is_calc_enabled_) return;
 
-  setStepWidth(prop_step_);  // Re-set propagation Δt
-  while (endtime - prop_time_ - prop_step_ > 1.0e-6) {
-    Update();  // Propagation methods of the ODE class
-    prop_time_ += prop_step_;
+  if (method() == libra::OdeMethod::kDormandPrince54) {
+    Integrate(endtime);  // The step width is controlled by the ODE class
+    prop_time_ = endtime;
+  } else {
+    setStepWidth(prop_step_);  // Re-set propagation Δt
+    while (endtime - prop_time_ - prop_step_ > 1.0e-6) {
+      Update();  // Propagation methods of the ODE class
+      prop_time_ += prop_step_;
+    }
+    setStepWidth(endtime - prop_time_);  // Adjust the last propagation Δt
+    Update();
+    prop_time_ = endtime;
   }
-  setStepWidth(endtime - prop_time_);  // Adjust the last propagation Δt
-  Update();
-  prop_time_ = endtime;
 
   sat_position_i_[0] = state()[0];
   sat_position_i_[1] = state()[1];
@@ -100,30 +119,36 @@ void Rk4OrbitPropagation::AddPositionOffset(Vector<3> offset_i) {
   sat_position_i_[2] = state()[2];
 }
 
-string Rk4OrbitPropagation::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector("sat_position", "i", "m", 3);
-  str_tmp += WriteVector("sat_velocity", "i", "m/s", 3);
-  str_tmp += WriteVector("sat_velocity", "b", "m/s", 3);
-  str_tmp += WriteVector("sat_acc_i", "i", "m/s^2", 3);
-  str_tmp += WriteScalar("lat", "rad");
-  str_tmp += WriteScalar("lon", "rad");
-  str_tmp += WriteScalar("alt", "m");
-
-  return str_tmp;
+void Rk4OrbitPropagation::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddVector("sat_position", "i", "m", 3, 16);
+  channels.AddVector("sat_velocity", "i", "m/s", 3, 10);
+  channels.AddVector("sat_velocity", "b", "m/s", 3, 10);
+  channels.AddVector("sat_acc_i", "i", "m/s^2", 3, 10);
+  channels.AddScalar("lat", "rad");
+  channels.AddScalar("lon", "rad");
+  channels.AddScalar("alt", "m");
 }
 
-string Rk4OrbitPropagation::GetLogValue() const {
-  string str_tmp = "";
+void Rk4OrbitPropagation::WriteLogValues(LogValueSpan& values) const {
+  values.Write(sat_position_i_);
+  values.Write(sat_velocity_i_);
+  values.Write(sat_velocity_b_);
+  values.Write(acc_i_);
+  values.Write(sat_position_geo_.GetLat_rad());
+  values.Write(sat_position_geo_.GetLon_rad());
+  values.Write(sat_position_geo_.GetAlt_m());
+}
 
-  str_tmp += WriteVector(sat_position_i_, 16);
-  str_tmp += WriteVector(sat_velocity_i_, 10);
-  str_tmp += WriteVector(sat_velocity_b_, 10);
-  str_tmp += WriteVector(acc_i_, 10);
-  str_tmp += WriteScalar(sat_position_geo_.GetLat_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetLon_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetAlt_m());
+void Rk4OrbitPropagation::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  writer.WriteSection("Rk4OrbitPropagation");
+  libra::ODE<N>::SaveState(writer);
+  writer.Write(prop_time_);
+}
 
-  return str_tmp;
+void Rk4OrbitPropagation::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  if (!reader.ReadSection("Rk4OrbitPropagation")) return;
+  libra::ODE<N>::LoadState(reader);
+  reader.Read(prop_time_);
 }
@@ -62,23 +62,56 @@ class Rk4OrbitPropagation : public Orbit, public libra::ODE<6> {
    * @param [in] offset_i: Offset vector in the inertial frame [m]
    */
   virtual void AddPositionOffset(Vector<3> offset_i);
+  /**
+   * @fn SetAccelerationModel
+   * @brief Set the acceleration model evaluated in each stage of RK4 when it is enabled by SetIsStageAccelerationEnabled
+   * @param [in] acceleration_model: Acceleration model
+   */
+  virtual void SetAccelerationModel(OrbitAccelerationModel* acceleration_model);
+  /**
+   * @fn GetIsAccelerationModelUsed
+   * @brief Return true when the acceleration model is evaluated in each stage of RK4
+   */
+  inline virtual bool GetIsAccelerationModelUsed() const { return acceleration_model_ != nullptr; }
+
+  /**
+   * @fn SetIsStageAccelerationEnabled
+   * @brief Enable the evaluation of the acceleration model in each stage of RK4
+   * @note Call this before SetAccelerationModel
+   */
+  inline void SetIsStageAccelerationEnabled(const bool is_enabled) { is_stage_acceleration_enabled_ = is_enabled; }
 
-  // Override ILoggable
+  // Override ITypedLoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the orbit and the integration
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
  private:
   double prop_time_;  //!< Simulation current time for numerical integration by RK4 [sec]
   double prop_step_;  //!< Step width for RK4 [sec]
 
+  bool is_stage_acceleration_enabled_ = false;            //!< Flag to evaluate the acceleration model in each stage
+  OrbitAccelerationModel* acceleration_model_ = nullptr;  //!< Acceleration model evaluated in each stage
+
   /**
    * @fn Initialize
    * @brief Initialize function
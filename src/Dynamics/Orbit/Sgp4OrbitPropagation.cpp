@@ -58,32 +58,24 @@ void Sgp4OrbitPropagation::Propagate(double endtime, double current_jd) {
   TransEcefToGeo();
 }
 
-string Sgp4OrbitPropagation::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector("sat_position", "i", "m", 3);
-  str_tmp += WriteVector("sat_velocity", "i", "m/s", 3);
-  str_tmp += WriteVector("sat_velocity", "b", "m/s", 3);
-  str_tmp += WriteVector("sat_acc_i", "i", "m/s^2", 3);
-  str_tmp += WriteScalar("lat", "rad");
-  str_tmp += WriteScalar("lon", "rad");
-  str_tmp += WriteScalar("alt", "m");
-
-  return str_tmp;
+void Sgp4OrbitPropagation::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddVector("sat_position", "i", "m", 3, 16);
+  channels.AddVector("sat_velocity", "i", "m/s", 3, 10);
+  channels.AddVector("sat_velocity", "b", "m/s", 3, 10);
+  channels.AddVector("sat_acc_i", "i", "m/s^2", 3, 10);
+  channels.AddScalar("lat", "rad");
+  channels.AddScalar("lon", "rad");
+  channels.AddScalar("alt", "m");
 }
 
-string Sgp4OrbitPropagation::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteVector(sat_position_i_, 16);
-  str_tmp += WriteVector(sat_velocity_i_, 10);
-  str_tmp += WriteVector(sat_velocity_b_, 10);
-  str_tmp += WriteVector(acc_i_, 10);
-  str_tmp += WriteScalar(sat_position_geo_.GetLat_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetLon_rad());
-  str_tmp += WriteScalar(sat_position_geo_.GetAlt_m());
-
-  return str_tmp;
+void Sgp4OrbitPropagation::WriteLogValues(LogValueSpan& values) const {
+  values.Write(sat_position_i_);
+  values.Write(sat_velocity_i_);
+  values.Write(sat_velocity_b_);
+  values.Write(acc_i_);
+  values.Write(sat_position_geo_.GetLat_rad());
+  values.Write(sat_position_geo_.GetLon_rad());
+  values.Write(sat_position_geo_.GetAlt_m());
 }
 
 Vector<3> Sgp4OrbitPropagation::GetESIOmega() {
@@ -116,3 +108,15 @@ Vector<3> Sgp4OrbitPropagation::GetESIOmega() {
 
   return PERI2ECI * omega_peri;
 }
+
+void Sgp4OrbitPropagation::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  writer.WriteSection("Sgp4OrbitPropagation");
+  writer.Write(satrec_);
+}
+
+void Sgp4OrbitPropagation::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  if (!reader.ReadSection("Sgp4OrbitPropagation")) return;
+  reader.Read(satrec_);
+}
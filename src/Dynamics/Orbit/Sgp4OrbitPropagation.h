@@ -42,17 +42,29 @@ class Sgp4OrbitPropagation : public Orbit {
    */
   Vector<3> GetESIOmega();
 
-  // Override ILoggable
+  // Override ITypedLoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the orbit and the SGP4 record
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
  private:
   gravconsttype whichconst_;                //!< Gravity constant value type
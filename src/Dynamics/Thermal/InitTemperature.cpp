@@ -3,6 +3,7 @@
 #include <Environment/Global/SimTime.h>
 #include <Interface/InitInput/IniAccess.h>
 
+#include <iostream>
 #include <string>
 
 #include "InitNode.hpp"
@@ -64,6 +65,15 @@ Temperature* InitTemperature(const std::string ini_path, const double rk_prop_st
   // read ini-file settings
   string file_path = mainIni.ReadString("Thermal", "thrm_file");
   bool debug = mainIni.ReadBoolean("Thermal", "debug");
+  string integration_method_str = mainIni.ReadString("Thermal", "integration_method");
+  ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRk4;
+  // RK4 is used silently when the key is not given: ReadString returns "NULL" for a missing key (empty on Windows)
+  const bool is_integration_method_given = !integration_method_str.empty() && integration_method_str != "NULL";
+  if (integration_method_str == "ROSENBROCK") {
+    integration_method = ThermalIntegrationMethod::kRosenbrock;
+  } else if (is_integration_method_given && integration_method_str != "RK4") {
+    std::cerr << "Unknown thermal integration method: " << integration_method_str << ". RK4 is used." << std::endl;
+  }
 
   // Read Node Properties from CSV File
   string filepath_node = file_path + "Node.csv";
@@ -88,6 +98,6 @@ Temperature* InitTemperature(const std::string ini_path, const double rk_prop_st
   conf_rij.ReadCsvDouble(rij, nodes_num + 1);
 
   Temperature* temperature;
-  temperature = new Temperature(cij, rij, vnodes, nodes_num, rk_prop_step_sec, is_calc_enabled, debug);
+  temperature = new Temperature(cij, rij, vnodes, nodes_num, rk_prop_step_sec, is_calc_enabled, debug, integration_method);
   return temperature;
 }
@@ -82,3 +82,15 @@ void Node::PrintParam(void) {
   }
   cout << endl;
 }
+
+void Node::SaveState(CheckpointWriter& writer) const {
+  writer.Write(temperature_);
+  writer.Write(internal_heat_);
+  writer.Write(solar_radiation_);
+}
+
+void Node::LoadState(CheckpointReader& reader) {
+  reader.Read(temperature_);
+  reader.Read(internal_heat_);
+  reader.Read(solar_radiation_);
+}
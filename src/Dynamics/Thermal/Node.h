@@ -4,6 +4,7 @@
 #define __node_H__
 
 #include <Interface/LogOutput/Logger.h>
+#include <Library/utils/Checkpoint.hpp>
 
 #include <string>
 #include <vector>
@@ -45,6 +46,10 @@ class Node {
   void SetTemperature_K(double temp_K);
   void SetInternalHeat(double heat_power);  //内部発熱を計算
 
+  // Checkpoint
+  void SaveState(CheckpointWriter& writer) const;  // Write the temperature, the internal heat, and the solar radiation
+  void LoadState(CheckpointReader& reader);        // Read the states written by SaveState
+
   // for debug
   void PrintParam(void);
 };
@@ -1,22 +1,61 @@
 #include "Temperature.h"
 
 #include <Library/utils/Macros.hpp>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <queue>
 #include <vector>
 
 using namespace std;
 
+// Convert the dense matrix to the CSR format
+static ThermalCoupling MakeThermalCoupling(const vector<vector<double>>& dense) {
+  ThermalCoupling coupling;
+  coupling.row_offsets.push_back(0);
+  for (const auto& row : dense) {
+    for (size_t j = 0; j < row.size(); j++) {
+      if (row[j] == 0.0) continue;
+      coupling.columns.push_back(j);
+      coupling.values.push_back(row[j]);
+    }
+    coupling.row_offsets.push_back(coupling.columns.size());
+  }
+  return coupling;
+}
+
+// Return the element (i, j) of the CSR matrix
+static double GetThermalCoupling(const ThermalCoupling& coupling, const int i, const int j) {
+  if (i + 1 >= (int)coupling.row_offsets.size()) return 0.0;
+  for (int k = coupling.row_offsets[i]; k < coupling.row_offsets[i + 1]; k++) {
+    if (coupling.columns[k] == j) return coupling.values[k];
+  }
+  return 0.0;
+}
+
 Temperature::Temperature(const vector<vector<double>> cij, const vector<vector<double>> rij, vector<Node> vnodes, const int node_num,
-                         const double propstep, const bool is_calc_enabled, const bool debug)
-    : cij_(cij),
-      rij_(rij),
+                         const double propstep, const bool is_calc_enabled, const bool debug, const ThermalIntegrationMethod integration_method)
+    : cij_(MakeThermalCoupling(cij)),
+      rij_(MakeThermalCoupling(rij)),
       vnodes_(vnodes),
       node_num_(node_num),
       prop_step_(propstep),  // ルンゲクッタ積分時間刻み幅
       is_calc_enabled_(is_calc_enabled),
-      debug_(debug) {
+      debug_(debug),
+      integration_method_(integration_method),
+      x_(node_num),
+      xk_(node_num),
+      k1_(node_num),
+      k2_(node_num),
+      k3_(node_num),
+      k4_(node_num),
+      temperature_(node_num),
+      temperature4_(node_num),
+      bandwidth_(0) {
   prop_time_ = 0;
+  if (integration_method_ == ThermalIntegrationMethod::kRosenbrock) {
+    PrepareBandSolver();
+  }
   if (debug_) {
     PrintParams();
   }
@@ -27,17 +66,27 @@ Temperature::Temperature() {
   prop_step_ = 0.0;
   is_calc_enabled_ = false;
   debug_ = false;
+  integration_method_ = ThermalIntegrationMethod::kRk4;
+  bandwidth_ = 0;
 }
 
 Temperature::~Temperature() {}
 
 void Temperature::Propagate(Vector<3> sun_direction, const double endtime) {
   if (!is_calc_enabled_) return;
-  while (endtime - prop_time_ - prop_step_ > 1.0e-6) {
-    RungeOneStep(prop_time_, prop_step_, sun_direction, node_num_);
-    prop_time_ += prop_step_;
+  if (integration_method_ == ThermalIntegrationMethod::kRosenbrock) {
+    while (endtime - prop_time_ - prop_step_ > 1.0e-6) {
+      RosenbrockOneStep(prop_step_, sun_direction, node_num_);
+      prop_time_ += prop_step_;
+    }
+    RosenbrockOneStep(endtime - prop_time_, sun_direction, node_num_);
+  } else {
+    while (endtime - prop_time_ - prop_step_ > 1.0e-6) {
+      RungeOneStep(prop_time_, prop_step_, sun_direction, node_num_);
+      prop_time_ += prop_step_;
+    }
+    RungeOneStep(prop_time_, endtime - prop_time_, sun_direction, node_num_);
   }
-  RungeOneStep(prop_time_, endtime - prop_time_, sun_direction, node_num_);
   prop_time_ = endtime;
 
   if (debug_) {
@@ -60,61 +109,219 @@ void Temperature::Propagate(Vector<3> sun_direction, const double endtime) {
 }
 
 void Temperature::RungeOneStep(double t, double dt, Vector<3> sun_direction, int node_num) {
-  vector<double> x(node_num);
   for (int i = 0; i < node_num; i++) {
-    x[i] = vnodes_[i].GetTemperature_K();
+    x_[i] = vnodes_[i].GetTemperature_K();
+  }
+
+  OdeTemperature(x_, t, sun_direction, node_num, k1_);
+  for (int i = 0; i < node_num; i++) {
+    xk_[i] = x_[i] + (dt / 2.0) * k1_[i];
   }
 
-  vector<double> k1(node_num), k2(node_num), k3(node_num), k4(node_num);
-  vector<double> xk2(node_num), xk3(node_num), xk4(node_num);
+  OdeTemperature(xk_, (t + dt / 2.0), sun_direction, node_num, k2_);
+  for (int i = 0; i < node_num; i++) {
+    xk_[i] = x_[i] + (dt / 2.0) * k2_[i];
+  }
 
-  k1 = OdeTemperature(x, t, sun_direction, node_num);
+  OdeTemperature(xk_, (t + dt / 2.0), sun_direction, node_num, k3_);
   for (int i = 0; i < node_num; i++) {
-    xk2[i] = x[i] + (dt / 2.0) * k1[i];
+    xk_[i] = x_[i] + dt * k3_[i];
   }
 
-  k2 = OdeTemperature(xk2, (t + dt / 2.0), sun_direction, node_num);
+  OdeTemperature(xk_, (t + dt), sun_direction, node_num, k4_);
+
   for (int i = 0; i < node_num; i++) {
-    xk3[i] = x[i] + (dt / 2.0) * k2[i];
+    double next_x = x_[i] + (dt / 6.0) * (k1_[i] + 2.0 * k2_[i] + 2.0 * k3_[i] + k4_[i]);  // temperature at next step
+    vnodes_[i].SetTemperature_K(next_x);
   }
+}
+
+// ROS2 method (Verwer et al., SIAM J. Sci. Comput. 20(4), 1999). It is L-stable, so the step can be much larger than the time constant of the
+// small nodes. Only one LU factorization is needed in a step.
+void Temperature::RosenbrockOneStep(double dt, const Vector<3>& sun_direction, int node_num) {
+  if (dt <= 0.0) return;
+  const double gamma = 1.0 + 1.0 / sqrt(2.0);
 
-  k3 = OdeTemperature(xk3, (t + dt / 2.0), sun_direction, node_num);
   for (int i = 0; i < node_num; i++) {
-    xk4[i] = x[i] + dt * k3[i];
+    x_[i] = vnodes_[i].GetTemperature_K();
   }
+  FactorizeJacobian(x_, gamma * dt, node_num);
 
-  k4 = OdeTemperature(xk4, (t + dt), sun_direction, node_num);
+  // (I - gamma dt J) k1 = f(x)
+  CalcDerivative(x_, sun_direction, node_num, k1_);
+  SolveJacobian(k1_, node_num);
 
-  vector<double> next_x(node_num);  // temperature at next step
+  // (I - gamma dt J) k2 = f(x + dt k1) - 2 k1
+  for (int i = 0; i < node_num; i++) {
+    xk_[i] = x_[i] + dt * k1_[i];
+  }
+  CalcDerivative(xk_, sun_direction, node_num, k2_);
   for (int i = 0; i < node_num; i++) {
-    next_x[i] = x[i] + (dt / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    k2_[i] -= 2.0 * k1_[i];
   }
+  SolveJacobian(k2_, node_num);
 
   for (int i = 0; i < node_num; i++) {
-    vnodes_[i].SetTemperature_K(next_x[i]);
+    double next_x = x_[i] + dt * (1.5 * k1_[i] + 0.5 * k2_[i]);  // temperature at next step
+    vnodes_[i].SetTemperature_K(next_x);
   }
 }
 
-vector<double> Temperature::OdeTemperature(vector<double> x, double t, Vector<3> sun_direction, int node_num) {
+void Temperature::OdeTemperature(const vector<double>& x, double t, const Vector<3>& sun_direction, int node_num, vector<double>& dTdt) {
   // TODO: consider the following unused arguments are really needed
   UNUSED(x);
   UNUSED(t);
 
-  vector<double> dTdt(node_num);
+  for (int i = 0; i < node_num; i++) {
+    temperature_[i] = vnodes_[i].GetTemperature_K();
+  }
+  CalcDerivative(temperature_, sun_direction, node_num, dTdt);
+}
+
+void Temperature::CalcDerivative(const vector<double>& x, const Vector<3>& sun_direction, int node_num, vector<double>& dTdt) {
+  double const sigma = 5.67E-8;  // Stefan-Boltzmann Constant
+  for (int i = 0; i < node_num; i++) {
+    temperature4_[i] = pow(x[i], 4);
+  }
+
+  // Only the nonzero couplings between the nodes are summed. The columns are ascending, so the summation order is the same as the dense matrix.
   for (int i = 0; i < node_num; i++) {
     double solar = vnodes_[i].CalcSolarRadiation(sun_direction);  // solar radiation[W]
     double internal = vnodes_[i].GetInternalHeat();               // internal(generated) heat[W]
 
-    double coupling_heat = 0;      // Coupling of node i and j by heat transfer
-    double radiation_heat = 0;     // Coupling of node i and j by thermal radiation
-    double const sigma = 5.67E-8;  // Stefan-Boltzmann Constant
-    for (int j = 0; j < node_num; j++) {
-      coupling_heat += cij_[i][j] * (vnodes_[j].GetTemperature_K() - vnodes_[i].GetTemperature_K());
-      radiation_heat += sigma * rij_[i][j] * (pow(vnodes_[j].GetTemperature_K(), 4) - pow(vnodes_[i].GetTemperature_K(), 4));
+    double coupling_heat = 0;   // Coupling of node i and j by heat transfer
+    double radiation_heat = 0;  // Coupling of node i and j by thermal radiation
+    for (int k = cij_.row_offsets[i]; k < cij_.row_offsets[i + 1]; k++) {
+      const int j = cij_.columns[k];
+      if (j >= node_num) break;
+      coupling_heat += cij_.values[k] * (x[j] - x[i]);
+    }
+    for (int k = rij_.row_offsets[i]; k < rij_.row_offsets[i + 1]; k++) {
+      const int j = rij_.columns[k];
+      if (j >= node_num) break;
+      radiation_heat += sigma * rij_.values[k] * (temperature4_[j] - temperature4_[i]);
     }
     dTdt[i] = (coupling_heat + radiation_heat + solar + internal) / vnodes_[i].GetCapacity();
   }
-  return dTdt;
+}
+
+void Temperature::PrepareBandSolver() {
+  const int n = node_num_;
+
+  // Symmetric adjacency of the nodes coupled by conduction or radiation
+  vector<vector<int>> adjacency(n);
+  for (const ThermalCoupling* coupling : {&cij_, &rij_}) {
+    for (int i = 0; i < n && i + 1 < (int)coupling->row_offsets.size(); i++) {
+      for (int k = coupling->row_offsets[i]; k < coupling->row_offsets[i + 1]; k++) {
+        const int j = coupling->columns[k];
+        if (j >= n || j == i) continue;
+        adjacency[i].push_back(j);
+        adjacency[j].push_back(i);
+      }
+    }
+  }
+  for (auto& neighbors : adjacency) {
+    sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
+  }
+
+  // Cuthill-McKee order: breadth first search from the node with the minimum degree, visiting the neighbors in the ascending order of degree
+  band_order_.clear();
+  vector<bool> is_visited(n, false);
+  while ((int)band_order_.size() < n) {
+    int start = -1;
+    for (int i = 0; i < n; i++) {
+      if (!is_visited[i] && (start < 0 || adjacency[i].size() < adjacency[start].size())) start = i;
+    }
+    queue<int> bfs_queue;
+    bfs_queue.push(start);
+    is_visited[start] = true;
+    while (!bfs_queue.empty()) {
+      const int i = bfs_queue.front();
+      bfs_queue.pop();
+      band_order_.push_back(i);
+      vector<int> neighbors;
+      for (int j : adjacency[i]) {
+        if (!is_visited[j]) neighbors.push_back(j);
+      }
+      stable_sort(neighbors.begin(), neighbors.end(), [&](int a, int b) { return adjacency[a].size() < adjacency[b].size(); });
+      for (int j : neighbors) {
+        is_visited[j] = true;
+        bfs_queue.push(j);
+      }
+    }
+  }
+  reverse(band_order_.begin(), band_order_.end());
+
+  band_position_.assign(n, 0);
+  for (int r = 0; r < n; r++) band_position_[band_order_[r]] = r;
+  bandwidth_ = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j : adjacency[i]) bandwidth_ = max(bandwidth_, abs(band_position_[i] - band_position_[j]));
+  }
+
+  band_matrix_.assign(n * (2 * bandwidth_ + 1), 0.0);
+  band_vector_.assign(n, 0.0);
+}
+
+void Temperature::FactorizeJacobian(const vector<double>& x, double gamma_dt, int node_num) {
+  double const sigma = 5.67E-8;  // Stefan-Boltzmann Constant
+  const int width = 2 * bandwidth_ + 1;
+  fill(band_matrix_.begin(), band_matrix_.end(), 0.0);
+
+  // J_ij = (c_ij + 4 sigma r_ij T_j^3) / C_i, J_ii = -(sum c_ij + 4 sigma T_i^3 sum r_ij) / C_i
+  for (int i = 0; i < node_num; i++) {
+    const int r = band_position_[i];
+    const double coef = gamma_dt / vnodes_[i].GetCapacity();
+    double* row = &band_matrix_[r * width + bandwidth_ - r];  // row[c] is the element of the column c
+    row[r] += 1.0;
+    for (int k = cij_.row_offsets[i]; k < cij_.row_offsets[i + 1]; k++) {
+      const int j = cij_.columns[k];
+      if (j >= node_num) break;
+      if (j == i) continue;
+      row[band_position_[j]] -= coef * cij_.values[k];
+      row[r] += coef * cij_.values[k];
+    }
+    for (int k = rij_.row_offsets[i]; k < rij_.row_offsets[i + 1]; k++) {
+      const int j = rij_.columns[k];
+      if (j >= node_num) break;
+      if (j == i) continue;
+      row[band_position_[j]] -= coef * 4.0 * sigma * rij_.values[k] * pow(x[j], 3);
+      row[r] += coef * 4.0 * sigma * rij_.values[k] * pow(x[i], 3);
+    }
+  }
+
+  // LU factorization without pivoting. The matrix is diagonally dominant in the usual thermal networks.
+  for (int k = 0; k < node_num; k++) {
+    const double* row_k = &band_matrix_[k * width + bandwidth_ - k];
+    const int last = min(node_num - 1, k + bandwidth_);
+    for (int i = k + 1; i <= last; i++) {
+      double* row_i = &band_matrix_[i * width + bandwidth_ - i];
+      if (row_i[k] == 0.0) continue;
+      row_i[k] /= row_k[k];
+      for (int j = k + 1; j <= last; j++) row_i[j] -= row_i[k] * row_k[j];
+    }
+  }
+}
+
+void Temperature::SolveJacobian(vector<double>& b, int node_num) {
+  const int width = 2 * bandwidth_ + 1;
+  for (int i = 0; i < node_num; i++) band_vector_[band_position_[i]] = b[i];
+
+  // Forward substitution with the unit lower triangular matrix
+  for (int r = 0; r < node_num; r++) {
+    const double* row = &band_matrix_[r * width + bandwidth_ - r];
+    for (int c = max(0, r - bandwidth_); c < r; c++) band_vector_[r] -= row[c] * band_vector_[c];
+  }
+  // Backward substitution with the upper triangular matrix
+  for (int r = node_num - 1; r >= 0; r--) {
+    const double* row = &band_matrix_[r * width + bandwidth_ - r];
+    const int last = min(node_num - 1, r + bandwidth_);
+    for (int c = r + 1; c <= last; c++) band_vector_[r] -= row[c] * band_vector_[c];
+    band_vector_[r] /= row[r];
+  }
+
+  for (int i = 0; i < node_num; i++) b[i] = band_vector_[band_position_[i]];
 }
 
 void Temperature::AddHeaterPower(vector<double> heater_power) {
@@ -166,16 +373,34 @@ void Temperature::PrintParams(void) {
   cout << "Cij:" << endl;
   for (int i = 0; i < (node_num_ + 1); i++) {
     for (int j = 0; j < (node_num_ + 1); j++) {
-      cout << std::setprecision(4) << cij_[i][j] << "  ";
+      cout << std::setprecision(4) << GetThermalCoupling(cij_, i, j) << "  ";
     }
     cout << endl;
   }
   cout << "Rij:" << endl;
   for (int i = 0; i < (node_num_ + 1); i++) {
     for (int j = 0; j < (node_num_ + 1); j++) {
-      cout << std::setprecision(4) << rij_[i][j] << "  ";
+      cout << std::setprecision(4) << GetThermalCoupling(rij_, i, j) << "  ";
     }
     cout << endl;
   }
   cout << "**************************************" << endl;
 }
+
+void Temperature::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("Temperature");
+  writer.Write(prop_time_);
+  writer.Write((uint64_t)vnodes_.size());
+  for (const Node& node : vnodes_) {
+    node.SaveState(writer);
+  }
+}
+
+void Temperature::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("Temperature")) return;
+  reader.Read(prop_time_);
+  if (!reader.ReadSize(vnodes_.size(), "thermal nodes")) return;
+  for (Node& node : vnodes_) {
+    node.LoadState(reader);
+  }
+}
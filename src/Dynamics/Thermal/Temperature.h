@@ -10,24 +10,62 @@
 
 #include "Node.h"
 
-class Temperature : public ILoggable {
+// Coupling matrix in the compressed sparse row (CSR) format. Only the nonzero elements are stored.
+struct ThermalCoupling {
+  std::vector<int> row_offsets;  // Start position of each row in columns and values (size: number of rows + 1)
+  std::vector<int> columns;      // Column index of each element (ascending in each row)
+  std::vector<double> values;    // Value of each element
+};
+
+// Integration method of the thermal network
+enum class ThermalIntegrationMethod {
+  kRk4 = 0,     // 4th order Runge-Kutta method (explicit)
+  kRosenbrock,  // 2nd order L-stable Rosenbrock method (linearly implicit) for stiff networks
+};
+
+class Temperature : public ILoggable, public ICheckpointable {
  protected:
-  std::vector<std::vector<double>> cij_;  // Coupling of node i and node j by heat conduction
-  std::vector<std::vector<double>> rij_;  // Coupling of node i and node j by thermal radiation
-  std::vector<Node> vnodes_;              // vector of nodes
-  int node_num_;                          // number of nodes
-  double prop_step_;                      // 積分刻み幅[sec]
-  double prop_time_;                      // Temperatureクラス内での累積積分時間(end_timeに等しくなるまで積分する)
-  bool is_calc_enabled_;                  // 温度更新をするかどうかのブーリアン
+  ThermalCoupling cij_;       // Coupling of node i and node j by heat conduction
+  ThermalCoupling rij_;       // Coupling of node i and node j by thermal radiation
+  std::vector<Node> vnodes_;  // vector of nodes
+  int node_num_;              // number of nodes
+  double prop_step_;          // 積分刻み幅[sec]
+  double prop_time_;          // Temperatureクラス内での累積積分時間(end_timeに等しくなるまで積分する)
+  bool is_calc_enabled_;      // 温度更新をするかどうかのブーリアン
   bool debug_;
+  ThermalIntegrationMethod integration_method_;  // Integration method
+
+  // Work memory of the integration (allocated at the construction)
+  std::vector<double> x_;                  // temperature at the beginning of the step
+  std::vector<double> xk_;                 // temperature for the next stage
+  std::vector<double> k1_, k2_, k3_, k4_;  // derivatives of the stages
+  std::vector<double> temperature_;        // temperature of each node used in the ODE
+  std::vector<double> temperature4_;       // 4th power of temperature of each node used in the ODE
+
+  // Work memory of the Rosenbrock method. The linear system is solved as a band matrix in the reverse Cuthill-McKee order of the nodes.
+  std::vector<int> band_order_;      // node index of each row of the band matrix
+  std::vector<int> band_position_;   // row of each node in the band matrix
+  int bandwidth_;                    // number of the nonzero elements at each side of the diagonal
+  std::vector<double> band_matrix_;  // I - gamma * dt * Jacobian in the band storage (LU factorized in place)
+  std::vector<double> band_vector_;  // right-hand side and solution in the band order
 
   void RungeOneStep(double t, double dt, Vector<3> sun_direction, int node_num);
-  std::vector<double> OdeTemperature(std::vector<double> x, double t, const Vector<3> sun_direction,
-                                     int node_num);  // 温度に関する常微分方程式, xはnodeの温度をならべたもの
+  void RosenbrockOneStep(double dt, const Vector<3>& sun_direction, int node_num);
+  void OdeTemperature(const std::vector<double>& x, double t, const Vector<3>& sun_direction, int node_num,
+                      std::vector<double>& dTdt);  // 温度に関する常微分方程式, xはnodeの温度をならべたもの
+  // Time derivative of the temperature x
+  void CalcDerivative(const std::vector<double>& x, const Vector<3>& sun_direction, int node_num, std::vector<double>& dTdt);
+  // Decide the band order of the nodes and allocate the band matrix
+  void PrepareBandSolver();
+  // LU factorize I - gamma_dt * J, where J is the Jacobian of the time derivative at x
+  void FactorizeJacobian(const std::vector<double>& x, double gamma_dt, int node_num);
+  // Solve the factorized system. b is overwritten by the solution.
+  void SolveJacobian(std::vector<double>& b, int node_num);
 
  public:
   Temperature(const std::vector<std::vector<double>> cij_, const std::vector<std::vector<double>> rij, std::vector<Node> vnodes, const int node_num,
-              const double propstep, const bool is_calc_enabled, const bool debug);
+              const double propstep, const bool is_calc_enabled, const bool debug,
+              const ThermalIntegrationMethod integration_method);
   Temperature();
   virtual ~Temperature();
   void Propagate(Vector<3> sun_direction,
@@ -37,5 +75,9 @@ class Temperature : public ILoggable {
   std::string GetLogHeader() const;
   std::string GetLogValue() const;
   void PrintParams(void);  //デバッグ出力
+
+  // Override ICheckpointable
+  void SaveState(CheckpointWriter& writer) const;  // Write the propagation time and the states of the nodes
+  void LoadState(CheckpointReader& reader);        // Read the states written by SaveState
 };
 #endif  //__temperature_H__
@@ -0,0 +1,178 @@
+/**
+ * @file BenchClockGenerator.cpp
+ * @brief Comparison of the wall time of the component ticks with the flat scan of all components and the schedule grouped by the prescalers,
+ * and with the serial and the concurrent execution of the components declaring their dependencies
+ * @note The flat scan is the previous implementation of ClockGenerator::TickToComponents.
+ */
+
+#include <Component/Abstract/ComponentBase.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "ClockGenerator.h"
+
+namespace {
+
+using std::vector;
+
+/**
+ * @class DummyComponent
+ * @brief Component which only records the calls of the routines
+ */
+class DummyComponent : public ComponentBase {
+ public:
+  DummyComponent(const int prescaler, ClockGenerator* clock_gen, const int fast_prescaler, const bool needs_fast_update)
+      : ComponentBase(prescaler, clock_gen, fast_prescaler) {
+    SetNeedsFastUpdate(needs_fast_update);
+  }
+
+  uint64_t checksum_ = 0;  //!< Sum of the counts and the order of the calls
+
+ protected:
+  virtual void MainRoutine(int count) { checksum_ = checksum_ * 31 + (uint64_t)count; }
+  virtual void FastUpdate() { checksum_ = checksum_ * 31 + 7; }
+};
+
+/**
+ * @class HeavyComponent
+ * @brief Component which calculates a sequence and reads the result of another component
+ */
+class HeavyComponent : public ComponentBase {
+ public:
+  HeavyComponent(ClockGenerator* clock_gen, const int num_iterations, const HeavyComponent* input, const bool is_declared)
+      : ComponentBase(1, clock_gen), num_iterations_(num_iterations), input_(input), is_declared_(is_declared) {}
+
+  uint64_t checksum_ = 0;  //!< Result of the sequence
+
+  bool DeclareTickDependencies(TickDependencies& dependencies) const override {
+    if (!is_declared_) return false;
+    dependencies.Read(power_port_);
+    if (input_ != nullptr) dependencies.Read(input_);
+    dependencies.Write(this);
+    return true;
+  }
+
+ protected:
+  virtual void MainRoutine(int count) {
+    uint64_t value = checksum_ + (uint64_t)count + ((input_ != nullptr) ? input_->checksum_ : 0);
+    for (int i = 0; i < num_iterations_; i++) value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+    checksum_ = value;
+  }
+
+ private:
+  int num_iterations_;           //!< Number of iterations of the sequence in each tick
+  const HeavyComponent* input_;  //!< Component whose result is read. nullptr for no input.
+  bool is_declared_;             //!< Declare the dependencies
+};
+
+/**
+ * @fn TickFlat
+ * @brief Tick all components as the previous ClockGenerator did
+ */
+void TickFlat(const vector<DummyComponent*>& components, const int count) {
+  for (auto itr = components.begin(); itr != components.end(); ++itr) {
+    (*itr)->Tick(count);
+    if ((*itr)->GetNeedsFastUpdate()) {
+      (*itr)->FastTick(count);
+    }
+  }
+}
+
+/**
+ * @fn Checksum
+ * @brief Combine the checksums of all components in the registration order
+ */
+template <typename T>
+uint64_t Checksum(const vector<T*>& components) {
+  uint64_t checksum = 0;
+  for (auto itr = components.begin(); itr != components.end(); ++itr) {
+    checksum = checksum * 1000003 + (*itr)->checksum_;
+    (*itr)->checksum_ = 0;
+  }
+  return checksum;
+}
+
+/**
+ * @fn BenchmarkThreads
+ * @brief Compare the serial and the concurrent execution of the heavy components
+ * @details Every fourth component reads the result of the previous component, and every tenth component does not declare the dependencies.
+ */
+void BenchmarkThreads() {
+  const int num_ticks = 2000;
+  const int num_components = 40;
+
+  printf("\ncomponents, iterations, threads, time [us/tick], speedup, identical\n");
+  for (const int num_iterations : {1000, 10000}) {
+    double serial_us = 0.0;
+    uint64_t serial_checksum = 0;
+    for (const size_t num_threads : {1, 2, 4}) {
+      ClockGenerator clock_gen;
+      clock_gen.ClearTimerCount();
+      clock_gen.SetNumOfThreads(num_threads);
+      vector<HeavyComponent*> components;
+      for (int i = 0; i < num_components; i++) {
+        const HeavyComponent* input = (i % 4 == 3) ? components.back() : nullptr;
+        components.push_back(new HeavyComponent(&clock_gen, num_iterations, input, i % 10 != 9));
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      for (int count = 0; count < num_ticks; count++) clock_gen.TickToComponents();
+      auto end = std::chrono::steady_clock::now();
+      const double time_us = std::chrono::duration<double, std::micro>(end - start).count() / num_ticks;
+      const uint64_t checksum = Checksum(components);
+      if (num_threads == 1) {
+        serial_us = time_us;
+        serial_checksum = checksum;
+      }
+
+      printf("%d, %d, %zu, %.1f, %.2f, %s\n", num_components, num_iterations, num_threads, time_us, serial_us / time_us,
+             checksum == serial_checksum ? "yes" : "no");
+      for (auto itr = components.begin(); itr != components.end(); ++itr) delete *itr;
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  // Prescalers of the component update period 0.1 sec: 1 (10 Hz) to 100 (0.1 Hz)
+  const int prescalers[] = {1, 2, 5, 10, 10, 10, 20, 50, 100, 100};
+  const int num_ticks = 200000;
+
+  printf("components, fast update ratio, flat [ns/tick], schedule [ns/tick], speedup, identical\n");
+  for (const int num_components : {50, 200, 500}) {
+    for (const double fast_ratio : {0.0, 0.05}) {
+      ClockGenerator clock_gen;
+      clock_gen.ClearTimerCount();
+      vector<DummyComponent*> components;
+      std::mt19937 mt(1);
+      std::uniform_int_distribution<int> prescaler_index(0, sizeof(prescalers) / sizeof(prescalers[0]) - 1);
+      std::uniform_real_distribution<double> uniform(0.0, 1.0);
+      for (int i = 0; i < num_components; i++) {
+        components.push_back(new DummyComponent(prescalers[prescaler_index(mt)], &clock_gen, 1, uniform(mt) < fast_ratio));
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      for (int count = 0; count < num_ticks; count++) TickFlat(components, count);
+      auto end = std::chrono::steady_clock::now();
+      const double flat_ns = std::chrono::duration<double, std::nano>(end - start).count() / num_ticks;
+      const uint64_t flat_checksum = Checksum(components);
+
+      start = std::chrono::steady_clock::now();
+      for (int count = 0; count < num_ticks; count++) clock_gen.TickToComponents();
+      end = std::chrono::steady_clock::now();
+      const double schedule_ns = std::chrono::duration<double, std::nano>(end - start).count() / num_ticks;
+      const uint64_t schedule_checksum = Checksum(components);
+
+      printf("%d, %.2f, %.1f, %.1f, %.2f, %s\n", num_components, fast_ratio, flat_ns, schedule_ns, flat_ns / schedule_ns,
+             flat_checksum == schedule_checksum ? "yes" : "no");
+      for (auto itr = components.begin(); itr != components.end(); ++itr) delete *itr;
+    }
+  }
+
+  BenchmarkThreads();
+  return 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file BenchTleCatalogue.cpp
+ * @brief Throughput of the batch propagation of a TLE catalogue with the serial and the concurrent execution, compared with the propagation of
+ * each object as Sgp4OrbitPropagation does
+ * @note Give the path to a TLE file as the argument to use a real catalogue. A synthetic catalogue of LEO, MEO, GEO, and HEO objects is used
+ * otherwise.
+ */
+
+#include <Library/math/MatVec.hpp>
+#include <Library/sgp4/sgp4io.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "PhysicalConstants.hpp"
+#include "TleCatalogue.h"
+
+namespace {
+
+using std::vector;
+
+/**
+ * @fn WriteSyntheticCatalogue
+ * @brief Write a catalogue of the objects made by changing the elements of a TLE
+ */
+void WriteSyntheticCatalogue(const std::string& file_path, const int num_objects) {
+  std::ofstream ofs(file_path);
+  std::mt19937 mt(1);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  char line[128];
+  for (int i = 0; i < num_objects; i++) {
+    // 80 % LEO, 8 % MEO, 8 % GEO, and 4 % HEO
+    const double orbit_type = uniform(mt);
+    double mean_motion_rev_day = 14.0 + 2.0 * uniform(mt);
+    double eccentricity = 0.02 * uniform(mt);
+    if (orbit_type > 0.96) {
+      mean_motion_rev_day = 2.006;
+      eccentricity = 0.70;
+    } else if (orbit_type > 0.88) {
+      mean_motion_rev_day = 1.0027;
+      eccentricity = 0.001 * uniform(mt);
+    } else if (orbit_type > 0.80) {
+      mean_motion_rev_day = 2.0056;
+    }
+    const int satellite_number = i % 100000;
+    snprintf(line, sizeof(line), "OBJECT %d\n", i);
+    ofs << line;
+    snprintf(line, sizeof(line), "1 %05dU 98067A   20076.51604214  .00016717  00000-0  10270-3 0  9005\n", satellite_number);
+    ofs << line;
+    snprintf(line, sizeof(line), "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%05d0\n", satellite_number, 180.0 * uniform(mt), 360.0 * uniform(mt),
+             (int)(eccentricity * 1.0e7), 360.0 * uniform(mt), 360.0 * uniform(mt), mean_motion_rev_day, 1000);
+    ofs << line;
+  }
+}
+
+/**
+ * @fn ReadLines
+ * @brief Read the pairs of the TLE lines
+ */
+vector<std::string> ReadLines(const std::string& file_path) {
+  std::ifstream ifs(file_path);
+  vector<std::string> lines;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.compare(0, 2, "1 ") == 0 || line.compare(0, 2, "2 ") == 0) lines.push_back(line);
+  }
+  return lines;
+}
+
+/**
+ * @fn IsIdentical
+ * @brief Compare the arrays including the NaN at the same positions
+ */
+bool IsIdentical(const vector<double>& a, const vector<double>& b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (std::isnan(a[i]) != std::isnan(b[i])) return false;
+    if (!std::isnan(a[i]) && a[i] != b[i]) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::string file_path = "BenchTleCatalogue.tle";
+  if (argc > 1) {
+    file_path = argv[1];
+  } else {
+    WriteSyntheticCatalogue(file_path, 30000);
+  }
+  const int num_epochs = 20;
+  const double start_jd = 2458928.0;  // 2020-03-17 12:00:00
+  const double step_day = 0.05;
+  const libra::Matrix<3, 3> dcm_i_to_ecef = libra::rotz(1.0);
+
+  // Propagation of each object as Sgp4OrbitPropagation does
+  const vector<std::string> lines = ReadLines(file_path);
+  vector<elsetrec> records(lines.size() / 2);
+  for (size_t i = 0; i < records.size(); i++) {
+    char longstr1[130];
+    char longstr2[130];
+    strncpy(longstr1, lines[i * 2].c_str(), sizeof(longstr1) - 1);
+    strncpy(longstr2, lines[i * 2 + 1].c_str(), sizeof(longstr2) - 1);
+    longstr1[sizeof(longstr1) - 1] = '\0';
+    longstr2[sizeof(longstr2) - 1] = '\0';
+    double startmfe, stopmfe, deltamin;
+    twoline2rv(longstr1, longstr2, 'c', 0, wgs84, startmfe, stopmfe, deltamin, records[i]);
+  }
+  vector<double> reference_i(records.size() * 3);
+  vector<double> reference_ecef(records.size() * 3);
+  auto start = std::chrono::steady_clock::now();
+  for (int epoch = 0; epoch < num_epochs; epoch++) {
+    const double current_jd = start_jd + epoch * step_day;
+    for (size_t i = 0; i < records.size(); i++) {
+      double r[3];
+      double v[3];
+      sgp4(wgs84, records[i], (current_jd - records[i].jdsatepoch) * (24.0 * 60.0), r, v);
+      libra::Vector<3> position_i;
+      libra::Vector<3> velocity_i;
+      for (size_t axis = 0; axis < 3; axis++) {
+        position_i[axis] = (records[i].error == 0) ? r[axis] * 1000 : std::nan("");
+        velocity_i[axis] = (records[i].error == 0) ? v[axis] * 1000 : std::nan("");
+      }
+      libra::Vector<3> omega_earth{0.0};
+      omega_earth[2] = environment::earth_mean_angular_velocity_rad_s;
+      const libra::Vector<3> velocity_ecef = dcm_i_to_ecef * (velocity_i - outer_product(omega_earth, position_i));
+      for (size_t axis = 0; axis < 3; axis++) {
+        reference_i[i * 3 + axis] = position_i[axis];
+        reference_ecef[i * 3 + axis] = velocity_ecef[axis];
+      }
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  const double num_propagations = (double)records.size() * num_epochs;
+  const double reference_rate = num_propagations / std::chrono::duration<double>(end - start).count();
+
+  printf("objects, epochs, method, threads, load [ms], throughput [objects/s], speedup, identical, errors\n");
+  printf("%zu, %d, each object, 1, -, %.0f, 1.00, -, -\n", records.size(), num_epochs, reference_rate);
+  for (const size_t num_threads : {1, 2, 4}) {
+    TleCatalogue catalogue(wgs84, 0.0, num_threads);
+    start = std::chrono::steady_clock::now();
+    catalogue.ReadContents(file_path);
+    end = std::chrono::steady_clock::now();
+    const double load_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int epoch = 0; epoch < num_epochs; epoch++) catalogue.Propagate(start_jd + epoch * step_day, dcm_i_to_ecef);
+    end = std::chrono::steady_clock::now();
+    const double rate = num_propagations / std::chrono::duration<double>(end - start).count();
+
+    const bool is_identical = IsIdentical(catalogue.GetPositions_i(), reference_i) && IsIdentical(catalogue.GetVelocities_ecef(), reference_ecef);
+    printf("%zu, %d, batch, %zu, %.1f, %.0f, %.2f, %s, %zu\n", catalogue.GetNumOfObjects(), num_epochs, num_threads, load_ms, rate,
+           rate / reference_rate, is_identical ? "yes" : "no", catalogue.GetNumOfErrors());
+  }
+
+  if (argc <= 1) std::remove(file_path.c_str());
+  return 0;
+}
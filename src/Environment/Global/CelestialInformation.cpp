@@ -6,10 +6,13 @@
 
 #include "CelestialInformation.h"
 
+#include "SpiceLock.h"
+
 #include <Interface/LogOutput/LogUtility.h>
 #include <SpiceUsr.h>
 #include <string.h>
 
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 
@@ -31,6 +34,8 @@ CelestialInformation::CelestialInformation(string inertial_frame, string aber_co
   celes_objects_planetographic_radii_m_ = new double[num_of_state];
   celes_objects_mean_radius_m_ = new double[num_of_selected_body_];
 
+  std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
+
   // Acquisition of gravity constant
   for (int i = 0; i < num_of_selected_body_; i++) {
     SpiceInt planet_id = selected_body_[i];
@@ -59,6 +64,9 @@ CelestialInformation::CelestialInformation(string inertial_frame, string aber_co
     celes_objects_mean_radius_m_[i] = pow(rx * ry * rz, 1.0 / 3.0);
   }
 
+  GetBodyNames();
+  center_body_id_ = CalcBodyIdFromName(center_obj_.c_str());
+
   // Initialize rotation
   EarthRotation_ = new CelestialRotation(rotation_mode_, center_obj_);
 }
@@ -86,6 +94,13 @@ CelestialInformation::CelestialInformation(const CelestialInformation& obj)
   memcpy(celes_objects_gravity_constant_, obj.celes_objects_gravity_constant_, sd * num_of_selected_body_);
   memcpy(celes_objects_planetographic_radii_m_, obj.celes_objects_planetographic_radii_m_, sd * num_of_state);
   memcpy(celes_objects_mean_radius_m_, obj.celes_objects_mean_radius_m_, sd * num_of_selected_body_);
+
+  GetBodyNames();
+  center_body_id_ = obj.center_body_id_;
+  if (obj.is_ephemeris_cache_enabled_) {
+    EnableEphemerisCache(obj.ephemeris_cache_reference_jd_, obj.ephemeris_cache_degree_, obj.ephemeris_cache_segment_length_s_,
+                         obj.ephemeris_cache_tolerance_m_);
+  }
 }
 
 CelestialInformation::~CelestialInformation() {
@@ -99,27 +114,32 @@ CelestialInformation::~CelestialInformation() {
 }
 
 void CelestialInformation::UpdateAllObjectsInfo(const double current_jd) {
-  // Convert time
-  SpiceDouble et;
-  string jd = "jd " + to_string(current_jd);
-  str2et_c(jd.c_str(), &et);
-
-  for (int i = 0; i < num_of_selected_body_; i++) {
-    SpiceInt planet_id = selected_body_[i];
-
-    // Acquisition of body name from id
-    SpiceBoolean found;
-    const int maxlen = 100;
-    char namebuf[maxlen];
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-
-    // Acquisition of position and velocity
-    SpiceDouble rv_buf[6];
-    GetPlanetOrbit(namebuf, et, (SpiceDouble*)rv_buf);
-    // Convert unit [km], [km/s] to [m], [m/s]
-    for (int j = 0; j < 3; j++) {
-      celes_objects_pos_from_center_i_[i * 3 + j] = rv_buf[j] * 1000.0;
-      celes_objects_vel_from_center_i_[i * 3 + j] = rv_buf[j + 3] * 1000.0;
+  if (is_ephemeris_cache_enabled_) {
+    const double time_s = (current_jd - ephemeris_cache_reference_jd_) * 86400.0;
+    for (int i = 0; i < num_of_selected_body_; i++) {
+      double rv[6];
+      ephemeris_cache_[i].GetState(time_s, rv);
+      for (int j = 0; j < 3; j++) {
+        celes_objects_pos_from_center_i_[i * 3 + j] = rv[j];
+        celes_objects_vel_from_center_i_[i * 3 + j] = rv[j + 3];
+      }
+    }
+  } else {
+    std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
+    // Convert time
+    SpiceDouble et;
+    string jd = "jd " + to_string(current_jd);
+    str2et_c(jd.c_str(), &et);
+
+    for (int i = 0; i < num_of_selected_body_; i++) {
+      // Acquisition of position and velocity
+      SpiceDouble rv_buf[6];
+      GetPlanetOrbit(selected_body_name_[i].c_str(), et, (SpiceDouble*)rv_buf);
+      // Convert unit [km], [km/s] to [m], [m/s]
+      for (int j = 0; j < 3; j++) {
+        celes_objects_pos_from_center_i_[i * 3 + j] = rv_buf[j] * 1000.0;
+        celes_objects_vel_from_center_i_[i * 3 + j] = rv_buf[j + 3] * 1000.0;
+      }
     }
   }
 
@@ -127,6 +147,44 @@ void CelestialInformation::UpdateAllObjectsInfo(const double current_jd) {
   EarthRotation_->Update(current_jd);
 }
 
+void CelestialInformation::EnableEphemerisCache(const double reference_jd, const int degree, const double segment_length_s,
+                                                const double tolerance_m) {
+  is_ephemeris_cache_enabled_ = true;
+  ephemeris_cache_reference_jd_ = reference_jd;
+  ephemeris_cache_degree_ = degree;
+  ephemeris_cache_segment_length_s_ = segment_length_s;
+  ephemeris_cache_tolerance_m_ = tolerance_m;
+
+  // Full precision of the Julian day since std::to_string keeps only 6 decimals (0.0864 sec)
+  char jd[64];
+  snprintf(jd, sizeof(jd), "jd %.17g", reference_jd);
+  SpiceDouble et;
+  {
+    std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
+    str2et_c(jd, &et);
+  }
+  ephemeris_cache_reference_et_ = et;
+
+  ephemeris_cache_.clear();
+  ephemeris_cache_.reserve(num_of_selected_body_);
+  for (int i = 0; i < num_of_selected_body_; i++) {
+    auto state_function = [this, i](const double time_s, double state[6]) {
+      GetPlanetOrbit(selected_body_name_[i].c_str(), ephemeris_cache_reference_et_ + time_s, state);
+      // Convert unit [km], [km/s] to [m], [m/s]
+      for (int j = 0; j < 6; j++) state[j] *= 1000.0;
+    };
+    ephemeris_cache_.push_back(ChebyshevEphemeris(state_function, degree, segment_length_s, tolerance_m));
+  }
+}
+
+double CelestialInformation::GetMaxEphemerisCacheError_m(void) const {
+  double max_error_m = 0.0;
+  for (const auto& cache : ephemeris_cache_) {
+    if (cache.GetMaxFittingError_m() > max_error_m) max_error_m = cache.GetMaxFittingError_m();
+  }
+  return max_error_m;
+}
+
 // Getters
 Vector<3> CelestialInformation::GetPosFromCenter_i(const int id) const {
   Vector<3> pos(0.0);
@@ -152,12 +210,14 @@ Vector<3> CelestialInformation::GetVelFromCenter_i(const char* body_name) const
   return GetVelFromCenter_i(id);
 }
 
+double CelestialInformation::GetGravityConstant(const int id) const { return celes_objects_gravity_constant_[id]; }
+
 double CelestialInformation::GetGravityConstant(const char* body_name) const {
   int index = CalcBodyIdFromName(body_name);
-  return celes_objects_gravity_constant_[index];
+  return GetGravityConstant(index);
 }
 
-double CelestialInformation::GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant(center_obj_.c_str()); }
+double CelestialInformation::GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant(center_body_id_); }
 
 Vector<3> CelestialInformation::GetRadii(const int id) const {
   Vector<3> radii(0.0);
@@ -171,9 +231,11 @@ Vector<3> CelestialInformation::GetRadiiFromName(const char* body_name) const {
   return GetRadii(id);
 }
 
+double CelestialInformation::GetMeanRadius(const int id) const { return celes_objects_mean_radius_m_[id]; }
+
 double CelestialInformation::GetMeanRadiusFromName(const char* body_name) const {
   int index = CalcBodyIdFromName(body_name);
-  return celes_objects_mean_radius_m_[index];
+  return GetMeanRadius(index);
 }
 
 int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
@@ -182,7 +244,10 @@ int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   SpiceBoolean found;
 
   // Acquisition of ID from body name
-  bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  {
+    std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
+    bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  }
   for (int i = 0; i < num_of_selected_body_; i++) {
     if (selected_body_[i] == planet_id) {
       index = i;
@@ -192,11 +257,11 @@ int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   return index;
 }
 
-string CelestialInformation::GetLogHeader() const {
+void CelestialInformation::DeclareLogChannels(LogChannelList& channels) const {
+  std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
   SpiceBoolean found;
   const int maxlen = 100;
   char namebuf[maxlen];
-  string str_tmp = "";
   for (int i = 0; i < num_of_selected_body_; i++) {
     SpiceInt planet_id = selected_body_[i];
     // Acquisition of body name from id
@@ -205,27 +270,31 @@ string CelestialInformation::GetLogHeader() const {
     string body_pos = name + "_pos";
     string body_vel = name + "_vel";
     //　OUTPUT ONLY POS/VEL LOOKED FROM S/C AT THIS MOMENT
-    str_tmp += WriteVector(body_pos, "i", "m", 3);
-    str_tmp += WriteVector(body_vel, "i", "m/s", 3);
+    channels.AddVector(body_pos, "i", "m", 3);
+    channels.AddVector(body_vel, "i", "m/s", 3);
+  }
+  if (is_ephemeris_cache_enabled_) {
+    channels.AddScalar("ephemeris_cache_error", "m");
   }
-  return str_tmp;
 }
 
-string CelestialInformation::GetLogValue() const {
-  string str_tmp = "";
+void CelestialInformation::WriteLogValues(LogValueSpan& values) const {
   for (int i = 0; i < num_of_selected_body_; i++) {
     //　OUTPUT ONLY POS/VEL LOOKED FROM S/C AT THIS MOMENT
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celes_objects_pos_from_center_i_[i * 3 + j]);
+      values.Write(celes_objects_pos_from_center_i_[i * 3 + j]);
     }
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celes_objects_vel_from_center_i_[i * 3 + j]);
+      values.Write(celes_objects_vel_from_center_i_[i * 3 + j]);
     }
   }
-  return str_tmp;
+  if (is_ephemeris_cache_enabled_) {
+    values.Write(GetMaxEphemerisCacheError_m());
+  }
 }
 
 void CelestialInformation::DebugOutput(void) {
+  std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
   SpiceBoolean found;
   const int maxlen = 100;
   char namebuf[maxlen];
@@ -247,6 +316,19 @@ void CelestialInformation::DebugOutput(void) {
   }
 }
 
+void CelestialInformation::GetBodyNames(void) {
+  std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
+  const int maxlen = 100;
+  char namebuf[maxlen];
+  selected_body_name_.clear();
+  for (int i = 0; i < num_of_selected_body_; i++) {
+    SpiceInt planet_id = selected_body_[i];
+    SpiceBoolean found;
+    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
+    selected_body_name_.push_back(namebuf);
+  }
+}
+
 void CelestialInformation::GetPlanetOrbit(const char* planet_name, double et, double orbit[6]) {
   // Add `BARYCENTER` if needed
   const int maxlen = 100;
@@ -258,8 +340,25 @@ void CelestialInformation::GetPlanetOrbit(const char* planet_name, double et, do
   }
 
   // Get orbit
+  std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
   SpiceDouble lt;
   spkezr_c((ConstSpiceChar*)planet_name_, (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_.c_str(), (ConstSpiceChar*)aber_cor_.c_str(),
            (ConstSpiceChar*)center_obj_.c_str(), (SpiceDouble*)orbit, (SpiceDouble*)&lt);
   return;
 }
+
+void CelestialInformation::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("CelestialInformation");
+  writer.Write((uint64_t)ephemeris_cache_.size());
+  for (const auto& cache : ephemeris_cache_) {
+    cache.SaveState(writer);
+  }
+}
+
+void CelestialInformation::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("CelestialInformation")) return;
+  if (!reader.ReadSize(ephemeris_cache_.size(), "ephemeris cache")) return;
+  for (auto& cache : ephemeris_cache_) {
+    cache.LoadState(reader);
+  }
+}
@@ -9,13 +9,16 @@
 
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include "CelestialRotation.h"
-#include "Interface/LogOutput/ILoggable.h"
+#include "ChebyshevEphemeris.h"
+#include "Interface/LogOutput/ITypedLoggable.h"
 #include "Library/math/MatVec.hpp"
 #include "Library/math/Matrix.hpp"
 #include "Library/math/Quaternion.hpp"
 #include "Library/math/Vector.hpp"
+#include "Library/utils/Checkpoint.hpp"
 
 using libra::Quaternion;
 using libra::Vector;
@@ -25,7 +28,7 @@ using libra::Vector;
  * @brief Class to manage the information related with the celestial bodies
  * @details This class uses SPICE to get the information of celestial bodies
  */
-class CelestialInformation : public ILoggable {
+class CelestialInformation : public ITypedLoggable, public ICheckpointable {
  public:
   /**
    * @fn CelestialInformation
@@ -50,23 +53,52 @@ class CelestialInformation : public ILoggable {
    */
   virtual ~CelestialInformation();
 
-  // Override ILoggable
+  // Override ITypedLoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
    */
-  virtual std::string GetLogHeader() const;
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
    */
-  virtual std::string GetLogValue() const;
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the segments of the ephemeris cache
+   * @note The positions, velocities, and rotation are not written because they are calculated from the current time at each update.
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
   /**
    * @fn UpdateAllObjectsInfo
    * @brief Update the information of all selected celestial objects
    */
   void UpdateAllObjectsInfo(const double current_jd);
+  /**
+   * @fn EnableEphemerisCache
+   * @brief Use piecewise Chebyshev polynomials fitted to SPICE instead of calling SPICE at every update
+   * @note The difference between UTC and ephemeris time is evaluated at the reference epoch, so leap seconds inserted during the simulation are
+   * not considered.
+   * @param [in] reference_jd: Reference Julian day of the cache (usually the simulation start time)
+   * @param [in] degree: Degree of the Chebyshev polynomials
+   * @param [in] segment_length_s: Initial length of a time segment [s]
+   * @param [in] tolerance_m: Tolerance of the position fitting error [m]
+   */
+  void EnableEphemerisCache(const double reference_jd, const int degree, const double segment_length_s, const double tolerance_m);
+  /**
+   * @fn GetMaxEphemerisCacheError_m
+   * @brief Return the maximum position fitting error of the ephemeris cache against SPICE for all bodies [m]
+   */
+  double GetMaxEphemerisCacheError_m(void) const;
 
   // Getters
   // Orbit information
@@ -96,6 +128,12 @@ class CelestialInformation : public ILoggable {
   Vector<3> GetVelFromCenter_i(const char* body_name) const;
 
   // Gravity constants
+  /**
+   * @fn GetGravityConstant
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  double GetGravityConstant(const int id) const;
   /**
    * @fn GetGravityConstant
    * @brief Return gravity constant of the celestial body [m^3/s^2]
@@ -122,10 +160,16 @@ class CelestialInformation : public ILoggable {
    */
   Vector<3> GetRadiiFromName(const char* body_name) const;
   /**
-   * @fn GetMeanRadiusFromName
+   * @fn GetMeanRadius
    * @brief Return mean radius of a celestial body [m]
    * @param [in] id: ID of CelestialInformation list
    */
+  double GetMeanRadius(const int id) const;
+  /**
+   * @fn GetMeanRadiusFromName
+   * @brief Return mean radius of a celestial body [m]
+   * @param [in] body_name: Name of the body defined in the SPICE
+   */
   double GetMeanRadiusFromName(const char* body_name) const;
 
   // Parameters
@@ -144,6 +188,11 @@ class CelestialInformation : public ILoggable {
    * @brief Return name of the center body
    */
   inline std::string GetCenterBodyName(void) const { return center_obj_; }
+  /**
+   * @fn GetCenterBodyId
+   * @brief Return ID of the center body in CelestialInformation list
+   */
+  inline int GetCenterBodyId(void) const { return center_body_id_; }
 
   // Members
   /**
@@ -156,6 +205,8 @@ class CelestialInformation : public ILoggable {
   /**
    * @fn CalcBodyIdFromName
    * @brief Acquisition of ID of CelestialInformation list from body name
+   * @note This function calls SPICE with a lock. Users should resolve the ID once at the initialization and use the ID versions of the getters
+   * in each step.
    * @param [in] body_name: Celestial body name
    * @return ID of CelestialInformation list
    */
@@ -168,11 +219,13 @@ class CelestialInformation : public ILoggable {
 
  private:
   // Setting parameters
-  int num_of_selected_body_;    //!< Number of selected body
-  int* selected_body_;          //!< SPICE IDs of selected bodies
-  std::string inertial_frame_;  //!< Definition of inertial frame
-  std::string aber_cor_;        //!< Stellar aberration correction （Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt）
-  std::string center_obj_;      //!< Center object of inertial frame
+  int num_of_selected_body_;                     //!< Number of selected body
+  int* selected_body_;                           //!< SPICE IDs of selected bodies
+  std::string inertial_frame_;                   //!< Definition of inertial frame
+  std::string aber_cor_;                         //!< Stellar aberration correction （Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt）
+  std::string center_obj_;                       //!< Center object of inertial frame
+  int center_body_id_;                           //!< ID of the center object in the selected bodies
+  std::vector<std::string> selected_body_name_;  //!< SPICE names of selected bodies
 
   // Calculated values
   double* celes_objects_pos_from_center_i_;       //!< Position vector list at inertial frame [m]
@@ -188,6 +241,15 @@ class CelestialInformation : public ILoggable {
   CelestialRotation* EarthRotation_;  //!< Instatnce of Earth rotation
   RotationMode rotation_mode_;        //!< Designation of rotation model
 
+  // Ephemeris cache
+  bool is_ephemeris_cache_enabled_ = false;          //!< Flag to use the ephemeris cache
+  double ephemeris_cache_reference_jd_ = 0.0;        //!< Reference Julian day of the ephemeris cache
+  double ephemeris_cache_reference_et_ = 0.0;        //!< Ephemeris time at the reference Julian day [s]
+  int ephemeris_cache_degree_ = 0;                   //!< Degree of the Chebyshev polynomials
+  double ephemeris_cache_segment_length_s_ = 0.0;    //!< Initial length of a time segment [s]
+  double ephemeris_cache_tolerance_m_ = 0.0;         //!< Tolerance of the position fitting error [m]
+  std::vector<ChebyshevEphemeris> ephemeris_cache_;  //!< Ephemeris cache of each selected body
+
   /**
    * @fn GetPlanetOrbit
    * @brief Get position/velocity of planet.
@@ -197,6 +259,11 @@ class CelestialInformation : public ILoggable {
    * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
    */
   void GetPlanetOrbit(const char* planet_name, double et, double orbit[6]);
+  /**
+   * @fn GetBodyNames
+   * @brief Acquire SPICE names of selected bodies
+   */
+  void GetBodyNames(void);
 };
 
 #endif  //__celestial_information_H__
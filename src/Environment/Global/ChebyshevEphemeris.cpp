@@ -0,0 +1,115 @@
+/**
+ * @file ChebyshevEphemeris.cpp
+ * @brief Class to cache the ephemeris of a celestial body with piecewise Chebyshev polynomials
+ */
+
+#include "ChebyshevEphemeris.h"
+
+#include <Library/math/Constant.hpp>
+#include <cmath>
+#include <iostream>
+
+ChebyshevEphemeris::ChebyshevEphemeris(const StateFunction state_function, const int degree, const double segment_length_s, const double tolerance_m)
+    : state_function_(state_function), degree_(degree), segment_length_s_(segment_length_s), tolerance_m_(tolerance_m) {
+  if (degree_ < 2) degree_ = 2;
+  coefficients_.assign(6 * (degree_ + 1), 0.0);
+  node_states_.assign(6 * (degree_ + 1), 0.0);
+}
+
+void ChebyshevEphemeris::GetState(const double time_s, double state[6]) {
+  if (time_s < segment_start_s_ || time_s > segment_end_s_) {
+    Fit(time_s);
+  }
+  Evaluate(time_s, state);
+}
+
+void ChebyshevEphemeris::Fit(const double start_time_s) {
+  // Each segment starts with the configured length, and the halving is kept only for this segment
+  double length_s = segment_length_s_;
+  double error_m = FitSegment(start_time_s, length_s);
+  for (int i = 0; i < kMaxSubdivision && error_m > tolerance_m_; i++) {
+    length_s *= 0.5;
+    error_m = FitSegment(start_time_s, length_s);
+  }
+  if (error_m > tolerance_m_) {
+    std::cout << "ChebyshevEphemeris: fitting error " << error_m << " m exceeds the tolerance " << tolerance_m_ << " m\n";
+  }
+  segment_start_s_ = start_time_s;
+  segment_end_s_ = start_time_s + length_s;
+  if (error_m > max_fitting_error_m_) max_fitting_error_m_ = error_m;
+  num_fitting_++;
+}
+
+double ChebyshevEphemeris::FitSegment(const double start_time_s, const double length_s) {
+  const int num_nodes = degree_ + 1;
+  const double half_length_s = 0.5 * length_s;
+  const double mid_time_s = start_time_s + half_length_s;
+
+  // Sample the reference states at the Chebyshev nodes
+  for (int k = 0; k < num_nodes; k++) {
+    double x = cos(libra::pi * (k + 0.5) / num_nodes);
+    state_function_(mid_time_s + half_length_s * x, &node_states_[k * 6]);
+  }
+
+  // Coefficients with the discrete orthogonality of the Chebyshev polynomials
+  for (int j = 0; j < num_nodes; j++) {
+    double sum[6] = {0.0};
+    for (int k = 0; k < num_nodes; k++) {
+      double t_j = cos(libra::pi * j * (k + 0.5) / num_nodes);
+      for (int c = 0; c < 6; c++) sum[c] += node_states_[k * 6 + c] * t_j;
+    }
+    double scale = (j == 0) ? 1.0 / num_nodes : 2.0 / num_nodes;
+    for (int c = 0; c < 6; c++) coefficients_[c * num_nodes + j] = sum[c] * scale;
+  }
+  segment_start_s_ = start_time_s;
+  segment_end_s_ = start_time_s + length_s;
+
+  // Check the position error at the middle of the nodes
+  double max_error_m = 0.0;
+  for (int k = 0; k < num_nodes - 1; k++) {
+    double x = cos(libra::pi * (k + 1.0) / num_nodes);
+    double time_s = mid_time_s + half_length_s * x;
+    double reference[6], fitted[6];
+    state_function_(time_s, reference);
+    Evaluate(time_s, fitted);
+    double error_m = sqrt(pow(reference[0] - fitted[0], 2.0) + pow(reference[1] - fitted[1], 2.0) + pow(reference[2] - fitted[2], 2.0));
+    if (error_m > max_error_m) max_error_m = error_m;
+  }
+  return max_error_m;
+}
+
+void ChebyshevEphemeris::Evaluate(const double time_s, double state[6]) const {
+  const int num_nodes = degree_ + 1;
+  const double half_length_s = 0.5 * (segment_end_s_ - segment_start_s_);
+  const double x = (time_s - segment_start_s_) / half_length_s - 1.0;
+
+  // Clenshaw recurrence
+  for (int c = 0; c < 6; c++) {
+    const double* coeff = &coefficients_[c * num_nodes];
+    double b1 = 0.0, b2 = 0.0;
+    for (int j = num_nodes - 1; j >= 1; j--) {
+      double b0 = 2.0 * x * b1 - b2 + coeff[j];
+      b2 = b1;
+      b1 = b0;
+    }
+    state[c] = x * b1 - b2 + coeff[0];
+  }
+}
+
+void ChebyshevEphemeris::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("ChebyshevEphemeris");
+  writer.Write(segment_start_s_);
+  writer.Write(segment_end_s_);
+  writer.Write(coefficients_);
+  writer.Write(max_fitting_error_m_);
+  writer.Write(num_fitting_);
+}
+
+void ChebyshevEphemeris::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("ChebyshevEphemeris")) return;
+  reader.Read(segment_start_s_);
+  reader.Read(segment_end_s_);
+  reader.Read(coefficients_);
+  reader.Read(max_fitting_error_m_);
+  reader.Read(num_fitting_);
+}
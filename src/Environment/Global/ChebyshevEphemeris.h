@@ -0,0 +1,107 @@
+/**
+ * @file ChebyshevEphemeris.h
+ * @brief Class to cache the ephemeris of a celestial body with piecewise Chebyshev polynomials
+ */
+
+#ifndef __chebyshev_ephemeris_H__
+#define __chebyshev_ephemeris_H__
+
+#include <Library/utils/Checkpoint.hpp>
+#include <functional>
+#include <vector>
+
+/**
+ * @class ChebyshevEphemeris
+ * @brief Class to cache the ephemeris of a celestial body with piecewise Chebyshev polynomials
+ * @details The position and velocity are fitted for a time segment when the requested time leaves the current segment. The fitted values are
+ * compared with the source ephemeris at the middle points of the interpolation nodes, and the segment is halved until the position error becomes
+ * smaller than the tolerance.
+ */
+class ChebyshevEphemeris : public ICheckpointable {
+ public:
+  /**
+   * @brief Function to get the reference state
+   * @param [in] time_s: Time from the reference epoch [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   */
+  typedef std::function<void(const double time_s, double state[6])> StateFunction;
+
+  /**
+   * @fn ChebyshevEphemeris
+   * @brief Constructor
+   * @param [in] state_function: Function to get the reference state
+   * @param [in] degree: Degree of the Chebyshev polynomials
+   * @param [in] segment_length_s: Initial length of a time segment [s]
+   * @param [in] tolerance_m: Tolerance of the position fitting error [m]
+   */
+  ChebyshevEphemeris(const StateFunction state_function, const int degree, const double segment_length_s, const double tolerance_m);
+
+  /**
+   * @fn GetState
+   * @brief Calculate the state at the time. The polynomials are fitted when the time is outside of the current segment.
+   * @param [in] time_s: Time from the reference epoch [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   */
+  void GetState(const double time_s, double state[6]);
+
+  /**
+   * @fn GetMaxFittingError_m
+   * @brief Return the maximum position fitting error against the reference ephemeris in all segments fitted so far [m]
+   */
+  inline double GetMaxFittingError_m() const { return max_fitting_error_m_; }
+  /**
+   * @fn GetNumFitting
+   * @brief Return the number of the fitted segments
+   */
+  inline int GetNumFitting() const { return num_fitting_; }
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the current segment and the fitting statistics
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
+ private:
+  StateFunction state_function_;  //!< Function to get the reference state
+  int degree_;                    //!< Degree of the Chebyshev polynomials
+  double segment_length_s_;       //!< Initial length of each time segment [s]
+  double tolerance_m_;            //!< Tolerance of the position fitting error [m]
+
+  double segment_start_s_ = 0.0;         //!< Start time of the current segment [s]
+  double segment_end_s_ = -1.0;          //!< End time of the current segment [s]
+  std::vector<double> coefficients_;     //!< Chebyshev coefficients of the current segment [component][order]
+  std::vector<double> node_states_;      //!< Work buffer of the states at the nodes [node][component]
+  double max_fitting_error_m_ = 0.0;     //!< Maximum position fitting error [m]
+  int num_fitting_ = 0;                  //!< Number of the fitted segments
+  static const int kMaxSubdivision = 8;  //!< Maximum number of halving the segment length
+
+  /**
+   * @fn Fit
+   * @brief Fit the polynomials for the segment starting at the time
+   * @param [in] start_time_s: Start time of the segment [s]
+   */
+  void Fit(const double start_time_s);
+  /**
+   * @fn FitSegment
+   * @brief Fit the polynomials for a segment and return the position fitting error
+   * @param [in] start_time_s: Start time of the segment [s]
+   * @param [in] length_s: Length of the segment [s]
+   * @return Maximum position fitting error at the check points [m]
+   */
+  double FitSegment(const double start_time_s, const double length_s);
+  /**
+   * @fn Evaluate
+   * @brief Evaluate the polynomials of the current segment
+   * @param [in] time_s: Time from the reference epoch [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   */
+  void Evaluate(const double time_s, double state[6]) const;
+};
+
+#endif  //__chebyshev_ephemeris_H__
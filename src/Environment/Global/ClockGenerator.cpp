@@ -5,14 +5,26 @@
 
 #include "ClockGenerator.h"
 
-ClockGenerator::~ClockGenerator() {}
+#include <Library/utils/DependencyStages.h>
 
-void ClockGenerator::RegisterComponent(ITickable* tickable) { components_.push_back(tickable); }
+ClockGenerator::~ClockGenerator() {
+  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
+    (*itr)->registered_clock_gen_ = nullptr;
+  }
+}
+
+void ClockGenerator::RegisterComponent(ITickable* tickable) {
+  components_.push_back(tickable);
+  tickable->registered_clock_gen_ = this;
+  UpdateSchedule();
+}
 
 void ClockGenerator::RemoveComponent(ITickable* tickable) {
   for (auto itr = components_.begin(); itr != components_.end();) {
     if (*itr == tickable) {
+      if (tickable->registered_clock_gen_ == this) tickable->registered_clock_gen_ = nullptr;
       components_.erase(itr++);
+      UpdateSchedule();
       break;
     } else {
       ++itr;
@@ -21,20 +33,131 @@ void ClockGenerator::RemoveComponent(ITickable* tickable) {
 }
 
 void ClockGenerator::TickToComponents() {
-  // Update for each component
-  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
-    // Run MainRoutine
-    (*itr)->Tick(timer_count_);
-    // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
-    if ((*itr)->GetNeedsFastUpdate()) {
-      (*itr)->FastTick(timer_count_);
+  if (!is_schedule_updated_) BuildSchedule();
+
+  if (periods_.size() > kMaxPeriods) {
+    // Visit all components when the periods cannot be represented by the bit mask
+    for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
+      Tick(TickEntry{*itr, true, (*itr)->GetNeedsFastUpdate()});
+    }
+  } else {
+    uint64_t due_mask = 0;
+    for (size_t i = 0; i < periods_.size(); i++) {
+      if (timer_count_ % periods_[i] == 0) due_mask |= (uint64_t)1 << i;
+    }
+    if (thread_pool_ == nullptr) {
+      // Update for each component due on this tick
+      const std::vector<TickEntry>& entries = GetTickEntries(due_mask);
+      for (auto itr = entries.begin(); itr != entries.end(); ++itr) {
+        Tick(*itr);
+      }
+    } else {
+      // Update the independent components of each stage concurrently
+      const std::vector<std::vector<TickEntry>>& stages = GetTickStages(due_mask);
+      for (auto stage = stages.begin(); stage != stages.end(); ++stage) {
+        if (stage->size() == 1) {
+          Tick(stage->front());
+        } else {
+          thread_pool_->Run(stage->size(), [this, stage](const size_t index) { Tick((*stage)[index]); });
+        }
+      }
     }
   }
   timer_count_++;  // TODO: Consider if "timer_count" is necessary
 }
 
+void ClockGenerator::BuildSchedule() {
+  periods_.clear();
+  component_periods_.clear();
+  tick_entries_.clear();
+  tick_stages_.clear();
+
+  auto find_period = [this](const int prescaler) {
+    const int period = (prescaler > 0) ? prescaler : 1;
+    for (size_t i = 0; i < periods_.size(); i++) {
+      if (periods_[i] == period) return i;
+    }
+    periods_.push_back(period);
+    return periods_.size() - 1;
+  };
+  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
+    ComponentPeriod component_period;
+    component_period.tick = find_period((*itr)->GetPrescaler());
+    component_period.fast_tick = (*itr)->GetNeedsFastUpdate() ? find_period((*itr)->GetFastPrescaler()) : kNoPeriod;
+    component_periods_.push_back(component_period);
+  }
+  is_schedule_updated_ = true;
+}
+
+const std::vector<ClockGenerator::TickEntry>& ClockGenerator::GetTickEntries(const uint64_t due_mask) {
+  auto found = tick_entries_.find(due_mask);
+  if (found != tick_entries_.end()) return found->second;
+
+  std::vector<TickEntry>& entries = tick_entries_[due_mask];
+  for (size_t i = 0; i < components_.size(); i++) {
+    const ComponentPeriod& component_period = component_periods_[i];
+    TickEntry entry;
+    entry.component = components_[i];
+    entry.is_tick = (due_mask >> component_period.tick) & 1;
+    entry.is_fast_tick = component_period.fast_tick != kNoPeriod && ((due_mask >> component_period.fast_tick) & 1);
+    if (entry.is_tick || entry.is_fast_tick) entries.push_back(entry);
+  }
+  return entries;
+}
+
+const std::vector<std::vector<ClockGenerator::TickEntry>>& ClockGenerator::GetTickStages(const uint64_t due_mask) {
+  auto found = tick_stages_.find(due_mask);
+  if (found != tick_stages_.end()) return found->second;
+
+  // Components without the declaration may read and write anything
+  const std::vector<TickEntry>& entries = GetTickEntries(due_mask);
+  DependencyStages dependency_stages;
+  std::vector<size_t> entry_stages;
+  for (auto itr = entries.begin(); itr != entries.end(); ++itr) {
+    TickDependencies dependencies;
+    if (itr->component->DeclareTickDependencies(dependencies)) {
+      entry_stages.push_back(dependency_stages.Add(dependencies.GetReads(), dependencies.GetWrites()));
+    } else {
+      entry_stages.push_back(dependency_stages.AddBarrier());
+    }
+  }
+
+  std::vector<std::vector<TickEntry>>& stages = tick_stages_[due_mask];
+  stages.resize(dependency_stages.GetNumOfStages());
+  for (size_t i = 0; i < entries.size(); i++) {
+    stages[entry_stages[i]].push_back(entries[i]);
+  }
+  return stages;
+}
+
+void ClockGenerator::SetNumOfThreads(const size_t num_of_threads) {
+  if (num_of_threads > 1) {
+    thread_pool_.reset(new ThreadPool(num_of_threads));
+  } else {
+    thread_pool_.reset();
+  }
+}
+
 void ClockGenerator::UpdateComponents(const SimTime* sim_time) {
   if (sim_time->GetCompoUpdateFlag()) {
     TickToComponents();
   }
 }
+
+void ClockGenerator::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("ClockGenerator");
+  writer.Write(timer_count_);
+  writer.Write((uint64_t)components_.size());
+  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
+    (*itr)->SaveState(writer);
+  }
+}
+
+void ClockGenerator::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("ClockGenerator")) return;
+  reader.Read(timer_count_);
+  if (!reader.ReadSize(components_.size(), "ClockGenerator components")) return;
+  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
+    (*itr)->LoadState(reader);
+  }
+}
@@ -5,7 +5,11 @@
 
 #pragma once
 #include <Component/Abstract/ITickable.h>
+#include <Library/utils/ThreadPool.h>
 
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "SimTime.h"
@@ -13,6 +17,11 @@
 /**
  * @class ClockGenerator
  * @brief Class to generate clock for classes which have ITickable
+ * @details The components are grouped by their prescalers. At each tick, only the components whose prescaler divides the timer count are
+ * visited in the registration order. The list of the visited components is cached for each combination of the divisible prescalers.
+ * With multiple threads, the due components are grouped into stages by their declared dependencies (ITickable::DeclareTickDependencies). The
+ * components in a stage run concurrently, and a component runs in a later stage than all previous components conflicting with it, so the results
+ * are identical to the serial execution.
  */
 class ClockGenerator {
  public:
@@ -34,9 +43,14 @@ class ClockGenerator {
    * @param [in] ticlable: Registered component class
    */
   void RemoveComponent(ITickable* tickable);
+  /**
+   * @fn UpdateSchedule
+   * @brief Rebuild the schedule before the next tick. ITickable::SetNeedsFastUpdate calls this when the flag of a registered component is changed.
+   */
+  inline void UpdateSchedule() { is_schedule_updated_ = false; }
   /**
    * @fn TickToComponents
-   * @brief Execute tick function of all registered components
+   * @brief Execute tick function of the registered components due on the current timer count
    */
   void TickToComponents();
   /**
@@ -50,10 +64,84 @@ class ClockGenerator {
    * @brief Clear time count
    */
   inline void ClearTimerCount(void) { timer_count_ = 0; }
+  /**
+   * @fn SetNumOfThreads
+   * @brief Set the number of threads to execute the tick functions
+   * @param [in] num_of_threads: Number of threads including the simulation thread. 1 means the serial execution in the registration order.
+   */
+  void SetNumOfThreads(const size_t num_of_threads);
+
+  /**
+   * @fn SaveState
+   * @brief Write the timer count and the states of the registered components in the registration order
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState. The components have to be registered in the same order.
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   const int IntervalMillisecond = 1;  //!< Clock period [ms]. (Currenly, this is not used. TODO: Delete this.)
 
  private:
+  /**
+   * @struct TickEntry
+   * @brief Component due on a tick
+   */
+  struct TickEntry {
+    ITickable* component;  //!< Component
+    bool is_tick;          //!< Call Tick
+    bool is_fast_tick;     //!< Call FastTick
+  };
+  /**
+   * @struct ComponentPeriod
+   * @brief Indexes of the prescalers of a component in periods_
+   */
+  struct ComponentPeriod {
+    size_t tick;       //!< Index of the prescaler of Tick
+    size_t fast_tick;  //!< Index of the prescaler of FastTick. kNoPeriod when the fast update is not needed.
+  };
+
   std::vector<ITickable*> components_;  //!< Component list fot tick
-  int timer_count_;                     //!< Timer count TODO: consider size, unsigned
+  int timer_count_ = 0;                 //!< Timer count TODO: consider size, unsigned
+
+  bool is_schedule_updated_ = false;                                               //!< Is the schedule built for the current components
+  std::vector<int> periods_;                                                       //!< Distinct prescalers of the registered components
+  std::vector<ComponentPeriod> component_periods_;                                 //!< Prescaler indexes of each component in the registration order
+  std::unordered_map<uint64_t, std::vector<TickEntry>> tick_entries_;              //!< Due components for each bit mask of the divisible periods
+  std::unordered_map<uint64_t, std::vector<std::vector<TickEntry>>> tick_stages_;  //!< Stages of the due components for each bit mask
+
+  std::unique_ptr<ThreadPool> thread_pool_;  //!< Thread pool for the concurrent execution. nullptr for the serial execution.
+
+  static const size_t kMaxPeriods = 64;          //!< Maximum number of the distinct prescalers represented by the bit mask
+  static const size_t kNoPeriod = (size_t)(-1);  //!< Index for no period
+
+  /**
+   * @fn BuildSchedule
+   * @brief Group the registered components by their prescalers
+   */
+  void BuildSchedule();
+  /**
+   * @fn GetTickEntries
+   * @brief Return the components due on the bit mask of the divisible periods in the registration order
+   */
+  const std::vector<TickEntry>& GetTickEntries(const uint64_t due_mask);
+  /**
+   * @fn GetTickStages
+   * @brief Return the components due on the bit mask grouped into the stages executed in order
+   */
+  const std::vector<std::vector<TickEntry>>& GetTickStages(const uint64_t due_mask);
+  /**
+   * @fn Tick
+   * @brief Execute the tick functions of a component
+   */
+  inline void Tick(const TickEntry& entry) {
+    // Run MainRoutine
+    if (entry.is_tick) entry.component->Tick(timer_count_);
+    // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
+    if (entry.is_fast_tick) entry.component->FastTick(timer_count_);
+  }
 };
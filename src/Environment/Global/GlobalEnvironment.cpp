@@ -17,6 +17,7 @@ GlobalEnvironment::~GlobalEnvironment() {
   delete celes_info_;
   delete hipp_;
   delete gnss_satellites_;
+  delete tle_catalogue_;
 }
 
 void GlobalEnvironment::Initialize(SimulationConfig* sim_config) {
@@ -26,24 +27,45 @@ void GlobalEnvironment::Initialize(SimulationConfig* sim_config) {
 
   // Initialize
   sim_time_ = InitSimTime(sim_time_ini_path);
-  celes_info_ = InitCelesInfo(sim_config->ini_base_fname_);
+  celes_info_ = InitCelesInfo(sim_config->ini_base_fname_, sim_time_->GetCurrentJd());
   hipp_ = InitHipCatalogue(sim_config->ini_base_fname_);
-  gnss_satellites_ = InitGnssSatellites(sim_config->gnss_file_);
+  gnss_satellites_ = InitGnssSatellites(sim_config->gnss_file_, *sim_time_);
+  tle_catalogue_ = InitTleCatalogue(sim_config->ini_base_fname_);
 
   // Calc initial value
   celes_info_->UpdateAllObjectsInfo(sim_time_->GetCurrentJd());
   gnss_satellites_->SetUp(sim_time_);
+  tle_catalogue_->Update(*sim_time_, celes_info_->GetEarthRotation());
 }
 
 void GlobalEnvironment::Update() {
   sim_time_->UpdateTime();
   celes_info_->UpdateAllObjectsInfo(sim_time_->GetCurrentJd());
   gnss_satellites_->Update(sim_time_);
+  tle_catalogue_->Update(*sim_time_, celes_info_->GetEarthRotation());
 }
 
 void GlobalEnvironment::LogSetup(Logger& logger) {
   logger.AddLoggable(sim_time_);
+  // The latencies are logged only in the real time execution
+  if (sim_time_->GetRealTimeExecutive().IsEnabled()) logger.AddLoggable(&(sim_time_->GetRealTimeExecutive()));
   logger.AddLoggable(celes_info_);
 }
 
 void GlobalEnvironment::Reset(void) { sim_time_->ResetClock(); }
+
+void GlobalEnvironment::SaveState(CheckpointWriter& writer) const {
+  sim_time_->SaveState(writer);
+  celes_info_->SaveState(writer);
+  gnss_satellites_->SaveState(writer);
+  tle_catalogue_->SaveState(writer);
+}
+
+void GlobalEnvironment::LoadState(CheckpointReader& reader) {
+  sim_time_->LoadState(reader);
+  celes_info_->LoadState(reader);
+  gnss_satellites_->LoadState(reader);
+  tle_catalogue_->LoadState(reader);
+  // The positions of the celestial bodies are derived from the time
+  celes_info_->UpdateAllObjectsInfo(sim_time_->GetCurrentJd());
+}
@@ -12,6 +12,7 @@
 #include "GnssSatellites.h"
 #include "HipparcosCatalogue.h"
 #include "SimTime.h"
+#include "TleCatalogue.h"
 
 /**
  * @class GlobalEnvironment
@@ -52,6 +53,18 @@ class GlobalEnvironment {
    * @brief Reset clock of SimTime
    */
   void Reset(void);
+  /**
+   * @fn SaveState
+   * @brief Write the states of the simulation time, the celestial bodies, and the GNSS satellites
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   // Getter
   /**
@@ -74,10 +87,16 @@ class GlobalEnvironment {
    * @brief Return GnssSatellites
    */
   inline const GnssSatellites& GetGnssSatellites() const { return *gnss_satellites_; }
+  /**
+   * @fn GetTleCatalogue
+   * @brief Return TleCatalogue
+   */
+  inline const TleCatalogue& GetTleCatalogue() const { return *tle_catalogue_; }
 
  private:
   SimTime* sim_time_;                 //!< Simulation time
   CelestialInformation* celes_info_;  //!< Celestial bodies information
   HipparcosCatalogue* hipp_;          //!< Hipparcos catalogue
   GnssSatellites* gnss_satellites_;   //!< GNSS satellites
+  TleCatalogue* tle_catalogue_;       //!< TLE catalogue
 };
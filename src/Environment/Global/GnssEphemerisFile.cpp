@@ -0,0 +1,298 @@
+/**
+ * @file GnssEphemerisFile.cpp
+ * @brief Class to load the records of a GNSS ephemeris file (SP3 or clock RINEX) with the binary cache
+ */
+
+#include "GnssEphemerisFile.h"
+
+#include <Library/sgp4/sgp4ext.h>  //for jday()
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+#ifdef WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(GnssEphemerisCacheHeader) == 64, "Layout of the cache header is changed");
+static_assert(sizeof(GnssEphemerisEpoch) == 16, "Layout of the cache epoch is changed");
+static_assert(sizeof(GnssEphemerisRecord) == 48, "Layout of the cache record is changed");
+
+static const char kCacheMagic[8] = "S2EGNSS";       //!< Magic of the cache file
+static const char kCacheExtension[] = ".s2ecache";  //!< Extension added to the source file name
+
+/**
+ * @fn CalcFileHash
+ * @brief Calculate the FNV-1a hash and the size of a file
+ * @return False when the file is not opened
+ */
+static bool CalcFileHash(const std::string& file_path, uint64_t& hash, uint64_t& size) {
+  std::ifstream ifs(file_path, std::ios::binary);
+  if (!ifs.is_open()) return false;
+  hash = 14695981039346656037ULL;
+  size = 0;
+  std::vector<char> buffer(1 << 20);
+  while (ifs) {
+    ifs.read(buffer.data(), buffer.size());
+    const std::streamsize count = ifs.gcount();
+    for (std::streamsize i = 0; i < count; i++) {
+      hash ^= (uint8_t)buffer[i];
+      hash *= 1099511628211ULL;
+    }
+    size += (uint64_t)count;
+  }
+  return true;
+}
+
+/**
+ * @fn SplitTokens
+ * @brief Find the beginnings of the tokens separated by the white spaces
+ * @param [in] line: Line
+ * @param [out] tokens: Pointers to the beginnings of the tokens
+ * @param [in] max_tokens: Maximum number of the tokens
+ * @return Number of the tokens
+ */
+static int SplitTokens(const std::string& line, const char* tokens[], const int max_tokens) {
+  int num_tokens = 0;
+  const char* c = line.c_str();
+  while (*c != '\0' && num_tokens < max_tokens) {
+    while (*c == ' ' || *c == '\t' || *c == '\r') c++;
+    if (*c == '\0') break;
+    tokens[num_tokens++] = c;
+    while (*c != '\0' && *c != ' ' && *c != '\t' && *c != '\r') c++;
+  }
+  return num_tokens;
+}
+
+/**
+ * @fn SetSatelliteId
+ * @brief Copy the GNSS satellite number (e.g. "G01") of the token into the record. The "P" prefix of the SP3 file is removed.
+ */
+static void SetSatelliteId(const char* token, const bool is_sp3, GnssEphemerisRecord& record) {
+  if (is_sp3 && token[0] == 'P') token++;
+  int i = 0;
+  for (; i < 3 && token[i] != '\0' && token[i] != ' ' && token[i] != '\t'; i++) record.sat_id[i] = token[i];
+  for (; i < 4; i++) record.sat_id[i] = '\0';
+}
+
+GnssEphemerisFile::GnssEphemerisFile(const std::string& file_path, const GnssEphemerisFormat format, const bool is_cache_enabled) {
+  std::memset(&header_, 0, sizeof(header_));
+  std::memcpy(header_.magic, kCacheMagic, sizeof(header_.magic));
+  header_.version = kCacheVersion;
+  header_.format = (uint32_t)format;
+
+  const std::string cache_path = file_path + kCacheExtension;
+  if (is_cache_enabled) {
+    if (!CalcFileHash(file_path, header_.source_hash, header_.source_size)) {
+      std::cout << "gnss file: " << file_path << " not found" << std::endl;
+      exit(1);
+    }
+    if (LoadCache(cache_path)) return;
+  }
+
+  const bool is_opened = (format == GnssEphemerisFormat::kSp3) ? ParseSp3(file_path) : ParseClk(file_path);
+  if (!is_opened) {
+    std::cout << "gnss file: " << file_path << " not found" << std::endl;
+    exit(1);
+  }
+  // The records in a file are almost sorted, and the order of the records at the same time is kept
+  std::stable_sort(record_storage_.begin(), record_storage_.end(),
+                   [](const GnssEphemerisRecord& a, const GnssEphemerisRecord& b) { return a.unix_time < b.unix_time; });
+  header_.num_epochs = epoch_storage_.size();
+  header_.num_records = record_storage_.size();
+
+  if (is_cache_enabled) WriteCache(cache_path);
+}
+
+const GnssEphemerisEpoch* GnssEphemerisFile::GetEpochs() const {
+  if (cache_mapping_) return reinterpret_cast<const GnssEphemerisEpoch*>(cache_mapping_.get() + sizeof(GnssEphemerisCacheHeader));
+  return epoch_storage_.data();
+}
+
+const GnssEphemerisRecord* GnssEphemerisFile::GetRecords() const {
+  if (cache_mapping_) {
+    const size_t offset = sizeof(GnssEphemerisCacheHeader) + sizeof(GnssEphemerisEpoch) * GetNumOfEpochs();
+    return reinterpret_cast<const GnssEphemerisRecord*>(cache_mapping_.get() + offset);
+  }
+  return record_storage_.data();
+}
+
+std::pair<size_t, size_t> GnssEphemerisFile::GetRecordRange(const double start_unix_time, const double end_unix_time) const {
+  const GnssEphemerisRecord* begin = GetRecords();
+  const GnssEphemerisRecord* end = begin + GetNumOfRecords();
+  const GnssEphemerisRecord* first =
+      std::lower_bound(begin, end, start_unix_time, [](const GnssEphemerisRecord& r, const double t) { return r.unix_time < t; });
+  const GnssEphemerisRecord* last =
+      std::upper_bound(first, end, end_unix_time, [](const double t, const GnssEphemerisRecord& r) { return t < r.unix_time; });
+  return std::make_pair((size_t)(first - begin), (size_t)(last - begin));
+}
+
+double GnssEphemerisFile::CalcUnixTime(const int year, const int month, const int day, const int hour, const int minute, const double second) {
+  // Days from 1970-01-01 of the proleptic Gregorian calendar
+  // Ref: H. Hinnant, "chrono-Compatible Low-Level Date Algorithms", days_from_civil
+  const int y = (month <= 2) ? year - 1 : year;
+  const int era = (y >= 0 ? y : y - 399) / 400;
+  const int year_of_era = y - era * 400;
+  const int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  const double days = (double)era * 146097.0 + (double)day_of_era - 719468.0;
+  return days * 86400.0 + hour * 3600.0 + minute * 60.0 + second;
+}
+
+bool GnssEphemerisFile::ParseSp3(const std::string& file_path) {
+  std::ifstream ifs(file_path);
+  if (!ifs.is_open()) return false;
+
+  std::string line;
+  const char* tokens[8];
+  int line_number = 0;
+  bool is_data = false;
+  GnssEphemerisEpoch epoch = {0.0, 0.0};
+  while (std::getline(ifs, line)) {
+    const int num_tokens = SplitTokens(line, tokens, 8);
+    // Header
+    // http://epncb.oma.be/ftp/data/format/sp3c.txt
+    if (line_number == 0 && num_tokens >= 7) {
+      header_.num_declared_epochs = (int32_t)strtol(tokens[6], nullptr, 10);
+    } else if (line_number == 1 && num_tokens >= 4) {
+      header_.time_interval_s = strtod(tokens[3], nullptr);
+    }
+    line_number++;
+
+    if (line.empty()) continue;
+    if (line.front() == '*') {
+      // Epoch: * year month day hour minute second
+      if (num_tokens < 7) continue;
+      is_data = true;
+      const int year = (int)strtol(tokens[1], nullptr, 10);
+      const int month = (int)strtol(tokens[2], nullptr, 10);
+      const int day = (int)strtol(tokens[3], nullptr, 10);
+      const int hour = (int)strtol(tokens[4], nullptr, 10);
+      const int minute = (int)strtol(tokens[5], nullptr, 10);
+      const double second = strtod(tokens[6], nullptr);
+      // Truncate to integer seconds with the margin of the numerical error
+      epoch.unix_time = CalcUnixTime(year, month, day, hour, minute, std::floor(second + 1e-4));
+      jday(year, month, day, hour, minute, second, epoch.julian_day);
+      epoch_storage_.push_back(epoch);
+    } else if (is_data && line.front() == 'P' && num_tokens >= 5) {
+      // Position: P<satellite number> x y z clock
+      GnssEphemerisRecord record;
+      record.unix_time = epoch.unix_time;
+      record.epoch_index = (int32_t)epoch_storage_.size() - 1;
+      SetSatelliteId(tokens[0], true, record);
+      for (int i = 0; i < 4; i++) record.values[i] = strtod(tokens[i + 1], nullptr);
+      record_storage_.push_back(record);
+    }
+  }
+  return true;
+}
+
+bool GnssEphemerisFile::ParseClk(const std::string& file_path) {
+  std::ifstream ifs(file_path);
+  if (!ifs.is_open()) return false;
+
+  std::string line;
+  const char* tokens[10];
+  while (std::getline(ifs, line)) {
+    // Clock of the satellite: AS <satellite number> year month day hour minute second <number of values> bias ...
+    if (line.compare(0, 3, "AS ") != 0) continue;
+    if (SplitTokens(line, tokens, 10) < 10) continue;
+
+    GnssEphemerisRecord record;
+    const int year = (int)strtol(tokens[2], nullptr, 10);
+    const int month = (int)strtol(tokens[3], nullptr, 10);
+    const int day = (int)strtol(tokens[4], nullptr, 10);
+    const int hour = (int)strtol(tokens[5], nullptr, 10);
+    const int minute = (int)strtol(tokens[6], nullptr, 10);
+    const double second = strtod(tokens[7], nullptr);
+    record.unix_time = CalcUnixTime(year, month, day, hour, minute, std::floor(second + 1e-4));
+    record.epoch_index = -1;
+    SetSatelliteId(tokens[1], false, record);
+    record.values[0] = strtod(tokens[9], nullptr);
+    for (int i = 1; i < 4; i++) record.values[i] = 0.0;
+    record_storage_.push_back(record);
+  }
+  return true;
+}
+
+bool GnssEphemerisFile::LoadCache(const std::string& cache_path) {
+  GnssEphemerisCacheHeader cache_header;
+  uint64_t file_size = 0;
+  {
+    std::ifstream ifs(cache_path, std::ios::binary | std::ios::ate);
+    if (!ifs.is_open()) return false;
+    file_size = (uint64_t)ifs.tellg();
+    if (file_size < sizeof(cache_header)) return false;
+    ifs.seekg(0);
+    ifs.read(reinterpret_cast<char*>(&cache_header), sizeof(cache_header));
+    if (!ifs) return false;
+  }
+  if (std::memcmp(cache_header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0 || cache_header.version != header_.version ||
+      cache_header.format != header_.format || cache_header.source_hash != header_.source_hash ||
+      cache_header.source_size != header_.source_size) {
+    return false;
+  }
+  const uint64_t expected_size =
+      sizeof(cache_header) + sizeof(GnssEphemerisEpoch) * cache_header.num_epochs + sizeof(GnssEphemerisRecord) * cache_header.num_records;
+  if (file_size != expected_size) return false;
+
+#ifndef WIN32
+  const int fd = open(cache_path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  void* address = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // The mapping is kept after closing the file
+  if (address == MAP_FAILED) return false;
+  cache_mapping_ = std::shared_ptr<const char>(static_cast<const char*>(address), [file_size](const char* p) { munmap((void*)p, file_size); });
+#else
+  // Read the whole cache instead of mapping it
+  std::shared_ptr<char> buffer(new char[file_size], std::default_delete<char[]>());
+  std::ifstream ifs(cache_path, std::ios::binary);
+  ifs.read(buffer.get(), file_size);
+  if (!ifs) return false;
+  cache_mapping_ = buffer;
+#endif
+
+  header_ = cache_header;
+  is_loaded_from_cache_ = true;
+  return true;
+}
+
+void GnssEphemerisFile::WriteCache(const std::string& cache_path) const {
+  // Unique temporary file for the parallel executions in the threads and the processes
+#ifdef WIN32
+  const int process_id = _getpid();
+#else
+  const int process_id = (int)getpid();
+#endif
+  const std::string temporary_path =
+      cache_path + ".tmp" + std::to_string(process_id) + "_" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+  {
+    std::ofstream ofs(temporary_path, std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open()) return;  // The cache is optional (e.g. read-only directory)
+    ofs.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+    ofs.write(reinterpret_cast<const char*>(epoch_storage_.data()), sizeof(GnssEphemerisEpoch) * epoch_storage_.size());
+    ofs.write(reinterpret_cast<const char*>(record_storage_.data()), sizeof(GnssEphemerisRecord) * record_storage_.size());
+    if (!ofs) {
+      ofs.close();
+      std::remove(temporary_path.c_str());
+      return;
+    }
+  }
+#ifdef WIN32
+  std::remove(cache_path.c_str());  // rename does not overwrite an existing file on Windows
+#endif
+  // rename replaces the existing cache atomically on POSIX
+  if (std::rename(temporary_path.c_str(), cache_path.c_str()) != 0) std::remove(temporary_path.c_str());
+}
@@ -0,0 +1,165 @@
+/**
+ * @file GnssEphemerisFile.h
+ * @brief Class to load the records of a GNSS ephemeris file (SP3 or clock RINEX) with the binary cache
+ * @details Cache file format (native endian, written next to the source file as "<source file>.s2ecache")
+ * - Header: GnssEphemerisCacheHeader (64 bytes). The cache is used only when the version, the format, and the FNV-1a hash and the size of the
+ *   source file match.
+ * - Epochs: GnssEphemerisEpoch x num_epochs (SP3 only)
+ * - Records: GnssEphemerisRecord x num_records sorted by the unix time
+ */
+
+#ifndef __gnss_ephemeris_file_h__
+#define __gnss_ephemeris_file_h__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @enum GnssEphemerisFormat
+ * @brief Format of the GNSS ephemeris file
+ */
+enum class GnssEphemerisFormat {
+  kSp3 = 0,  //!< SP3 orbit file with the position and the clock
+  kClk,      //!< Clock RINEX file (e.g. .clk, .clk_30s)
+};
+
+/**
+ * @struct GnssEphemerisCacheHeader
+ * @brief Header of the binary cache file
+ */
+struct GnssEphemerisCacheHeader {
+  char magic[8];                //!< "S2EGNSS" with the null terminator
+  uint32_t version;             //!< Version of the cache format
+  uint32_t format;              //!< GnssEphemerisFormat
+  uint64_t source_hash;         //!< FNV-1a hash of the source file
+  uint64_t source_size;         //!< Size of the source file [byte]
+  double time_interval_s;       //!< Epoch interval in the SP3 header [s]
+  int32_t num_declared_epochs;  //!< Number of epochs in the SP3 header
+  int32_t reserved;             //!< Reserved for alignment
+  uint64_t num_epochs;          //!< Number of the epochs
+  uint64_t num_records;         //!< Number of the records
+};
+
+/**
+ * @struct GnssEphemerisEpoch
+ * @brief Epoch of the SP3 file
+ */
+struct GnssEphemerisEpoch {
+  double unix_time;   //!< Unix time (UTC) [s]
+  double julian_day;  //!< Julian day
+};
+
+/**
+ * @struct GnssEphemerisRecord
+ * @brief Record of a GNSS satellite at an epoch
+ */
+struct GnssEphemerisRecord {
+  double unix_time;     //!< Unix time (UTC) [s]
+  int32_t epoch_index;  //!< Index of the epoch in the SP3 file (-1 for the clock RINEX file)
+  char sat_id[4];       //!< GNSS satellite number (e.g. "G01") with the null terminator
+  double values[4];     //!< SP3: position x, y, z [km] and clock [us]. Clock RINEX: clock bias [s] and zeros.
+};
+
+/**
+ * @class GnssEphemerisFile
+ * @brief Class to load the records of a GNSS ephemeris file (SP3 or clock RINEX) with the binary cache
+ * @details The source file is parsed line by line into the typed records without storing the lines. When the cache is enabled, the records are
+ * written into the binary cache and the following runs map the cache into the memory instead of parsing the source file.
+ */
+class GnssEphemerisFile {
+ public:
+  /**
+   * @fn GnssEphemerisFile
+   * @brief Constructor. The program exits when the source file is not found.
+   * @param [in] file_path: Path to the source file
+   * @param [in] format: Format of the source file
+   * @param [in] is_cache_enabled: Use and write the binary cache
+   */
+  GnssEphemerisFile(const std::string& file_path, const GnssEphemerisFormat format, const bool is_cache_enabled);
+
+  /**
+   * @fn GetTimeInterval
+   * @brief Return the epoch interval in the SP3 header [s]
+   */
+  inline double GetTimeInterval() const { return header_.time_interval_s; }
+  /**
+   * @fn GetNumOfDeclaredEpochs
+   * @brief Return the number of epochs in the SP3 header
+   */
+  inline int GetNumOfDeclaredEpochs() const { return header_.num_declared_epochs; }
+  /**
+   * @fn GetNumOfEpochs
+   * @brief Return the number of the epochs
+   */
+  inline size_t GetNumOfEpochs() const { return (size_t)header_.num_epochs; }
+  /**
+   * @fn GetEpochs
+   * @brief Return the epochs
+   */
+  const GnssEphemerisEpoch* GetEpochs() const;
+  /**
+   * @fn GetNumOfRecords
+   * @brief Return the number of the records
+   */
+  inline size_t GetNumOfRecords() const { return (size_t)header_.num_records; }
+  /**
+   * @fn GetRecords
+   * @brief Return the records sorted by the unix time
+   */
+  const GnssEphemerisRecord* GetRecords() const;
+  /**
+   * @fn GetRecordRange
+   * @brief Return the index range [first, second) of the records within the time window
+   * @param [in] start_unix_time: Start of the time window [s]
+   * @param [in] end_unix_time: End of the time window [s]
+   */
+  std::pair<size_t, size_t> GetRecordRange(const double start_unix_time, const double end_unix_time) const;
+  /**
+   * @fn IsLoadedFromCache
+   * @brief Return true when the records are loaded from the binary cache
+   */
+  inline bool IsLoadedFromCache() const { return is_loaded_from_cache_; }
+
+  /**
+   * @fn CalcUnixTime
+   * @brief Calculate the unix time from the UTC calendar without the time zone
+   */
+  static double CalcUnixTime(const int year, const int month, const int day, const int hour, const int minute, const double second);
+
+  static const uint32_t kCacheVersion = 1;  //!< Version of the cache format
+
+ private:
+  GnssEphemerisCacheHeader header_;                  //!< Header
+  std::vector<GnssEphemerisEpoch> epoch_storage_;    //!< Epochs parsed from the source file
+  std::vector<GnssEphemerisRecord> record_storage_;  //!< Records parsed from the source file
+  std::shared_ptr<const char> cache_mapping_;        //!< Mapped cache file shared by the copies
+  bool is_loaded_from_cache_ = false;                //!< Flag of the records loaded from the cache
+
+  /**
+   * @fn ParseSp3
+   * @brief Parse the SP3 file
+   * @return False when the file is not opened
+   */
+  bool ParseSp3(const std::string& file_path);
+  /**
+   * @fn ParseClk
+   * @brief Parse the clock RINEX file
+   * @return False when the file is not opened
+   */
+  bool ParseClk(const std::string& file_path);
+  /**
+   * @fn LoadCache
+   * @brief Map the cache file when it matches the source file
+   * @return True when the cache is loaded
+   */
+  bool LoadCache(const std::string& cache_path);
+  /**
+   * @fn WriteCache
+   * @brief Write the cache file. The cache is written into a temporary file and renamed for the other processes reading it.
+   */
+  void WriteCache(const std::string& cache_path) const;
+};
+
+#endif  //__gnss_ephemeris_file_h__
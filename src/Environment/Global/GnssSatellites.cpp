@@ -14,7 +14,6 @@
 #include <Library/utils/Macros.hpp>
 #include <algorithm>
 #include <iostream>
-#include <sstream>
 #include <vector>
 
 const double nan99 = 999999.999999;
@@ -33,58 +32,27 @@ const int qzss_index_bias_ = beidou_index_bias_ + beidou_sat_num_;       //!< Bi
 
 const int all_sat_num_ = gps_sat_num_ + glonass_sat_num_ + galileo_sat_num_ + beidou_sat_num_ + qzss_sat_num_;  //<! Total number of GNSS satellites
 
-using namespace std;
-
-/**
- * @fn initilized_tm
- * @brief Initialize time as calendar expression
- */
-tm* initilized_tm() {
-  tm* time_tm = (tm*)malloc(sizeof(tm));
-
-  time_tm->tm_year = 0;
-  time_tm->tm_mon = 0;
-  time_tm->tm_mday = 0;
-  time_tm->tm_hour = 0;
-  time_tm->tm_min = 0;
-  time_tm->tm_sec = 0;
-
-  time_tm->tm_isdst = 0;
-  time_tm->tm_yday = 0;
-  time_tm->tm_wday = 0;
-
-#ifndef WIN32
-  time_tm->tm_zone = NULL;
-  time_tm->tm_gmtoff = 0;
-#endif
+const double trigonometric_angular_frequency_rad_s_ = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  //!< Coefficient of a day long
 
-  return time_tm;
-}
+using namespace std;
 
 /**
- * @fn get_unixtime_from_timestamp_line
- * @brief Calculate unix time from calendar expression
- * @param [in] s: Time as calendar expression
- * @return Unix time
+ * @fn GetRecordRangeInWindow
+ * @brief Return the index range of the records within the simulation time window with the margin for the interpolation
+ * @param [in] file: GNSS ephemeris file
+ * @param [in] sim_unix_time_period: Start and end unix time of the simulation
+ * @param [in] interpolation_number: Interpolation number
  */
-double get_unixtime_from_timestamp_line(std::vector<string>& s) {
-  tm* time_tm = initilized_tm();
-  time_tm->tm_year = stoi(s.at(1)) - 1900;
-  time_tm->tm_mon = stoi(s.at(2)) - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
-  time_tm->tm_mday = stoi(s.at(3));
-  time_tm->tm_hour = stoi(s.at(4));
-  time_tm->tm_min = stoi(s.at(5));
-  time_tm->tm_sec = (int)(stod(s.at(6)) + 1e-4);  // for the numerical error, plus 1e-4 (tm_sec is to be int)
-  double unix_time = (double)mktime(time_tm);
-  std::free(time_tm);
-
-  return unix_time;
+static pair<size_t, size_t> GetRecordRangeInWindow(const GnssEphemerisFile& file, const pair<double, double> sim_unix_time_period,
+                                                   const int interpolation_number) {
+  const double margin_s = (interpolation_number + 4) * file.GetTimeInterval();
+  return file.GetRecordRange(sim_unix_time_period.first - margin_s, sim_unix_time_period.second + margin_s);
 }
 
 template <size_t N>
 Vector<N> GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<Vector<N>>& values, double time) const {
   int n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
+  double w = trigonometric_angular_frequency_rad_s_;
   Vector<N> res(0.0);
 
   for (int i = 0; i < n; ++i) {
@@ -103,7 +71,7 @@ Vector<N> GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& t
 
 double GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
   int n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
+  double w = trigonometric_angular_frequency_rad_s_;
   double res = 0.0;
 
   for (int i = 0; i < n; ++i) {
@@ -222,7 +190,40 @@ bool GnssSat_coordinate::GetWhetherValid(int sat_id) const {
   return validate_.at(sat_id);
 }
 
-pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int interpolation_method, int interpolation_number, UR_KINDS ur_flag) {
+bool GnssSat_coordinate::IsInterpolationNeeded(const int sat_id) const {
+  if (!validate_.at(sat_id) || interpolated_count_.at(sat_id) == update_count_) return false;
+  interpolated_count_.at(sat_id) = update_count_;
+  return true;
+}
+
+void GnssSat_coordinate::SaveWindowState(CheckpointWriter& writer) const {
+  writer.Write(now_unix_time_);
+  writer.Write((uint64_t)update_count_);
+  writer.Write((uint64_t)validate_.size());
+  for (const bool validate : validate_) writer.Write(validate);
+  writer.Write(nearest_index_);
+  writer.Write(time_period_);
+}
+
+void GnssSat_coordinate::LoadWindowState(CheckpointReader& reader) {
+  uint64_t update_count = 0;
+  reader.Read(now_unix_time_);
+  reader.Read(update_count);
+  if (!reader.ReadSize(validate_.size(), "GNSS satellites")) return;
+  for (size_t sat_id = 0; sat_id < validate_.size(); sat_id++) {
+    bool validate = false;
+    reader.Read(validate);
+    validate_.at(sat_id) = validate;
+  }
+  reader.Read(nearest_index_);
+  reader.Read(time_period_);
+  update_count_ = (size_t)update_count;
+  // The satellites are interpolated again at the first read
+  interpolated_count_.assign(all_sat_num_, 0);
+}
+
+pair<double, double> GnssSat_position::Init(vector<GnssEphemerisFile>& file, int interpolation_method, int interpolation_number, UR_KINDS ur_flag,
+                                            pair<double, double> sim_unix_time_period) {
   UNUSED(interpolation_method);
 
   interpolation_number_ = interpolation_number;
@@ -236,117 +237,75 @@ pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int in
   double start_unix_time = 1e16;
   double end_unix_time = 0;
 
-  // Get Header Info
   for (int page = 0; page < (int)file.size(); ++page) {
-    int num_of_time_stamps = 0;
-    int num_of_sat = 0;
-    int line;
-    for (line = 0; line < 3; ++line) {
-      istringstream iss{file.at(page).at(line)};
-
-      if (line == 0) {
-        // in seventh line, there is time stamps
-        // http://epncb.oma.be/ftp/data/format/sp3c.txt
-        for (int i = 0; i < 7; ++i) {
-          // how many time stamps are written?
-          string each;
-          iss >> each;
-          if (i == 6) num_of_time_stamps = stoi(each);
-        }
-      } else if (line == 1) {
-        for (int i = 0; i < 4; ++i) {
-          string each;
-          iss >> each;
-          if (i == 3) time_interval_ = stod(each);
-        }
-      } else if (line == 2) {
-        for (int i = 0; i < 2; ++i) {
-          string each;
-          iss >> each;
-          if (i == 1) num_of_sat = stoi(each);
-        }
-      }
-    }
-
-    line = 3;
-    while (file.at(page).at(line).front() != '*') ++line;
+    time_interval_ = file.at(page).GetTimeInterval();
 
-    int start_line, end_line;
+    int start_epoch, end_epoch;
     if (ur_flag == UR_NOT_UR) {
-      start_line = line;
-      end_line = line + (num_of_sat + 1) * num_of_time_stamps;
+      start_epoch = 0;
+      end_epoch = file.at(page).GetNumOfDeclaredEpochs();
     } else {
       int offset = (int)ur_flag - (int)UR_OBSERVE1;
-      start_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
-      end_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * (offset + 1);
+      start_epoch = file.at(page).GetNumOfDeclaredEpochs() / 8 * offset;
+      end_epoch = file.at(page).GetNumOfDeclaredEpochs() / 8 * (offset + 1);
     }
 
-    double unix_time = 0;
+    const GnssEphemerisEpoch* epochs = file.at(page).GetEpochs();
+    const GnssEphemerisRecord* records = file.at(page).GetRecords();
+    auto range = GetRecordRangeInWindow(file.at(page), sim_unix_time_period, interpolation_number_);
+
+    int epoch_index = -1;
     double cos_ = 0.0;
     double sin_ = 0.0;
-    for (int i = 0; i < end_line - start_line; ++i) {
-      line = i + start_line;
-
-      istringstream iss{file.at(page).at(line)};
-      vector<string> s;
-      if (i % (num_of_sat + 1) == 0) {
-        for (int j = 0; j < 7; ++j) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-
-        unix_time = get_unixtime_from_timestamp_line(s);
-        double jd;
-        jday(stoi(s.at(1)), stoi(s.at(2)), stoi(s.at(3)), stoi(s.at(4)), stoi(s.at(5)), stod(s.at(6)), jd);
-        double gs_time_ = gstime(jd);
+    for (size_t i = range.first; i < range.second; ++i) {
+      const GnssEphemerisRecord& record = records[i];
+      if (record.epoch_index < start_epoch || record.epoch_index >= end_epoch) continue;
+
+      double unix_time = record.unix_time;
+      if (record.epoch_index != epoch_index) {
+        epoch_index = record.epoch_index;
+        double gs_time_ = gstime(epochs[epoch_index].julian_day);
         cos_ = cos(gs_time_);
         sin_ = sin(gs_time_);
 
         start_unix_time = std::min(start_unix_time, unix_time);
         end_unix_time = std::max(end_unix_time, unix_time);
-      } else {
-        for (int j = 0; j < 5; ++j) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-        int sat_id = GetIndexFromID(s.front());
-
-        bool available_flag = true;
-        libra::Vector<3> ecef_position_m(0.0);
-        for (int j = 0; j < 3; ++j) {
-          if (std::abs(stod(s.at(j + 1)) - nan99) < 1.0) {
-            available_flag = false;
-            break;
-          } else {
-            ecef_position_m(j) = stod(s.at(j + 1));
-          }
+      }
+      int sat_id = GetIndexFromID(record.sat_id);
+
+      bool available_flag = true;
+      libra::Vector<3> ecef_position_m(0.0);
+      for (int j = 0; j < 3; ++j) {
+        if (std::abs(record.values[j] - nan99) < 1.0) {
+          available_flag = false;
+          break;
+        } else {
+          ecef_position_m(j) = record.values[j];
         }
-        if (!available_flag) continue;
+      }
+      if (!available_flag) continue;
 
-        //[km] -> [m]
-        ecef_position_m *= 1000.0;
+      //[km] -> [m]
+      ecef_position_m *= 1000.0;
 
-        libra::Vector<3> eci_position(0.0);
+      libra::Vector<3> eci_position(0.0);
 
-        double x = ecef_position_m(0);
-        double y = ecef_position_m(1);
-        double z = ecef_position_m(2);
+      double x = ecef_position_m(0);
+      double y = ecef_position_m(1);
+      double z = ecef_position_m(2);
 
-        eci_position(0) = cos_ * x - sin_ * y;
-        eci_position(1) = sin_ * x + cos_ * y;
-        eci_position(2) = z;
+      eci_position(0) = cos_ * x - sin_ * y;
+      eci_position(1) = sin_ * x + cos_ * y;
+      eci_position(2) = z;
 
-        if (!unixtime_vector_.at(sat_id).empty() && std::abs(unix_time - unixtime_vector_.at(sat_id).back()) < 1.0) {
-          unixtime_vector_.at(sat_id).back() = unix_time;
-          gnss_sat_table_ecef_.at(sat_id).back() = ecef_position_m;
-          gnss_sat_table_eci_.at(sat_id).back() = eci_position;
-        } else {
-          unixtime_vector_.at(sat_id).emplace_back(unix_time);
-          gnss_sat_table_ecef_.at(sat_id).emplace_back(ecef_position_m);
-          gnss_sat_table_eci_.at(sat_id).emplace_back(eci_position);
-        }
+      if (!unixtime_vector_.at(sat_id).empty() && std::abs(unix_time - unixtime_vector_.at(sat_id).back()) < 1.0) {
+        unixtime_vector_.at(sat_id).back() = unix_time;
+        gnss_sat_table_ecef_.at(sat_id).back() = ecef_position_m;
+        gnss_sat_table_eci_.at(sat_id).back() = eci_position;
+      } else {
+        unixtime_vector_.at(sat_id).emplace_back(unix_time);
+        gnss_sat_table_ecef_.at(sat_id).emplace_back(ecef_position_m);
+        gnss_sat_table_eci_.at(sat_id).emplace_back(eci_position);
       }
     }
   }
@@ -356,6 +315,10 @@ pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int in
 
 void GnssSat_position::SetUp(const double start_unix_time, const double step_sec) {
   step_sec_ = step_sec;
+  now_unix_time_ = start_unix_time;
+  update_count_++;
+  interpolation_.resize(all_sat_num_);
+  interpolated_count_.assign(all_sat_num_, 0);
 
   gnss_sat_ecef_.assign(all_sat_num_, Vector<3>(0.0));
   gnss_sat_eci_.assign(all_sat_num_, Vector<3>(0.0));
@@ -402,6 +365,7 @@ void GnssSat_position::SetUp(const double start_unix_time, const double step_sec
       ecef_.at(sat_id).push_back(gnss_sat_table_ecef_.at(sat_id).at(now_index));
       eci_.at(sat_id).push_back(gnss_sat_table_eci_.at(sat_id).at(now_index));
     }
+    interpolation_.at(sat_id).SetNodes(time_period_.at(sat_id), libra::InterpolationBasis::kTrigonometric, trigonometric_angular_frequency_rad_s_);
     if ((int)time_period_.at(sat_id).size() != interpolation_number_) {
       validate_.at(sat_id) = false;
       continue;
@@ -414,18 +378,13 @@ void GnssSat_position::SetUp(const double start_unix_time, const double step_sec
     } else {
       validate_.at(sat_id) = true;
     }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error, plus 1e-4
-      gnss_sat_ecef_.at(sat_id) = gnss_sat_table_ecef_.at(sat_id).at(index);
-      gnss_sat_eci_.at(sat_id) = gnss_sat_table_eci_.at(sat_id).at(index);
-    } else {
-      gnss_sat_ecef_.at(sat_id) = TrigonometricInterpolation(time_period_.at(sat_id), ecef_.at(sat_id), start_unix_time);
-      gnss_sat_eci_.at(sat_id) = TrigonometricInterpolation(time_period_.at(sat_id), eci_.at(sat_id), start_unix_time);
-    }
   }
 }
 
 void GnssSat_position::Update(const double now_unix_time) {
+  now_unix_time_ = now_unix_time;
+  update_count_++;
+
   for (int sat_id = 0; sat_id < all_sat_num_; ++sat_id) {
     if (unixtime_vector_.at(sat_id).empty()) {
       validate_.at(sat_id) = false;
@@ -459,6 +418,8 @@ void GnssSat_position::Update(const double now_unix_time) {
           ecef_.at(sat_id).push_back(gnss_sat_table_ecef_.at(sat_id).at(now_index));
           eci_.at(sat_id).push_back(gnss_sat_table_eci_.at(sat_id).at(now_index));
         }
+        interpolation_.at(sat_id).SetNodes(time_period_.at(sat_id), libra::InterpolationBasis::kTrigonometric,
+                                           trigonometric_angular_frequency_rad_s_);
       }
     }
     double nearest_unix_time = unixtime_vector_.at(sat_id).at(index);
@@ -479,112 +440,103 @@ void GnssSat_position::Update(const double now_unix_time) {
     } else {
       validate_.at(sat_id) = true;
     }
+  }
+}
 
-    if (std::abs(now_unix_time - nearest_unix_time) < 1e-4) {  // for the numerical error, plus 1e-4
-      gnss_sat_ecef_.at(sat_id) = gnss_sat_table_ecef_.at(sat_id).at(index);
-      gnss_sat_eci_.at(sat_id) = gnss_sat_table_eci_.at(sat_id).at(index);
-    } else {
-      gnss_sat_ecef_.at(sat_id) = TrigonometricInterpolation(time_period_.at(sat_id), ecef_.at(sat_id), now_unix_time);
-      gnss_sat_eci_.at(sat_id) = TrigonometricInterpolation(time_period_.at(sat_id), eci_.at(sat_id), now_unix_time);
+void GnssSat_position::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("GnssSat_position");
+  SaveWindowState(writer);
+  writer.Write(ecef_);
+  writer.Write(eci_);
+}
+
+void GnssSat_position::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("GnssSat_position")) return;
+  LoadWindowState(reader);
+  reader.Read(ecef_);
+  reader.Read(eci_);
+  if (!reader.IsValid() || time_period_.size() != (size_t)all_sat_num_) return;
+  for (int sat_id = 0; sat_id < all_sat_num_; ++sat_id) {
+    interpolation_.at(sat_id).SetNodes(time_period_.at(sat_id), libra::InterpolationBasis::kTrigonometric, trigonometric_angular_frequency_rad_s_);
+  }
+}
+
+void GnssSat_position::Interpolate(const int sat_id) const {
+  std::lock_guard<std::mutex> lock(interpolation_mutex_);
+  if (!IsInterpolationNeeded(sat_id)) return;
+
+  int index = nearest_index_.at(sat_id);
+  if (std::abs(now_unix_time_ - unixtime_vector_.at(sat_id).at(index)) < 1e-4) {  // for the numerical error, plus 1e-4
+    gnss_sat_ecef_.at(sat_id) = gnss_sat_table_ecef_.at(sat_id).at(index);
+    gnss_sat_eci_.at(sat_id) = gnss_sat_table_eci_.at(sat_id).at(index);
+    return;
+  }
+
+  // The coefficients are shared by all components of the position in both frames
+  interpolation_.at(sat_id).CalcCoefficients(now_unix_time_, coefficients_);
+  libra::Vector<3> ecef_position(0.0), eci_position(0.0);
+  for (size_t k = 0; k < coefficients_.size(); ++k) {
+    for (int j = 0; j < 3; ++j) {
+      ecef_position(j) += coefficients_[k] * ecef_.at(sat_id)[k](j);
+      eci_position(j) += coefficients_[k] * eci_.at(sat_id)[k](j);
     }
   }
+  gnss_sat_ecef_.at(sat_id) = ecef_position;
+  gnss_sat_eci_.at(sat_id) = eci_position;
 }
 
 libra::Vector<3> GnssSat_position::GetSatEcef(int sat_id) const {
   if (sat_id >= all_sat_num_) return Vector<3>(0.0);
+  Interpolate(sat_id);
   return gnss_sat_ecef_.at(sat_id);
 }
 
 libra::Vector<3> GnssSat_position::GetSatEci(int sat_id) const {
   if (sat_id >= all_sat_num_) return Vector<3>(0.0);
+  Interpolate(sat_id);
   return gnss_sat_eci_.at(sat_id);
 }
 
-void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, int interpolation_number, UR_KINDS ur_flag,
-                         pair<double, double> unix_time_period) {
+void GnssSat_clock::Init(vector<GnssEphemerisFile>& file, string file_extension, int interpolation_number, UR_KINDS ur_flag,
+                         pair<double, double> sim_unix_time_period, pair<double, double> unix_time_period) {
   interpolation_number_ = interpolation_number;
   gnss_sat_clock_table_.resize(all_sat_num_);  // first vector size is the sat num
   unixtime_vector_.resize(all_sat_num_);
 
   if (file_extension == ".sp3") {
-    // Get Header Info
     for (int page = 0; page < (int)file.size(); ++page) {
-      int num_of_time_stamps = 0;
-      int num_of_sat = 0;
-      int line;
-      for (line = 0; line < 3; ++line) {
-        istringstream iss{file.at(page).at(line)};
-
-        if (line == 0) {
-          // in seventh line, there is time stamps
-          // http://epncb.oma.be/ftp/data/format/sp3c.txt
-          for (int i = 0; i < 7; ++i) {
-            // how many time stamps are written?
-            string each;
-            iss >> each;
-            if (i == 6) num_of_time_stamps = stoi(each);
-          }
-        } else if (line == 1) {
-          for (int i = 0; i < 4; ++i) {
-            string each;
-            iss >> each;
-            if (i == 3) time_interval_ = stod(each);
-          }
-        } else if (line == 2) {
-          for (int i = 0; i < 2; ++i) {
-            string each;
-            iss >> each;
-            if (i == 1) num_of_sat = stoi(each);
-          }
-        }
-      }
+      time_interval_ = file.at(page).GetTimeInterval();
 
-      line = 3;
-      while (file.at(page).at(line).front() != '*') ++line;
-
-      int start_line, end_line;
+      int start_epoch, end_epoch;
       if (ur_flag == UR_NOT_UR) {
-        start_line = line;
-        end_line = line + (num_of_sat + 1) * num_of_time_stamps;
+        start_epoch = 0;
+        end_epoch = file.at(page).GetNumOfDeclaredEpochs();
       } else {
         int offset = (int)ur_flag - (int)UR_OBSERVE1;
-        start_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
-        end_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * (offset + 1);
+        start_epoch = file.at(page).GetNumOfDeclaredEpochs() / 8 * offset;
+        end_epoch = file.at(page).GetNumOfDeclaredEpochs() / 8 * (offset + 1);
       }
 
-      double unix_time = 0;
-      for (int i = 0; i < end_line - start_line; ++i) {
-        line = i + start_line;
-
-        istringstream iss{file.at(page).at(line)};
-        vector<string> s;
-        if (i % (num_of_sat + 1) == 0) {
-          for (int j = 0; j < 7; ++j) {
-            string tmp;
-            iss >> tmp;
-            s.push_back(tmp);
-          }
-          unix_time = get_unixtime_from_timestamp_line(s);
+      const GnssEphemerisRecord* records = file.at(page).GetRecords();
+      auto range = GetRecordRangeInWindow(file.at(page), sim_unix_time_period, interpolation_number_);
+      for (size_t i = range.first; i < range.second; ++i) {
+        const GnssEphemerisRecord& record = records[i];
+        if (record.epoch_index < start_epoch || record.epoch_index >= end_epoch) continue;
+
+        double unix_time = record.unix_time;
+        int sat_id = GetIndexFromID(record.sat_id);
+
+        double clock = record.values[3];
+        if (std::abs(clock - nan99) < 1.0) continue;
+
+        // in the file, clock bias is expressed in [micro second], so by multiplying by the speed_of_light & 1e-6, they are converted to [m]
+        clock *= (environment::speed_of_light_m_s * 1e-6);
+        if (!unixtime_vector_.at(sat_id).empty() && std::abs(unix_time - unixtime_vector_.at(sat_id).back()) < 1.0) {
+          unixtime_vector_.at(sat_id).back() = unix_time;
+          gnss_sat_clock_table_.at(sat_id).back() = clock;
         } else {
-          for (int j = 0; j < 5; ++j) {
-            string tmp;
-            iss >> tmp;
-            s.push_back(tmp);
-          }
-          int sat_id = GetIndexFromID(s.front());
-
-          double clock = stod(s.at(4));
-          if (std::abs(clock - nan99) < 1.0) continue;
-
-          // in the file, clock bias is expressed in [micro second], so by multiplying by the speed_of_light & 1e-6, they are converted to [m]
-          clock *= (environment::speed_of_light_m_s * 1e-6);
-          if (!unixtime_vector_.at(sat_id).empty() && std::abs(unix_time - unixtime_vector_.at(sat_id).back()) < 1.0) {
-            unixtime_vector_.at(sat_id).back() = unix_time;
-            gnss_sat_clock_table_.at(sat_id).back() = clock;
-          } else {
-            unixtime_vector_.at(sat_id).push_back(unix_time);
-            gnss_sat_clock_table_.at(sat_id).emplace_back(clock);
-          }
+          unixtime_vector_.at(sat_id).push_back(unix_time);
+          gnss_sat_clock_table_.at(sat_id).emplace_back(clock);
         }
       }
     }
@@ -596,45 +548,28 @@ void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, in
     time_interval_ = 1e9;
 
     for (int page = 0; page < (int)file.size(); ++page) {
+      if (file.at(page).GetNumOfRecords() == 0) continue;
+      const GnssEphemerisRecord* records = file.at(page).GetRecords();
+
+      // The position period is already limited within the simulation time window
       double start_unix_time, end_unix_time;
       if (ur_flag == UR_NOT_UR) {
         start_unix_time = unix_time_period.first;
         end_unix_time = unix_time_period.second + 30;
       } else {
-        start_unix_time = -1;
-        end_unix_time = 0;
-      }
-      for (int line = 0; line < (int)file.at(page).size(); ++line) {
-        if (file.at(page).at(line).substr(0, 3) != "AS ") continue;
-
-        istringstream iss{file.at(page).at(line)};
-        vector<string> s;
-        for (int i = 0; i < 11; ++i) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-
-        tm* time_tm = initilized_tm();
-        time_tm->tm_year = stoi(s.at(2)) - 1900;
-        time_tm->tm_mon = stoi(s.at(3)) - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
-        time_tm->tm_mday = stoi(s.at(4));
-        time_tm->tm_hour = stoi(s.at(5));
-        time_tm->tm_min = stoi(s.at(6));
-        time_tm->tm_sec = (int)(stod(s.at(7)) + 1e-4);  // for the numerical error, plus 1e-4. tm_sec is to be int
-        double unix_time = (double)mktime(time_tm);
         const double interval = 6 * 60 * 60;
-        if (start_unix_time < 0) {
-          start_unix_time = unix_time + (ur_flag - UR_OBSERVE1) * interval;
-          end_unix_time = start_unix_time + interval;
-        }
-
-        std::free(time_tm);
+        start_unix_time = records[0].unix_time + (ur_flag - UR_OBSERVE1) * interval;
+        end_unix_time = start_unix_time + interval;
+      }
 
-        int sat_id = GetIndexFromID(s.at(1));
-        double clock_bias = stod(s.at(9)) * environment::speed_of_light_m_s;  // [s] -> [m]
-        if (start_unix_time - unix_time > 1e-4) continue;                     // for the numerical error
+      auto range = file.at(page).GetRecordRange(start_unix_time - 1e-4, end_unix_time);  // for the numerical error
+      for (size_t i = range.first; i < range.second; ++i) {
+        const GnssEphemerisRecord& record = records[i];
+        double unix_time = record.unix_time;
         if (end_unix_time - unix_time < 1e-4) break;
+
+        int sat_id = GetIndexFromID(record.sat_id);
+        double clock_bias = record.values[0] * environment::speed_of_light_m_s;                                         // [s] -> [m]
         if (!unixtime_vector_.at(sat_id).empty() && std::abs(unix_time - unixtime_vector_.at(sat_id).back()) < 1e-4) {  // for the numerical error
           unixtime_vector_.at(sat_id).back() = unix_time;
           gnss_sat_clock_table_.at(sat_id).back() = clock_bias;
@@ -650,6 +585,10 @@ void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, in
 
 void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
   step_sec_ = step_sec;
+  now_unix_time_ = start_unix_time;
+  update_count_++;
+  interpolation_.resize(all_sat_num_);
+  interpolated_count_.assign(all_sat_num_, 0);
 
   gnss_sat_clock_.resize(all_sat_num_);
   validate_.assign(all_sat_num_, false);
@@ -693,6 +632,7 @@ void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
       time_period_.at(sat_id).push_back(unixtime_vector_.at(sat_id).at(now_index));
       clock_bias_.at(sat_id).push_back(gnss_sat_clock_table_.at(sat_id).at(now_index));
     }
+    interpolation_.at(sat_id).SetNodes(time_period_.at(sat_id), libra::InterpolationBasis::kLagrange);
 
     if ((int)time_period_.at(sat_id).size() != interpolation_number_) {
       validate_.at(sat_id) = false;
@@ -705,16 +645,13 @@ void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
     } else {
       validate_.at(sat_id) = true;
     }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error
-      gnss_sat_clock_.at(sat_id) = gnss_sat_clock_table_.at(sat_id).at(index);
-    } else {
-      gnss_sat_clock_.at(sat_id) = LagrangeInterpolation(time_period_.at(sat_id), clock_bias_.at(sat_id), start_unix_time);
-    }
   }
 }
 
 void GnssSat_clock::Update(const double now_unix_time) {
+  now_unix_time_ = now_unix_time;
+  update_count_++;
+
   for (int sat_id = 0; sat_id < all_sat_num_; ++sat_id) {
     if (unixtime_vector_.at(sat_id).empty()) {
       validate_.at(sat_id) = false;
@@ -746,6 +683,7 @@ void GnssSat_clock::Update(const double now_unix_time) {
           time_period_.at(sat_id).push_back(unixtime_vector_.at(sat_id).at(now_index));
           clock_bias_.at(sat_id).push_back(gnss_sat_clock_table_.at(sat_id).at(now_index));
         }
+        interpolation_.at(sat_id).SetNodes(time_period_.at(sat_id), libra::InterpolationBasis::kLagrange);
       }
     }
     if ((int)time_period_.at(sat_id).size() != interpolation_number_) {
@@ -767,26 +705,54 @@ void GnssSat_clock::Update(const double now_unix_time) {
     } else {
       validate_.at(sat_id) = true;
     }
+  }
+}
 
-    if (std::abs(now_unix_time - nearest_unix_time) < 1e-4) {
-      gnss_sat_clock_.at(sat_id) = gnss_sat_clock_table_.at(sat_id).at(index);
-    } else {
-      gnss_sat_clock_.at(sat_id) = LagrangeInterpolation(time_period_.at(sat_id), clock_bias_.at(sat_id), now_unix_time);
-    }
+void GnssSat_clock::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("GnssSat_clock");
+  SaveWindowState(writer);
+  writer.Write(clock_bias_);
+}
+
+void GnssSat_clock::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("GnssSat_clock")) return;
+  LoadWindowState(reader);
+  reader.Read(clock_bias_);
+  if (!reader.IsValid() || time_period_.size() != (size_t)all_sat_num_) return;
+  for (int sat_id = 0; sat_id < all_sat_num_; ++sat_id) {
+    interpolation_.at(sat_id).SetNodes(time_period_.at(sat_id), libra::InterpolationBasis::kLagrange);
+  }
+}
+
+void GnssSat_clock::Interpolate(const int sat_id) const {
+  std::lock_guard<std::mutex> lock(interpolation_mutex_);
+  if (!IsInterpolationNeeded(sat_id)) return;
+
+  int index = nearest_index_.at(sat_id);
+  if (std::abs(now_unix_time_ - unixtime_vector_.at(sat_id).at(index)) < 1e-4) {  // for the numerical error
+    gnss_sat_clock_.at(sat_id) = gnss_sat_clock_table_.at(sat_id).at(index);
+    return;
   }
+
+  interpolation_.at(sat_id).CalcCoefficients(now_unix_time_, coefficients_);
+  double clock = 0.0;
+  for (size_t k = 0; k < coefficients_.size(); ++k) clock += coefficients_[k] * clock_bias_.at(sat_id)[k];
+  gnss_sat_clock_.at(sat_id) = clock;
 }
 
 double GnssSat_clock::GetSatClock(int sat_id) const {
   if (sat_id >= all_sat_num_) return 0.0;
+  Interpolate(sat_id);
   return gnss_sat_clock_.at(sat_id);
 }
 
 GnssSat_Info::GnssSat_Info() {}
-void GnssSat_Info::Init(vector<vector<string>>& position_file, int position_interpolation_method, int position_interpolation_number,
-                        UR_KINDS position_ur_flag, vector<vector<string>>& clock_file, string clock_file_extension, int clock_interpolation_number,
-                        UR_KINDS clock_ur_flag) {
-  auto unix_time_period = position_.Init(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag);
-  clock_.Init(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period);
+void GnssSat_Info::Init(vector<GnssEphemerisFile>& position_file, int position_interpolation_method, int position_interpolation_number,
+                        UR_KINDS position_ur_flag, vector<GnssEphemerisFile>& clock_file, string clock_file_extension, int clock_interpolation_number,
+                        UR_KINDS clock_ur_flag, pair<double, double> sim_unix_time_period) {
+  auto unix_time_period =
+      position_.Init(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag, sim_unix_time_period);
+  clock_.Init(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, sim_unix_time_period, unix_time_period);
 }
 
 void GnssSat_Info::SetUp(const double start_unix_time, const double step_sec) {
@@ -799,6 +765,16 @@ void GnssSat_Info::Update(const double now_unix_time) {
   clock_.Update(now_unix_time);
 }
 
+void GnssSat_Info::SaveState(CheckpointWriter& writer) const {
+  position_.SaveState(writer);
+  clock_.SaveState(writer);
+}
+
+void GnssSat_Info::LoadState(CheckpointReader& reader) {
+  position_.LoadState(reader);
+  clock_.LoadState(reader);
+}
+
 int GnssSat_Info::GetNumOfSatellites() const {
   if (position_.GetNumOfSatellites() == clock_.GetNumOfSatellites()) {
     return position_.GetNumOfSatellites();
@@ -835,25 +811,26 @@ GnssSatellites::GnssSatellites(bool is_calc_enabled)
 
 bool GnssSatellites::IsCalcEnabled() const { return is_calc_enabled_; }
 
-void GnssSatellites::Init(vector<vector<string>>& true_position_file, int true_position_interpolation_method, int true_position_interpolation_number,
-                          UR_KINDS true_position_ur_flag,
+void GnssSatellites::Init(vector<GnssEphemerisFile>& true_position_file, int true_position_interpolation_method,
+                          int true_position_interpolation_number, UR_KINDS true_position_ur_flag,
 
-                          vector<vector<string>>& true_clock_file, string true_clock_file_extension, int true_clock_interpolation_number,
+                          vector<GnssEphemerisFile>& true_clock_file, string true_clock_file_extension, int true_clock_interpolation_number,
                           UR_KINDS true_clock_ur_flag,
 
-                          vector<vector<string>>& estimate_position_file, int estimate_position_interpolation_method,
+                          vector<GnssEphemerisFile>& estimate_position_file, int estimate_position_interpolation_method,
                           int estimate_position_interpolation_number, UR_KINDS estimate_position_ur_flag,
 
-                          vector<vector<string>>& estimate_clock_file, string estimate_clock_file_extension, int estimate_clock_interpolation_number,
-                          UR_KINDS estimate_clock_ur_flag) {
+                          vector<GnssEphemerisFile>& estimate_clock_file, string estimate_clock_file_extension,
+                          int estimate_clock_interpolation_number, UR_KINDS estimate_clock_ur_flag, pair<double, double> sim_unix_time_period) {
   true_info_.Init(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
 
-                  true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag);
+                  true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag, sim_unix_time_period);
 
   estimate_info_.Init(estimate_position_file, estimate_position_interpolation_method, estimate_position_interpolation_number,
                       estimate_position_ur_flag,
 
-                      estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+                      estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag,
+                      sim_unix_time_period);
 
   return;
 }
@@ -861,16 +838,8 @@ void GnssSatellites::Init(vector<vector<string>>& true_position_file, int true_p
 void GnssSatellites::SetUp(const SimTime* sim_time) {
   if (!IsCalcEnabled()) return;
 
-  tm* start_tm = initilized_tm();
-  start_tm->tm_year = sim_time->GetStartYear() - 1900;
-  start_tm->tm_mon = sim_time->GetStartMon() - 1;
-  start_tm->tm_mday = sim_time->GetStartDay();
-  start_tm->tm_hour = sim_time->GetStartHr();
-  start_tm->tm_min = sim_time->GetStartMin();
-  double start_sec = sim_time->GetStartSec();
-  start_tm->tm_sec = (int)start_sec;
-  double unix_time = (double)mktime(start_tm) + start_sec - floor(start_sec);
-  std::free(start_tm);
+  double unix_time = GnssEphemerisFile::CalcUnixTime(sim_time->GetStartYear(), sim_time->GetStartMon(), sim_time->GetStartDay(),
+                                                     sim_time->GetStartHr(), sim_time->GetStartMin(), sim_time->GetStartSec());
   true_info_.SetUp(unix_time, sim_time->GetStepSec());
   estimate_info_.SetUp(unix_time, sim_time->GetStepSec());
 
@@ -894,6 +863,26 @@ void GnssSatellites::Update(const SimTime* sim_time) {
   return;
 }
 
+void GnssSatellites::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("GnssSatellites");
+  writer.Write(IsCalcEnabled());
+  if (!IsCalcEnabled()) return;
+  writer.Write(start_unix_time_);
+  true_info_.SaveState(writer);
+  estimate_info_.SaveState(writer);
+}
+
+void GnssSatellites::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("GnssSatellites")) return;
+  bool is_calc_enabled = false;
+  reader.Read(is_calc_enabled);
+  if (reader.IsValid() && is_calc_enabled != IsCalcEnabled()) reader.SetError("GNSS calculation flag is different from the configuration");
+  if (!reader.IsValid() || !IsCalcEnabled()) return;
+  reader.Read(start_unix_time_);
+  true_info_.LoadState(reader);
+  estimate_info_.LoadState(reader);
+}
+
 int GnssSatellites::GetNumOfSatellites() const { return estimate_info_.GetNumOfSatellites(); }
 
 string GnssSatellites::GetIDFromIndex(int index) const { return estimate_info_.GetGnssSatPos().GetIDFromIndex(index); }
@@ -8,14 +8,17 @@
 
 #include <Interface/LogOutput/ILoggable.h>
 
+#include <Library/math/BarycentricInterpolation.hpp>
 #include <Library/math/Vector.hpp>
 #include <cmath>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <mutex>
 #include <vector>
 
+#include "GnssEphemerisFile.h"
 #include "SimTime.h"
 
 extern const double nan99;  //!< Not at Number TODO: Should be moved to another place
@@ -82,6 +85,16 @@ class GnssSat_coordinate {
   bool GetWhetherValid(int sat_id) const;
 
  protected:
+  /**
+   * @fn SaveWindowState
+   * @brief Write the interpolation window and the validity of all satellites into the checkpoint
+   */
+  void SaveWindowState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadWindowState
+   * @brief Read the states written by SaveWindowState. The satellites are interpolated again when they are read.
+   */
+  void LoadWindowState(CheckpointReader& reader);
   /**
    * @fn TrigonometricInterpolation
    * @brief Interpolate with Trigonometric method
@@ -113,9 +126,24 @@ class GnssSat_coordinate {
   std::vector<bool> validate_;                        //!< List of whether the satellite is available at the time
   std::vector<int> nearest_index_;                    //!< Index list for update(in position, time_and_index_list_. in clock_bias, time_table_)
 
+  // Interpolation in the current step
+  std::vector<libra::BarycentricInterpolation> interpolation_;  //!< Barycentric weights of the window (time_period_) of each satellite
+  double now_unix_time_ = 0.0;                                  //!< Unix time of the current step
+  size_t update_count_ = 0;                                     //!< Count of SetUp and Update calls
+  mutable std::vector<size_t> interpolated_count_;              //!< update_count_ when each satellite is interpolated
+  mutable std::vector<double> coefficients_;                    //!< Buffer of the interpolation coefficients
+  mutable std::mutex interpolation_mutex_;                      //!< Mutex for the interpolation in the getters called from multiple spacecraft
+
   double step_sec_ = 0.0;         //!< Step width [sec]
   double time_interval_ = 0.0;    //!< Time interval
   int interpolation_number_ = 0;  //!< Interpolation number
+
+  /**
+   * @fn IsInterpolationNeeded
+   * @brief Return true when the satellite is valid and not interpolated in the current step, and mark it as interpolated
+   * @param [in] sat_id: Index of GNSS satellite
+   */
+  bool IsInterpolationNeeded(const int sat_id) const;
 };
 
 /**
@@ -132,13 +160,15 @@ class GnssSat_position : public GnssSat_coordinate {
   /**
    * @fn Init
    * @brief Initialize GNSS satellite position
-   * @param[in] file: File path for position calculation
+   * @param[in] file: Files for position calculation
    * @param[in] interpolation_method: Interpolation method for position calculation
    * @param[in] interpolation_number: Interpolation number for position calculation
    * @param[in] ur_flag: Ultra Rapid flag for position calculation
+   * @param[in] sim_unix_time_period: Start and end unix time of the simulation. Only the records around the period are loaded.
    * @return Start unix time and end unix time
    */
-  std::pair<double, double> Init(std::vector<std::vector<std::string>>& file, int interpolation_method, int interpolation_number, UR_KINDS ur_flag);
+  std::pair<double, double> Init(std::vector<GnssEphemerisFile>& file, int interpolation_method, int interpolation_number, UR_KINDS ur_flag,
+                                 std::pair<double, double> sim_unix_time_period);
 
   /**
    * @fn Setup
@@ -150,9 +180,20 @@ class GnssSat_position : public GnssSat_coordinate {
   /**
    * @fn Update
    * @brief Update GNSS satellite position information
+   * @note Only the interpolation window and the validity are updated. The position is interpolated when it is read in the step.
    * @param [in] now_unix_time: Current unix time
    */
   void Update(const double now_unix_time);
+  /**
+   * @fn SaveState
+   * @brief Write the interpolation window of the position into the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetSatEcef
@@ -168,14 +209,21 @@ class GnssSat_position : public GnssSat_coordinate {
   libra::Vector<3> GetSatEci(int sat_id) const;
 
  private:
-  std::vector<libra::Vector<3>> gnss_sat_ecef_;  //!< List of GNSS satellite position at specific time in the ECEF frame [m]
-  std::vector<libra::Vector<3>> gnss_sat_eci_;   //!< List of GNSS satellite position at specific time in the ECI frame [m]
+  mutable std::vector<libra::Vector<3>> gnss_sat_ecef_;  //!< List of GNSS satellite position at specific time in the ECEF frame [m]
+  mutable std::vector<libra::Vector<3>> gnss_sat_eci_;   //!< List of GNSS satellite position at specific time in the ECI frame [m]
 
   std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame [m]
   std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame [m]
 
   std::vector<std::vector<libra::Vector<3>>> ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
   std::vector<std::vector<libra::Vector<3>>> eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
+
+  /**
+   * @fn Interpolate
+   * @brief Interpolate the position of the satellite at the current step when it is not interpolated yet
+   * @param [in] sat_id: GNSS satellite ID defined in this class
+   */
+  void Interpolate(const int sat_id) const;
 };
 
 /**
@@ -192,13 +240,15 @@ class GnssSat_clock : public GnssSat_coordinate {
   /**
    * @fn Init
    * @brief Initialize GNSS satellite clock
-   * @param[in] ile: File path for clock calculation
+   * @param[in] file: Files for clock calculation
    * @param[in] file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] interpolation_number: Interpolation number for clock calculation
    * @param[in] ur_flag: Ultra Rapid flag for clock calculation
+   * @param[in] sim_unix_time_period: Start and end unix time of the simulation. Only the records around the period are loaded.
+   * @param[in] unix_time_period: Start and end unix time of the position
    */
-  void Init(std::vector<std::vector<std::string>>& file, std::string file_extension, int interpolation_number, UR_KINDS ur_flag,
-            std::pair<double, double> unix_time_period);
+  void Init(std::vector<GnssEphemerisFile>& file, std::string file_extension, int interpolation_number, UR_KINDS ur_flag,
+            std::pair<double, double> sim_unix_time_period, std::pair<double, double> unix_time_period);
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite clock information
@@ -209,9 +259,20 @@ class GnssSat_clock : public GnssSat_coordinate {
   /**
    * @fn Update
    * @brief Update GNSS satellite clock information
+   * @note Only the interpolation window and the validity are updated. The clock is interpolated when it is read in the step.
    * @param [in] now_unix_time: Current unix time
    */
   void Update(const double now_unix_time);
+  /**
+   * @fn SaveState
+   * @brief Write the interpolation window of the clock into the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader);
   /**
    * @fn GetSatClock
    * @brief Return GNSS satellite clock in distance expression [m]
@@ -220,9 +281,16 @@ class GnssSat_clock : public GnssSat_coordinate {
   double GetSatClock(int sat_id) const;
 
  private:
-  std::vector<double> gnss_sat_clock_;                     //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
+  mutable std::vector<double> gnss_sat_clock_;             //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
   std::vector<std::vector<double>> gnss_sat_clock_table_;  //!< Time series of clock bias of all GNSS satellites expressed in distance [m]
   std::vector<std::vector<double>> clock_bias_;  //!< Time series of clock bias of all GNSS satellites expressed in distance before interpolation [m]
+
+  /**
+   * @fn Interpolate
+   * @brief Interpolate the clock of the satellite at the current step when it is not interpolated yet
+   * @param [in] sat_id: GNSS satellite ID defined in this class
+   */
+  void Interpolate(const int sat_id) const;
 };
 
 /**
@@ -239,18 +307,19 @@ class GnssSat_Info {
   /**
    * @fn Init
    * @brief Initialize position and clock
-   * @param[in] position_file: File path for position calculation
+   * @param[in] position_file: Files for position calculation
    * @param[in] position_interpolation_method: Interpolation method for position calculation
    * @param[in] position_interpolation_number: Interpolation number for position calculation
    * @param[in] position_ur_flag: Ultra Rapid flag for position calculation
-   * @param[in] clock_file: File path for clock calculation
+   * @param[in] clock_file: Files for clock calculation
    * @param[in] clock_file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] clock_interpolation_number: Interpolation number for clock calculation
    * @param[in] clock_ur_flag: Ultra Rapid flag for clock calculation
+   * @param[in] sim_unix_time_period: Start and end unix time of the simulation
    */
-  void Init(std::vector<std::vector<std::string>>& position_file, int position_interpolation_method, int position_interpolation_number,
-            UR_KINDS position_ur_flag, std::vector<std::vector<std::string>>& clock_file, std::string clock_file_extension,
-            int clock_interpolation_number, UR_KINDS clock_ur_flag);
+  void Init(std::vector<GnssEphemerisFile>& position_file, int position_interpolation_method, int position_interpolation_number,
+            UR_KINDS position_ur_flag, std::vector<GnssEphemerisFile>& clock_file, std::string clock_file_extension, int clock_interpolation_number,
+            UR_KINDS clock_ur_flag, std::pair<double, double> sim_unix_time_period);
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite position and clock information
@@ -264,6 +333,16 @@ class GnssSat_Info {
    * @param [in] now_unix_time: Current unix time
    */
   void Update(const double now_unix_time);
+  /**
+   * @fn SaveState
+   * @brief Write the states of the position and the clock into the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetNumOfSatellites
@@ -334,12 +413,12 @@ class GnssSatellites : public ILoggable {
    * @brief Initialize function
    * @note Parameters are defined in GNSSSat_Info for true and estimated information
    */
-  void Init(std::vector<std::vector<std::string>>& true_position_file, int true_position_interpolation_method, int true_position_interpolation_number,
-            UR_KINDS true_position_ur_flag, std::vector<std::vector<std::string>>& true_clock_file, std::string true_clock_file_extension,
-            int true_clock_interpolation_number, UR_KINDS true_clock_ur_flag, std::vector<std::vector<std::string>>& estimate_position_file,
+  void Init(std::vector<GnssEphemerisFile>& true_position_file, int true_position_interpolation_method, int true_position_interpolation_number,
+            UR_KINDS true_position_ur_flag, std::vector<GnssEphemerisFile>& true_clock_file, std::string true_clock_file_extension,
+            int true_clock_interpolation_number, UR_KINDS true_clock_ur_flag, std::vector<GnssEphemerisFile>& estimate_position_file,
             int estimate_position_interpolation_method, int estimate_position_interpolation_number, UR_KINDS estimate_position_ur_flag,
-            std::vector<std::vector<std::string>>& estimate_clock_file, std::string estimate_clock_file_extension,
-            int estimate_clock_interpolation_number, UR_KINDS estimate_clock_ur_flag);
+            std::vector<GnssEphemerisFile>& estimate_clock_file, std::string estimate_clock_file_extension, int estimate_clock_interpolation_number,
+            UR_KINDS estimate_clock_ur_flag, std::pair<double, double> sim_unix_time_period);
   /**
    * @fn IsCalcEnabled
    * @brief Return calculated enabled flag
@@ -358,6 +437,16 @@ class GnssSatellites : public ILoggable {
    * @param [in] sim_time: Simulation time information
    */
   void Update(const SimTime* sim_time);
+  /**
+   * @fn SaveState
+   * @brief Write the states of the true and estimated information into the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetIndexFromID
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <queue>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -41,24 +42,185 @@ bool HipparcosCatalogue::ReadContents(const string& filename, const char delimit
     streamline >> hipdata.hip_num >> hipdata.vmag >> hipdata.ra >> hipdata.de;
 
     if (hipdata.vmag > max_magnitude_) {
-      return true;
+      break;
     }  // Don't read stars darker than max_magnitude
     hip_catalogue.push_back(hipdata);
   }
 
+  BuildIndex();
   return true;
 }
 
-libra::Vector<3> HipparcosCatalogue::GetStarDir_i(int rank) const {
-  libra::Vector<3> position;
-  double ra = GetRA(rank) * libra::pi / 180;
-  double de = GetDE(rank) * libra::pi / 180;
+void HipparcosCatalogue::BuildIndex() {
+  const int num_of_stars = hip_catalogue.size();
+  const int num_of_cells = 6 * kGridSize * kGridSize;
 
-  position[0] = cos(ra) * cos(de);
-  position[1] = sin(ra) * cos(de);
-  position[2] = sin(de);
+  star_dir_i_.resize(num_of_stars);
+  for (int rank = 0; rank < num_of_stars; rank++) {
+    double ra = GetRA(rank) * libra::pi / 180;
+    double de = GetDE(rank) * libra::pi / 180;
 
-  return position;
+    star_dir_i_[rank][0] = cos(ra) * cos(de);
+    star_dir_i_[rank][1] = sin(ra) * cos(de);
+    star_dir_i_[rank][2] = sin(de);
+  }
+
+  // Counting sort by the cell. The ranks in each cell stay in ascending order.
+  vector<int> cell_ids(num_of_stars);
+  cell_offsets_.assign(num_of_cells + 1, 0);
+  for (int rank = 0; rank < num_of_stars; rank++) {
+    cell_ids[rank] = CalcCellId(star_dir_i_[rank]);
+    cell_offsets_[cell_ids[rank] + 1]++;
+  }
+  for (int cell = 0; cell < num_of_cells; cell++) {
+    cell_offsets_[cell + 1] += cell_offsets_[cell];
+  }
+  cell_ranks_.resize(num_of_stars);
+  vector<int> next_position(cell_offsets_.begin(), cell_offsets_.end() - 1);
+  for (int rank = 0; rank < num_of_stars; rank++) {
+    cell_ranks_[next_position[cell_ids[rank]]++] = rank;
+  }
+
+  // Bounding circle of each cell. The cell edges are great circles, so the farthest point from the center is one of the corners.
+  const double step_rad = libra::pi_2 / kGridSize;
+  cell_center_dir_.resize(num_of_cells);
+  cell_radius_rad_.resize(num_of_cells);
+  for (int face = 0; face < 6; face++) {
+    for (int iu = 0; iu < kGridSize; iu++) {
+      for (int iv = 0; iv < kGridSize; iv++) {
+        const int cell = (face * kGridSize + iu) * kGridSize + iv;
+        const double u_min_rad = -libra::pi_2 / 2.0 + iu * step_rad;
+        const double v_min_rad = -libra::pi_2 / 2.0 + iv * step_rad;
+        libra::Vector<3> center = CalcCellDirection(face, u_min_rad + step_rad / 2.0, v_min_rad + step_rad / 2.0);
+        double radius_rad = 0.0;
+        for (int corner = 0; corner < 4; corner++) {
+          libra::Vector<3> corner_dir = CalcCellDirection(face, u_min_rad + (corner / 2) * step_rad, v_min_rad + (corner % 2) * step_rad);
+          radius_rad = max(radius_rad, acos(min(1.0, libra::inner_product(center, corner_dir))));
+        }
+        cell_center_dir_[cell] = center;
+        cell_radius_rad_[cell] = radius_rad;
+      }
+    }
+  }
+}
+
+int HipparcosCatalogue::CalcCellId(const libra::Vector<3>& dir_i) {
+  // The face is decided by the axis with the largest absolute value
+  int axis = 0;
+  for (int i = 1; i < 3; i++) {
+    if (fabs(dir_i[i]) > fabs(dir_i[axis])) axis = i;
+  }
+  const int face = 2 * axis + (dir_i[axis] < 0.0 ? 1 : 0);
+  const double major = fabs(dir_i[axis]);
+
+  const double u_rad = atan(dir_i[(axis + 1) % 3] / major);
+  const double v_rad = atan(dir_i[(axis + 2) % 3] / major);
+  int iu = (int)floor((u_rad / libra::pi_2 + 0.5) * kGridSize);
+  int iv = (int)floor((v_rad / libra::pi_2 + 0.5) * kGridSize);
+  iu = min(max(iu, 0), kGridSize - 1);
+  iv = min(max(iv, 0), kGridSize - 1);
+
+  return (face * kGridSize + iu) * kGridSize + iv;
+}
+
+libra::Vector<3> HipparcosCatalogue::CalcCellDirection(const int face, const double u_angle_rad, const double v_angle_rad) {
+  const int axis = face / 2;
+  libra::Vector<3> dir(0.0);
+  dir[axis] = (face % 2 == 0) ? 1.0 : -1.0;
+  dir[(axis + 1) % 3] = tan(u_angle_rad);
+  dir[(axis + 2) % 3] = tan(v_angle_rad);
+  return libra::normalize(dir);
+}
+
+void HipparcosCatalogue::FindStarsInCone(const libra::Vector<3>& axis_i, const double half_angle_rad, const size_t max_num,
+                                         vector<int>& ranks) const {
+  const double cos_half_angle = cos(half_angle_rad);
+  FindStars(
+      axis_i, half_angle_rad, max_num, [&](int rank) { return libra::inner_product(star_dir_i_[rank], axis_i) >= cos_half_angle; }, ranks);
+}
+
+void HipparcosCatalogue::FindStarsInRectangle(const Quaternion& q_i2c, const double x_half_angle_rad, const double y_half_angle_rad,
+                                              const size_t max_num, vector<int>& ranks) const {
+  Quaternion q = q_i2c;
+  libra::Vector<3> sight_c(0.0);
+  sight_c[0] = 1.0;
+  libra::Vector<3> sight_i = q.frame_conv_inv(sight_c);
+  // The corners of the field of view are the farthest points from the sight direction
+  const double bounding_half_angle_rad = atan(sqrt(pow(tan(x_half_angle_rad), 2.0) + pow(tan(y_half_angle_rad), 2.0)));
+
+  FindStars(
+      sight_i, bounding_half_angle_rad, max_num,
+      [&](int rank) {
+        libra::Vector<3> target_c = q.frame_conv(star_dir_i_[rank]);
+        double arg_x = atan2(target_c[2], target_c[0]);  // Angle from X-axis on XZ plane in the sensor frame
+        double arg_y = atan2(target_c[1], target_c[0]);  // Angle from X-axis on XY plane in the sensor frame
+        return fabs(arg_x) <= x_half_angle_rad && fabs(arg_y) <= y_half_angle_rad;
+      },
+      ranks);
+}
+
+void HipparcosCatalogue::FindStars(const libra::Vector<3>& axis_i, const double half_angle_rad, const size_t max_num,
+                                   const function<bool(int)>& is_accepted, vector<int>& ranks) const {
+  ranks.clear();
+  if (cell_offsets_.empty() || max_num == 0) return;
+
+  // Candidate cells: the range of the cell index on each face is limited with the range of the azimuth angle of the cone around the face axes,
+  // and then each cell is checked with its bounding circle.
+  const double step_rad = libra::pi_2 / kGridSize;
+  vector<pair<int, int>> cursors;  // Next position and end position in cell_ranks_
+  for (int face = 0; face < 6; face++) {
+    const int axis = face / 2;
+    const double sign = (face % 2 == 0) ? 1.0 : -1.0;
+    int index_min[2], index_max[2];
+    bool is_overlapped = true;
+    for (int k = 0; k < 2; k++) {
+      // The angle along the k-th face axis is the azimuth angle around the other face axis
+      const double along = axis_i[(axis + 1 + k) % 3];
+      const double normal = axis_i[(axis + 2 - k) % 3];
+      double min_rad = -libra::pi_2 / 2.0;
+      double max_rad = libra::pi_2 / 2.0;
+      const double elevation_rad = asin(min(1.0, fabs(normal)));
+      if (elevation_rad + half_angle_rad < libra::pi_2) {
+        const double azimuth_rad = atan2(along, sign * axis_i[axis]);
+        const double width_rad = asin(min(1.0, sin(half_angle_rad) / cos(elevation_rad)));
+        min_rad = max(min_rad, azimuth_rad - width_rad);
+        max_rad = min(max_rad, azimuth_rad + width_rad);
+      }
+      if (min_rad > max_rad) {
+        is_overlapped = false;
+        break;
+      }
+      index_min[k] = max((int)floor((min_rad / libra::pi_2 + 0.5) * kGridSize), 0);
+      index_max[k] = min((int)floor((max_rad / libra::pi_2 + 0.5) * kGridSize), kGridSize - 1);
+    }
+    if (!is_overlapped) continue;
+
+    for (int iu = index_min[0]; iu <= index_max[0]; iu++) {
+      for (int iv = index_min[1]; iv <= index_max[1]; iv++) {
+        const int cell = (face * kGridSize + iu) * kGridSize + iv;
+        if (cell_offsets_[cell] == cell_offsets_[cell + 1]) continue;
+        const double distance_rad = acos(max(-1.0, min(1.0, libra::inner_product(cell_center_dir_[cell], axis_i))));
+        if (distance_rad > half_angle_rad + cell_radius_rad_[cell] + step_rad * 1e-6) continue;
+        cursors.push_back(make_pair(cell_offsets_[cell], cell_offsets_[cell + 1]));
+      }
+    }
+  }
+
+  // Merge the candidate cells in the rank order
+  typedef pair<int, int> Entry;  // Rank and cursor ID
+  priority_queue<Entry, vector<Entry>, greater<Entry>> queue;
+  for (size_t i = 0; i < cursors.size(); i++) {
+    queue.push(make_pair(cell_ranks_[cursors[i].first], (int)i));
+  }
+  while (!queue.empty() && ranks.size() < max_num) {
+    Entry entry = queue.top();
+    queue.pop();
+    if (is_accepted(entry.first)) ranks.push_back(entry.first);
+
+    pair<int, int>& cursor = cursors[entry.second];
+    cursor.first++;
+    if (cursor.first < cursor.second) queue.push(make_pair(cell_ranks_[cursor.first], entry.second));
+  }
 }
 
 libra::Vector<3> HipparcosCatalogue::GetStarDir_b(int rank, Quaternion q_i2b) const {
@@ -7,6 +7,7 @@
 
 #include <Library/math/Quaternion.hpp>
 #include <Library/math/Vector.hpp>
+#include <functional>
 #include <vector>
 
 /**
@@ -78,9 +79,10 @@ class HipparcosCatalogue : public ILoggable {
   /**
    *@fn GetStarDir_i
    *@brief Return direction vector of a star in the inertial frame
+   *@note The unit vectors are calculated when the catalogue is read
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  libra::Vector<3> GetStarDir_i(int rank) const;
+  libra::Vector<3> GetStarDir_i(int rank) const { return star_dir_i_[rank]; }
   /**
    *@fn GetStarDir_b
    *@brief Return direction vector of a star in the body-fixed frame
@@ -89,6 +91,29 @@ class HipparcosCatalogue : public ILoggable {
    */
   libra::Vector<3> GetStarDir_b(int rank, Quaternion q_i2b) const;
 
+  /**
+   *@fn FindStarsInCone
+   *@brief Find stars within a cone in the brightest first order
+   *@note The calculation cost is proportional to the number of the found stars and the sky area of the cone, not to the catalogue size.
+   *@param [in] axis_i: Unit vector of the center axis of the cone in the inertial frame
+   *@param [in] half_angle_rad: Half angle of the cone [rad]. It should be smaller than pi/2.
+   *@param [in] max_num: Maximum number of the stars to find
+   *@param [out] ranks: Ranks of the found stars in ascending order
+   */
+  void FindStarsInCone(const libra::Vector<3>& axis_i, const double half_angle_rad, const size_t max_num, std::vector<int>& ranks) const;
+  /**
+   *@fn FindStarsInRectangle
+   *@brief Find stars within a rectangular field of view in the brightest first order
+   *@note The sight direction is the X-axis of the sensor frame. The angles of a star are measured from the X-axis on the XZ plane and the XY plane.
+   *@param [in] q_i2c: Quaternion from the inertial frame to the sensor frame
+   *@param [in] x_half_angle_rad: Half angle of the field of view on the XZ plane [rad]. It should be smaller than pi/2.
+   *@param [in] y_half_angle_rad: Half angle of the field of view on the XY plane [rad]. It should be smaller than pi/2.
+   *@param [in] max_num: Maximum number of the stars to find
+   *@param [out] ranks: Ranks of the found stars in ascending order
+   */
+  void FindStarsInRectangle(const Quaternion& q_i2c, const double x_half_angle_rad, const double y_half_angle_rad, const size_t max_num,
+                            std::vector<int>& ranks) const;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -107,4 +132,44 @@ class HipparcosCatalogue : public ILoggable {
   std::vector<HipData> hip_catalogue;  //!< Data base of the read Hipparcos catalogue
   double max_magnitude_;               //!< Maximum magnitude in the data base
   std::string catalogue_path_;         //!< Path to Hipparcos catalog file
+
+  // Sky grid index
+  // The sky is divided into the six faces of a cube, and each face is divided into kGridSize x kGridSize cells with equal angle steps.
+  static const int kGridSize = 32;                 //!< Number of cells along an edge of a face
+  std::vector<libra::Vector<3>> star_dir_i_;       //!< Unit direction vectors of the stars in the inertial frame
+  std::vector<int> cell_offsets_;                  //!< Start position of each cell in cell_ranks_ (size: number of cells + 1)
+  std::vector<int> cell_ranks_;                    //!< Ranks of the stars sorted by cell and then by rank
+  std::vector<libra::Vector<3>> cell_center_dir_;  //!< Unit direction vector of the center of each cell
+  std::vector<double> cell_radius_rad_;            //!< Angular radius of the circle which includes each cell [rad]
+
+  /**
+   *@fn BuildIndex
+   *@brief Calculate the star direction vectors and the sky grid index from the read catalogue
+   */
+  void BuildIndex();
+  /**
+   *@fn CalcCellId
+   *@brief Return the cell ID which includes the direction
+   *@param [in] dir_i: Direction vector in the inertial frame
+   */
+  static int CalcCellId(const libra::Vector<3>& dir_i);
+  /**
+   *@fn CalcCellDirection
+   *@brief Return the unit direction vector of a point on a face
+   *@param [in] face: Face ID
+   *@param [in] u_angle_rad: Angle of the point along the first axis of the face [rad]
+   *@param [in] v_angle_rad: Angle of the point along the second axis of the face [rad]
+   */
+  static libra::Vector<3> CalcCellDirection(const int face, const double u_angle_rad, const double v_angle_rad);
+  /**
+   *@fn FindStars
+   *@brief Find stars within a cone in the brightest first order with an additional condition
+   *@param [in] axis_i: Unit vector of the center axis of the cone in the inertial frame
+   *@param [in] half_angle_rad: Half angle of the cone [rad]
+   *@param [in] max_num: Maximum number of the stars to find
+   *@param [in] is_accepted: Function to judge whether the star of the rank is accepted
+   *@param [out] ranks: Ranks of the found stars in ascending order
+   */
+  void FindStars(const libra::Vector<3>& axis_i, const double half_angle_rad, const size_t max_num, const std::function<bool(int)>& is_accepted,
+                 std::vector<int>& ranks) const;
 };
@@ -5,9 +5,11 @@
 #include "InitGlobalEnvironment.hpp"
 
 #include <Environment/Global/SimTime.h>
+#include <Environment/Global/SpiceLock.h>
 #include <Interface/InitInput/IniAccess.h>
 #include <SpiceUsr.h>
 
+#include <algorithm>
 #include <cassert>
 
 #define CALC_LABEL "calculation"
@@ -37,9 +39,16 @@ SimTime* InitSimTime(std::string file_name) {
   // Time step parameter for log output
   double log_output_interval_sec = ini_file.ReadDouble(section, "LogOutPutIntervalSec");
 
+  // Settings of the real time execution
+  RealTimeSettings realtime_settings;
+  realtime_settings.spin_time_sec = ini_file.ReadDouble(section, "RealTimeSpinUsec") * 1.0e-6;
+  realtime_settings.is_cpu_pinned = ini_file.ReadEnable(section, "RealTimeCpuPinning");
+  realtime_settings.cpu_id = ini_file.ReadInt(section, "RealTimeCpuId");
+  realtime_settings.fifo_priority = ini_file.ReadInt(section, "RealTimeFifoPriority");
+
   SimTime* simTime = new SimTime(end_sec, step_sec, attitude_update_interval_sec, attitude_rk_step_sec, orbit_update_interval_sec, orbit_rk_step_sec,
                                  thermal_update_interval_sec, thermal_rk_step_sec, compo_propagate_step_sec, log_output_interval_sec,
-                                 start_ymdhms.c_str(), sim_speed);
+                                 start_ymdhms.c_str(), sim_speed, realtime_settings);
 
   return simTime;
 }
@@ -60,7 +69,31 @@ HipparcosCatalogue* InitHipCatalogue(std::string file_name) {
   return hip_catalogue;
 }
 
-CelestialInformation* InitCelesInfo(std::string file_name) {
+TleCatalogue* InitTleCatalogue(std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "TLE_CATALOGUE";
+
+  std::string catalogue_path = ini_file.ReadString(section, "catalogue_path");
+  int wgs = ini_file.ReadInt(section, "wgs");
+  double update_interval_sec = ini_file.ReadDouble(section, "update_interval_sec");
+  int num_of_threads = ini_file.ReadInt(section, "num_of_threads");
+
+  gravconsttype whichconst = wgs84;
+  if (wgs == 0) {
+    whichconst = wgs72old;
+  } else if (wgs == 1) {
+    whichconst = wgs72;
+  }
+
+  TleCatalogue* tle_catalogue = new TleCatalogue(whichconst, update_interval_sec, (size_t)std::max(num_of_threads, 1));
+  tle_catalogue->IsCalcEnabled = ini_file.ReadEnable(section, CALC_LABEL);
+  // The catalogue is read only when it is used since it has tens of thousands of objects
+  if (tle_catalogue->IsCalcEnabled) tle_catalogue->ReadContents(catalogue_path);
+
+  return tle_catalogue;
+}
+
+CelestialInformation* InitCelesInfo(std::string file_name, const double start_jd) {
   IniAccess ini_file(file_name);
   const char* section = "PLANET_SELECTION";
   const char* furnsh_section = "FURNSH_PATH";
@@ -71,6 +104,7 @@ CelestialInformation* InitCelesInfo(std::string file_name) {
   std::string center_obj = ini_file.ReadString(section, "center_object");
 
   // SPICE Furnsh
+  std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
   std::vector<std::string> keywords = {"TLS", "TPC1", "TPC2", "TPC3", "BSP"};
   for (size_t i = 0; i < keywords.size(); i++) {
     std::string fname = ini_file.ReadString(furnsh_section, keywords[i].c_str());
@@ -112,6 +146,15 @@ CelestialInformation* InitCelesInfo(std::string file_name) {
   CelestialInformation* celestial_info;
   celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, rotation_mode, num_of_selected_body, selected_body);
 
+  // Ephemeris cache setting
+  std::string ephemeris_mode = ini_file.ReadString(section, "ephemeris_mode");
+  if (ephemeris_mode == "CHEBYSHEV") {
+    int degree = ini_file.ReadInt(section, "chebyshev_degree");
+    double segment_length_s = ini_file.ReadDouble(section, "chebyshev_segment_length_sec");
+    double tolerance_m = ini_file.ReadDouble(section, "chebyshev_tolerance_m");
+    celestial_info->EnableEphemerisCache(start_jd, degree, segment_length_s, tolerance_m);
+  }
+
   // log setting
   celestial_info->IsLogEnabled = ini_file.ReadEnable(section, LOG_LABEL);
 
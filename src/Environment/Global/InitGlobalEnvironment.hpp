@@ -8,6 +8,7 @@
 #include <Environment/Global/CelestialInformation.h>
 #include <Environment/Global/HipparcosCatalogue.h>
 #include <Environment/Global/SimTime.h>
+#include <Environment/Global/TleCatalogue.h>
 
 /**
  *@fn InitSimTime
@@ -23,9 +24,17 @@ SimTime* InitSimTime(std::string file_name);
  */
 HipparcosCatalogue* InitHipCatalogue(std::string file_name);
 
+/**
+ *@fn InitTleCatalogue
+ *@brief Initialize function for TleCatalogue class
+ *@param [in] file_name: Path to the initialize function
+ */
+TleCatalogue* InitTleCatalogue(std::string file_name);
+
 /**
  *@fn InitCelesInfo
  *@brief Initialize function for CelestialInformation class
  *@param [in] file_name: Path to the initialize function
+ *@param [in] start_jd: Julian day at the simulation start used as the reference epoch of the ephemeris cache
  */
-CelestialInformation* InitCelesInfo(std::string file_name);
+CelestialInformation* InitCelesInfo(std::string file_name, const double start_jd);
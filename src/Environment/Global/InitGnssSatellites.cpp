@@ -47,26 +47,8 @@ std::string return_dirctory_path(std::string sort) {
   return main_directory + sub_directory;
 }
 
-void get_raw_contents(std::string directory_path, std::string file_name, std::vector<std::string>& storage) {
-  std::string all_file_path = directory_path + file_name;
-  std::ifstream ifs(all_file_path);
-
-  if (!ifs.is_open()) {
-    std::cout << "in " << directory_path << "gnss file: " << file_name << " not found" << std::endl;
-    exit(1);
-  }
-  std::string str;
-  while (std::getline(ifs, str)) {
-    storage.push_back(str);
-  }
-  ifs.close();
-  if (storage.back() == "EOF") storage.pop_back();
-
-  return;
-}
-
 void get_sp3_file_contents(std::string directory_path, std::string file_sort, std::string first, std::string last,
-                           std::vector<std::vector<std::string>>& file_contents, UR_KINDS& ur_flag) {
+                           std::vector<GnssEphemerisFile>& files, UR_KINDS& ur_flag, bool is_cache_enabled) {
   std::string all_directory_path = directory_path + return_dirctory_path(file_sort);
   ur_flag = UR_NOT_UR;
 
@@ -77,7 +59,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
     int year_last_day = 365 + (year % 4 == 0) - (year % 100 == 0) + (year % 400 == 0);
     int day = stoi(first.substr(file_header.size() + 4, 3));
 
-    file_contents.clear();
+    files.clear();
 
     while (true) {
       if (day > year_last_day) {
@@ -93,9 +75,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       else
         s_day = "00" + std::to_string(day);
       std::string file_name = file_header + std::to_string(year) + s_day + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      files.emplace_back(all_directory_path + file_name, GnssEphemerisFormat::kSp3, is_cache_enabled);
 
       if (file_name == last) break;
       ++day;
@@ -118,7 +98,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       }
     }
 
-    file_contents.clear();
+    files.clear();
 
     while (true) {
       if (hour == 24) {
@@ -134,9 +114,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      files.emplace_back(all_directory_path + file_name, GnssEphemerisFormat::kSp3, is_cache_enabled);
 
       if (file_name == last) break;
       hour += 6;
@@ -156,7 +134,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       }
     }
 
-    file_contents.clear();
+    files.clear();
 
     while (true) {
       if (day == 7) {
@@ -164,9 +142,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      files.emplace_back(all_directory_path + file_name, GnssEphemerisFormat::kSp3, is_cache_enabled);
 
       if (file_name == last) break;
       ++day;
@@ -177,7 +153,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
 }
 
 void get_clk_file_contents(std::string directory_path, std::string extension, std::string file_sort, std::string first, std::string last,
-                           std::vector<std::vector<std::string>>& file_contents) {
+                           std::vector<GnssEphemerisFile>& files, bool is_cache_enabled) {
   std::string all_directory_path = directory_path + return_dirctory_path(file_sort) + extension.substr(1) + '/';
 
   if (file_sort.find("Ultra") != std::string::npos) {
@@ -197,7 +173,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
       }
     }
 
-    file_contents.clear();
+    files.clear();
 
     while (true) {
       if (hour == 24) {
@@ -213,9 +189,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      files.emplace_back(all_directory_path + file_name, GnssEphemerisFormat::kClk, is_cache_enabled);
 
       if (file_name == last) break;
       hour += 6;
@@ -235,7 +209,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
       }
     }
 
-    file_contents.clear();
+    files.clear();
 
     while (true) {
       if (day == 7) {
@@ -243,9 +217,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      files.emplace_back(all_directory_path + file_name, GnssEphemerisFormat::kClk, is_cache_enabled);
 
       if (file_name == last) break;
       ++day;
@@ -255,7 +227,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
   return;
 }
 
-GnssSatellites* InitGnssSatellites(std::string file_name) {
+GnssSatellites* InitGnssSatellites(std::string file_name, const SimTime& sim_time) {
   IniAccess ini_file(file_name);
   char section[] = "GNSS_SATELLIES";
   GnssSatellites* gnss_satellites = new GnssSatellites(ini_file.ReadEnable(section, "calculation"));
@@ -264,31 +236,38 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
   }
 
   std::string directory_path = ini_file.ReadString(section, "directory_path");
+  bool is_cache_enabled = ini_file.ReadEnable(section, "binary_cache");
+
+  // Only the records around the simulation period are loaded from the files
+  double start_unix_time = GnssEphemerisFile::CalcUnixTime(sim_time.GetStartYear(), sim_time.GetStartMon(), sim_time.GetStartDay(),
+                                                           sim_time.GetStartHr(), sim_time.GetStartMin(), sim_time.GetStartSec());
+  std::pair<double, double> sim_unix_time_period = std::make_pair(start_unix_time, start_unix_time + sim_time.GetEndSec());
 
-  std::vector<std::vector<std::string>> true_position_file;
+  std::vector<GnssEphemerisFile> true_position_file;
   UR_KINDS true_position_ur_flag = UR_NOT_UR;
   get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_position_file_sort"), ini_file.ReadString(section, "true_position_first"),
-                        ini_file.ReadString(section, "true_position_last"), true_position_file, true_position_ur_flag);
+                        ini_file.ReadString(section, "true_position_last"), true_position_file, true_position_ur_flag, is_cache_enabled);
   int true_position_interpolation_method = ini_file.ReadInt(section, "true_position_interpolation_method");
   int true_position_interpolation_number = ini_file.ReadInt(section, "true_position_interpolation_number");
 
-  std::vector<std::vector<std::string>> true_clock_file;
+  std::vector<GnssEphemerisFile> true_clock_file;
   UR_KINDS true_clock_ur_flag = UR_NOT_UR;
   std::string true_clock_file_extension = ini_file.ReadString(section, "true_clock_file_extension");
   if (true_clock_file_extension == ".sp3") {
     get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_clock_file_sort"), ini_file.ReadString(section, "true_clock_first"),
-                          ini_file.ReadString(section, "true_clock_last"), true_clock_file, true_clock_ur_flag);
+                          ini_file.ReadString(section, "true_clock_last"), true_clock_file, true_clock_ur_flag, is_cache_enabled);
   } else {
     get_clk_file_contents(directory_path, true_clock_file_extension, ini_file.ReadString(section, "true_clock_file_sort"),
-                          ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file);
+                          ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file,
+                          is_cache_enabled);
   }
   int true_clock_interpolation_number = ini_file.ReadInt(section, "true_clock_interpolation_number");
 
-  std::vector<std::vector<std::string>> estimate_position_file;
+  std::vector<GnssEphemerisFile> estimate_position_file;
   UR_KINDS estimate_position_ur_flag = UR_NOT_UR;
   get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_position_file_sort"),
                         ini_file.ReadString(section, "estimate_position_first"), ini_file.ReadString(section, "estimate_position_last"),
-                        estimate_position_file, estimate_position_ur_flag);
+                        estimate_position_file, estimate_position_ur_flag, is_cache_enabled);
   int estimate_position_interpolation_method = ini_file.ReadInt(section, "estimate_position_interpolation_method");
   int estimate_position_interpolation_number = ini_file.ReadInt(section, "estimate_position_interpolation_number");
   if (estimate_position_ur_flag != UR_NOT_UR) {
@@ -300,17 +279,17 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
     }
   }
 
-  std::vector<std::vector<std::string>> estimate_clock_file;
+  std::vector<GnssEphemerisFile> estimate_clock_file;
   UR_KINDS estimate_clock_ur_flag = estimate_position_ur_flag;
   std::string estimate_clock_file_extension = ini_file.ReadString(section, "estimate_clock_file_extension");
   if (estimate_clock_file_extension == ".sp3") {
     get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_clock_file_sort"),
                           ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file, estimate_clock_ur_flag);
+                          estimate_clock_file, estimate_clock_ur_flag, is_cache_enabled);
   } else {
     get_clk_file_contents(directory_path, estimate_clock_file_extension, ini_file.ReadString(section, "estimate_clock_file_sort"),
                           ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file);
+                          estimate_clock_file, is_cache_enabled);
   }
   int estimate_clock_interpolation_number = ini_file.ReadInt(section, "estimate_clock_interpolation_number");
 
@@ -321,7 +300,8 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
                         estimate_position_file, estimate_position_interpolation_method, estimate_position_interpolation_number,
                         estimate_position_ur_flag,
 
-                        estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+                        estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag,
+                        sim_unix_time_period);
 
   return gnss_satellites;
 }
@@ -11,5 +11,6 @@
  *@fn InitGnssSatellites
  *@brief Initialize function for GnssSatellites class
  *@param [in] file_name: Path to the initialize function
+ *@param [in] sim_time: Simulation time to limit the loaded period of the GNSS ephemeris files
  */
-GnssSatellites* InitGnssSatellites(std::string file_name);
+GnssSatellites* InitGnssSatellites(std::string file_name, const SimTime& sim_time);
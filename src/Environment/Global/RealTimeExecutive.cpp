@@ -0,0 +1,121 @@
+/**
+ * @file RealTimeExecutive.cpp
+ * @brief Class to pace the simulation steps to the real time with absolute deadlines and to monitor their latencies
+ */
+
+#include "RealTimeExecutive.h"
+
+#include <iostream>
+#include <thread>
+#if defined(__linux__)
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#endif
+
+RealTimeExecutive::RealTimeExecutive(const double sim_speed, const RealTimeSettings& settings) : sim_speed_(sim_speed), settings_(settings) {
+  start_time_ = Clock::now();
+  last_in_time_ = start_time_;
+}
+
+void RealTimeExecutive::Start(const double elapsed_time_sec) {
+  if (!IsEnabled()) return;
+  if (!is_thread_set_) {
+    SetThread();
+    is_thread_set_ = true;
+  }
+  start_time_ = Clock::now() - std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(elapsed_time_sec / sim_speed_));
+  last_in_time_ = Clock::now();
+}
+
+bool RealTimeExecutive::WaitForDeadline(const double elapsed_time_sec) {
+  const Clock::time_point deadline = CalcDeadline(elapsed_time_sec);
+  Clock::time_point now = Clock::now();
+  if (now >= deadline) {
+    num_of_overruns_++;
+    RecordLatency(std::chrono::duration<double>(now - deadline).count());
+    return false;
+  }
+
+  // Sleep with the absolute timer, and spin for the remaining time to absorb the wake-up jitter
+  const Clock::duration spin_time = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(settings_.spin_time_sec));
+  if (deadline - now > spin_time) SleepUntil(deadline - spin_time);
+  do {
+    now = Clock::now();
+  } while (now < deadline);
+
+  last_in_time_ = now;
+  RecordLatency(std::chrono::duration<double>(now - deadline).count());
+  return true;
+}
+
+double RealTimeExecutive::GetRealElapsedSec() const { return std::chrono::duration<double>(Clock::now() - start_time_).count() * sim_speed_; }
+
+double RealTimeExecutive::GetContinuousOverrunSec() const { return std::chrono::duration<double>(Clock::now() - last_in_time_).count(); }
+
+void RealTimeExecutive::ClearContinuousOverrun() { last_in_time_ = Clock::now(); }
+
+void RealTimeExecutive::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddScalar("realtime_latency", "sec");
+  channels.AddScalar("realtime_overrun_count", "-");
+  channels.AddVector("realtime_latency_histogram", "", "-", kNumOfLatencyBins);
+}
+
+void RealTimeExecutive::WriteLogValues(LogValueSpan& values) const {
+  values.Write(latency_sec_);
+  values.Write((double)num_of_overruns_);
+  for (size_t i = 0; i < kNumOfLatencyBins; i++) values.Write((double)latency_bins_[i]);
+}
+
+RealTimeExecutive::Clock::time_point RealTimeExecutive::CalcDeadline(const double elapsed_time_sec) const {
+  return start_time_ + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(elapsed_time_sec / sim_speed_));
+}
+
+void RealTimeExecutive::SleepUntil(const Clock::time_point time) {
+#if defined(__linux__)
+  // steady_clock is CLOCK_MONOTONIC on Linux
+  const auto since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+  struct timespec request;
+  request.tv_sec = (time_t)(since_epoch / 1000000000);
+  request.tv_nsec = (long)(since_epoch % 1000000000);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &request, NULL) == EINTR) {
+  }
+#else
+  std::this_thread::sleep_until(time);
+#endif
+}
+
+void RealTimeExecutive::RecordLatency(const double latency_sec) {
+  latency_sec_ = latency_sec;
+  double bin_upper_sec = 10.0e-6;
+  size_t bin = 0;
+  while (bin < kNumOfLatencyBins - 1 && latency_sec >= bin_upper_sec) {
+    bin++;
+    bin_upper_sec *= 10.0;
+  }
+  latency_bins_[bin]++;
+}
+
+void RealTimeExecutive::SetThread() {
+#if defined(__linux__)
+  if (settings_.is_cpu_pinned) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(settings_.cpu_id, &cpu_set);
+    const int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (result != 0) std::cerr << "Warning: the simulation thread is not pinned to CPU " << settings_.cpu_id << ": " << strerror(result) << std::endl;
+  }
+  if (settings_.fifo_priority > 0) {
+    struct sched_param param;
+    param.sched_priority = settings_.fifo_priority;
+    const int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (result != 0) std::cerr << "Warning: SCHED_FIFO is not applied to the simulation thread: " << strerror(result) << std::endl;
+  }
+#else
+  if (settings_.is_cpu_pinned || settings_.fifo_priority > 0) {
+    std::cerr << "Warning: the CPU affinity and SCHED_FIFO of the simulation thread are supported only on Linux" << std::endl;
+  }
+#endif
+}
@@ -0,0 +1,137 @@
+/**
+ * @file RealTimeExecutive.h
+ * @brief Class to pace the simulation steps to the real time with absolute deadlines and to monitor their latencies
+ */
+
+#ifndef __REAL_TIME_EXECUTIVE_H__
+#define __REAL_TIME_EXECUTIVE_H__
+
+#include <Interface/LogOutput/ITypedLoggable.h>
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @struct RealTimeSettings
+ * @brief Settings of the real time execution
+ */
+struct RealTimeSettings {
+  double spin_time_sec = 0.0;  //!< Duration of the busy wait before each deadline [sec]. 0 means sleeping until the deadline.
+  bool is_cpu_pinned = false;  //!< Pin the simulation thread to the CPU (Linux only)
+  int cpu_id = 0;              //!< ID of the CPU to pin the simulation thread
+  int fifo_priority = 0;       //!< Priority of SCHED_FIFO for the simulation thread (Linux only). 0 means the normal scheduling.
+};
+
+/**
+ * @class RealTimeExecutive
+ * @brief Class to pace the simulation steps to the real time with absolute deadlines and to monitor their latencies
+ * @details The deadline of each step is the start time plus the simulation elapsed time divided by the simulation speed on the steady clock, so
+ * the adjustment of the wall clock and the rounding of the sleep duration do not accumulate. The thread sleeps until the deadline minus the spin
+ * time with the absolute timer, and then busy-waits until the deadline. The latency is the delay of the start of a step from its deadline, and a
+ * step which is already late before waiting is counted as an overrun.
+ */
+class RealTimeExecutive : public ITypedLoggable {
+ public:
+  /**
+   * @fn RealTimeExecutive
+   * @brief Constructor
+   * @param [in] sim_speed: Simulation speed relative to the real time (The real time execution is disabled when it is not positive)
+   * @param [in] settings: Settings of the real time execution
+   */
+  RealTimeExecutive(const double sim_speed, const RealTimeSettings& settings);
+
+  /**
+   * @fn Start
+   * @brief Set the start time so that the current time is the deadline of the elapsed time. The thread settings are applied at the first call.
+   * @param [in] elapsed_time_sec: Simulation elapsed time [sec]
+   */
+  void Start(const double elapsed_time_sec);
+  /**
+   * @fn WaitForDeadline
+   * @brief Wait until the deadline of the elapsed time and record the latency
+   * @param [in] elapsed_time_sec: Simulation elapsed time [sec]
+   * @return False when the deadline has already passed (overrun)
+   */
+  bool WaitForDeadline(const double elapsed_time_sec);
+  /**
+   * @fn GetRealElapsedSec
+   * @brief Return the simulation elapsed time corresponding to the current real time [sec]
+   */
+  double GetRealElapsedSec() const;
+  /**
+   * @fn GetContinuousOverrunSec
+   * @brief Return the real time since the last step started before its deadline [sec]
+   */
+  double GetContinuousOverrunSec() const;
+  /**
+   * @fn ClearContinuousOverrun
+   * @brief Regard the current step as started in time after the elapsed time is skipped to the real time
+   */
+  void ClearContinuousOverrun();
+
+  /**
+   * @fn IsEnabled
+   * @brief Return true when the real time execution is enabled
+   */
+  inline bool IsEnabled() const { return sim_speed_ > 0.0; }
+  /**
+   * @fn GetNumOfOverruns
+   * @brief Return the number of steps which started after their deadlines
+   */
+  inline uint64_t GetNumOfOverruns() const { return num_of_overruns_; }
+  /**
+   * @fn GetLatencySec
+   * @brief Return the latency of the last step [sec]
+   */
+  inline double GetLatencySec() const { return latency_sec_; }
+
+  // Override ITypedLoggable
+  /**
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
+   */
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
+  /**
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
+   */
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  static const size_t kNumOfLatencyBins = 5;  //!< Number of the latency histogram bins: < 10 us, < 100 us, < 1 ms, < 10 ms, and >= 10 ms
+
+ private:
+  typedef std::chrono::steady_clock Clock;  //!< Monotonic clock not affected by the adjustment of the wall clock
+
+  double sim_speed_;            //!< Simulation speed relative to the real time
+  RealTimeSettings settings_;   //!< Settings of the real time execution
+  bool is_thread_set_ = false;  //!< The thread settings are applied
+
+  Clock::time_point start_time_;                   //!< Real time corresponding to the simulation elapsed time zero
+  Clock::time_point last_in_time_;                 //!< Real time when the last step started before its deadline
+  uint64_t num_of_overruns_ = 0;                   //!< Number of steps which started after their deadlines
+  double latency_sec_ = 0.0;                       //!< Latency of the last step [sec]
+  uint64_t latency_bins_[kNumOfLatencyBins] = {};  //!< Histogram of the latencies of all steps
+
+  /**
+   * @fn CalcDeadline
+   * @brief Return the real time deadline of the simulation elapsed time
+   */
+  Clock::time_point CalcDeadline(const double elapsed_time_sec) const;
+  /**
+   * @fn SleepUntil
+   * @brief Sleep until the absolute time
+   */
+  static void SleepUntil(const Clock::time_point time);
+  /**
+   * @fn RecordLatency
+   * @brief Add the latency into the histogram
+   */
+  void RecordLatency(const double latency_sec);
+  /**
+   * @fn SetThread
+   * @brief Apply the CPU affinity and the scheduling policy to the calling thread
+   */
+  void SetThread();
+};
+
+#endif  //__REAL_TIME_EXECUTIVE_H__
@@ -9,18 +9,14 @@
 #include <cassert>
 #include <iostream>
 #include <sstream>
-#ifdef WIN32
-#include <Windows.h>
-#else
-#include <errno.h>
-#endif
 
 using namespace std;
 
 SimTime::SimTime(const double end_sec, const double step_sec, const double attitude_update_interval_sec, const double attitude_rk_step_sec,
                  const double orbit_update_interval_sec, const double orbit_rk_step_sec, const double thermal_update_interval_sec,
                  const double thermal_rk_step_sec, const double compo_propagate_step_sec, const double log_output_interval_sec,
-                 const char* start_ymdhms, const double sim_speed) {
+                 const char* start_ymdhms, const double sim_speed, const RealTimeSettings& realtime_settings)
+    : realtime_executive_(sim_speed, realtime_settings) {
   end_sec_ = end_sec;
   step_sec_ = step_sec;
   attitude_update_interval_sec_ = attitude_update_interval_sec;
@@ -82,34 +78,19 @@ void SimTime::SetParameters(void) {
 void SimTime::UpdateTime(void) {
   InitializeState();
   elapsed_time_sec_ += step_sec_;
-  if (sim_speed_ > 0) {
-    chrono::system_clock clk;
-    int toWaitTime =
-        (int)(elapsed_time_sec_ * 1000 - chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_start_time_millisec_).count() * sim_speed_);
-    if (toWaitTime <= 0) {
+  if (realtime_executive_.IsEnabled()) {
+    if (!realtime_executive_.WaitForDeadline(elapsed_time_sec_)) {
       // When the execution time is larger than specified step_sec
-
-      int exceeded_duration_ms = (int)chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_last_time_completed_step_in_time_).count();
-      if (exceeded_duration_ms > time_exceeds_continuously_limit_sec_ * 1000) {
+      if (realtime_executive_.GetContinuousOverrunSec() > time_exceeds_continuously_limit_sec_) {
         // Skip time and warn only when execution time exceeds continuously for long time
 
         cout << "Error: the specified step_sec is too small for this computer.\r\n";
 
         // Forcibly set elapsed_tim_sec_ as actual elapsed time Reason: to catch up with real time when resume from a breakpoint
-        elapsed_time_sec_ =
-            (chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() * sim_speed_);
+        elapsed_time_sec_ = realtime_executive_.GetRealElapsedSec();
 
-        clock_last_time_completed_step_in_time_ = clk.now();
+        realtime_executive_.ClearContinuousOverrun();
       }
-    } else {
-      clock_last_time_completed_step_in_time_ = clk.now();
-
-#ifdef WIN32
-      Sleep(toWaitTime);
-#else
-      const struct timespec req = {toWaitTime / 1000, (toWaitTime % 1000) * 1000000};
-      nanosleep(&req, NULL);
-#endif
     }
   }
 
@@ -166,7 +147,7 @@ void SimTime::UpdateTime(void) {
   state_.running = true;
 }
 
-void SimTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
+void SimTime::ResetClock(void) { realtime_executive_.Start(elapsed_time_sec_); }
 
 void SimTime::PrintStartDateTime(void) const {
   int sec_int = int(start_sec_ + 0.5);
@@ -190,20 +171,12 @@ void SimTime::PrintStartDateTime(void) const {
   cout << " " << start_year_ << "/" << start_mon_ << "/" << start_day_ << " " << h.str() << ":" << m.str() << ":" << s.str() << "\n";
 }
 
-string SimTime::GetLogHeader() const {
-  string str_tmp = "";
-
-  str_tmp += WriteScalar("time", "sec");
-
-  return str_tmp;
+void SimTime::DeclareLogChannels(LogChannelList& channels) const {
+  channels.AddScalar("time", "sec");
 }
 
-string SimTime::GetLogValue() const {
-  string str_tmp = "";
-
-  str_tmp += WriteScalar(elapsed_time_sec_);
-
-  return str_tmp;
+void SimTime::WriteLogValues(LogValueSpan& values) const {
+  values.Write(elapsed_time_sec_);
 }
 
 void SimTime::InitializeState() {
@@ -225,3 +198,46 @@ void SimTime::ConvJDtoCalndarDay(const double JD) {
   current_utc_.min = (unsigned int)(min);
   current_utc_.sec = sec;
 }
+
+void SimTime::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("SimTime");
+  writer.Write(elapsed_time_sec_);
+  writer.Write(current_jd_);
+  writer.Write(current_sidereal_);
+  writer.Write(current_decyear_);
+  writer.Write(current_utc_);
+  writer.Write(attitude_update_counter_);
+  writer.Write(attitude_update_flag_);
+  writer.Write(orbit_update_counter_);
+  writer.Write(orbit_update_flag_);
+  writer.Write(thermal_update_counter_);
+  writer.Write(thermal_update_flag_);
+  writer.Write(compo_update_counter_);
+  writer.Write(compo_update_flag_);
+  writer.Write(log_counter_);
+  writer.Write(disp_counter_);
+  writer.Write(state_);
+}
+
+void SimTime::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("SimTime")) return;
+  reader.Read(elapsed_time_sec_);
+  reader.Read(current_jd_);
+  reader.Read(current_sidereal_);
+  reader.Read(current_decyear_);
+  reader.Read(current_utc_);
+  reader.Read(attitude_update_counter_);
+  reader.Read(attitude_update_flag_);
+  reader.Read(orbit_update_counter_);
+  reader.Read(orbit_update_flag_);
+  reader.Read(thermal_update_counter_);
+  reader.Read(thermal_update_flag_);
+  reader.Read(compo_update_counter_);
+  reader.Read(compo_update_flag_);
+  reader.Read(log_counter_);
+  reader.Read(disp_counter_);
+  reader.Read(state_);
+  // The checkpoint is written after the log and display outputs of the step
+  state_.log_output = false;
+  state_.disp_output = false;
+}
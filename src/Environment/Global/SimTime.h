@@ -12,12 +12,13 @@
 
 #include <string>
 // #include <time.h>
-#include <Interface/LogOutput/ILoggable.h>
+#include <Interface/LogOutput/ITypedLoggable.h>
 #include <Library/sgp4/sgp4ext.h>
 #include <Library/sgp4/sgp4io.h>
 #include <Library/sgp4/sgp4unit.h>
+#include <Library/utils/Checkpoint.hpp>
 
-#include <chrono>
+#include "RealTimeExecutive.h"
 
 /**
  *@struct TimeState
@@ -47,7 +48,7 @@ struct UTC {
  *@class SimTime
  *@brief Class to manage simulation time related information
  */
-class SimTime : public ILoggable {
+class SimTime : public ITypedLoggable, public ICheckpointable {
  public:
   /**
    *@fn SimTime
@@ -64,11 +65,12 @@ class SimTime : public ILoggable {
    *@param [in] log_output_interval_sec: Log output interval [sec]
    *@param [in] start_ymdhms: Simulation start time in UTC [YYYYMMDD hh:mm:ss]
    *@param [in] sim_speed: Simulation speed setting
+   *@param [in] realtime_settings: Settings of the real time execution
    */
   SimTime(const double end_sec, const double step_sec, const double attitude_update_interval_sec, const double attitude_rk_step_sec,
           const double orbit_update_interval_sec, const double orbit_rk_step_sec, const double thermal_update_interval_sec,
           const double thermal_rk_step_sec, const double compo_propagate_step_sec, const double log_output_interval_sec, const char* start_ymdhms,
-          const double sim_speed);
+          const double sim_speed, const RealTimeSettings& realtime_settings = RealTimeSettings());
   /**
    *@fn ~SimTime
    *@brief Destructor
@@ -89,9 +91,16 @@ class SimTime : public ILoggable {
   /**
    *@fn ResetClock
    *@brief Reset simulation start time as PC’s time
+   *@note The elapsed time is subtracted in the real time simulation to continue from a checkpoint
    */
   void ResetClock(void);
 
+  /**
+   *@fn GetRealTimeExecutive
+   *@brief Return the real time executive to register its latency log
+   */
+  inline RealTimeExecutive& GetRealTimeExecutive(void) { return realtime_executive_; }
+
   /**
    *@fn GetState
    *@brief Return time state
@@ -234,17 +243,30 @@ class SimTime : public ILoggable {
    */
   inline double GetStartSec(void) const { return start_sec_; };
 
-  // Override ILoggable
+  // Override ITypedLoggable
+  /**
+   * @fn DeclareLogChannels
+   * @brief Override DeclareLogChannels function of ITypedLoggable
+   */
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
+  /**
+   * @fn WriteLogValues
+   * @brief Override WriteLogValues function of ITypedLoggable
+   */
+  virtual void WriteLogValues(LogValueSpan& values) const;
+
+  // Override ICheckpointable
   /**
-   * @fn GetLogHeader
-   * @brief Override GetLogHeader function of ILoggable
+   * @fn SaveState
+   * @brief Write the elapsed time, the current time, and the update counters and flags
    */
-  virtual std::string GetLogHeader() const;
+  virtual void SaveState(CheckpointWriter& writer) const;
   /**
-   * @fn GetLogValue
-   * @brief Override GetLogValue function of ILoggable
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   * @note The log and display output flags are cleared because the checkpoint is written after these outputs of the step.
    */
-  virtual std::string GetLogValue() const;
+  virtual void LoadState(CheckpointReader& reader);
 
   /**
    * @fn PrintStartDateTime
@@ -273,10 +295,8 @@ class SimTime : public ILoggable {
   int disp_counter_;             //!< Update counter for display output
   TimeState state_;              //!< State of timing controller
 
-  // Calculation time measure
-  std::chrono::system_clock::time_point clock_start_time_millisec_;  //!< Simulation start time [ms]
-  // chrono::system_clock::time_point clock_elapsed_time_millisec_;  //!< Simulation elapsed time in real time simulation [ms]
-  std::chrono::system_clock::time_point clock_last_time_completed_step_in_time_;  //!< Simulation finished time [ms]
+  // Real time execution
+  RealTimeExecutive realtime_executive_;  //!< Pacing of the steps to the real time
 
   // Constants
   double end_sec_;                       //!< Time from start of simulation to end [sec]
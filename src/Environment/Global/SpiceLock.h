@@ -0,0 +1,18 @@
+/**
+ * @file SpiceLock.h
+ * @brief Lock to call SPICE functions from multiple simulation threads
+ */
+
+#pragma once
+
+#include <mutex>
+
+/**
+ * @fn GetSpiceMutex
+ * @brief Return the mutex for SPICE functions
+ * @note SPICE is not thread-safe. Hold this mutex while calling SPICE functions.
+ */
+inline std::recursive_mutex& GetSpiceMutex() {
+  static std::recursive_mutex spice_mutex;
+  return spice_mutex;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file TestChebyshevEphemeris.cpp
+ * @brief Test codes for ChebyshevEphemeris class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ChebyshevEphemeris.h"
+
+namespace {
+
+/**
+ * @fn CalcState
+ * @brief Reference state which changes quickly only near the time zero
+ */
+void CalcState(const double time_s, double state[6]) {
+  const double time_constant_s = 20.0;
+  const double amplitude_m = 1.0e4;
+  for (int i = 0; i < 3; i++) {
+    state[i] = amplitude_m * exp(-time_s / time_constant_s) + 10.0 * time_s * (i + 1);
+    state[i + 3] = -amplitude_m / time_constant_s * exp(-time_s / time_constant_s) + 10.0 * (i + 1);
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief The fitted states are within the tolerance
+ */
+TEST(ChebyshevEphemeris, Tolerance) {
+  const double tolerance_m = 1.0e-3;
+  ChebyshevEphemeris ephemeris(CalcState, 12, 1000.0, tolerance_m);
+  for (double time_s = 0.0; time_s < 10000.0; time_s += 7.0) {
+    double fitted[6], reference[6];
+    ephemeris.GetState(time_s, fitted);
+    CalcState(time_s, reference);
+    for (int i = 0; i < 3; i++) EXPECT_NEAR(reference[i], fitted[i], 10.0 * tolerance_m) << "time " << time_s;
+  }
+  EXPECT_LE(ephemeris.GetMaxFittingError_m(), tolerance_m);
+}
+
+/**
+ * @brief The segments after a halved segment start with the configured length again
+ */
+TEST(ChebyshevEphemeris, SegmentLengthAfterHalving) {
+  ChebyshevEphemeris ephemeris(CalcState, 12, 1000.0, 1.0e-3);
+  double state[6];
+  ephemeris.GetState(0.0, state);
+  const int num_fitting_first = ephemeris.GetNumFitting();
+
+  // The state is almost linear after the first hundreds of seconds, so a few segments of the configured length cover the time
+  for (double time_s = 0.0; time_s < 10000.0; time_s += 1.0) ephemeris.GetState(time_s, state);
+  EXPECT_LT(ephemeris.GetNumFitting() - num_fitting_first, 30);
+}
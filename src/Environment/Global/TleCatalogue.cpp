@@ -0,0 +1,184 @@
+/**
+ * @file TleCatalogue.cpp
+ * @brief Class to propagate all objects of a TLE catalogue with SGP4 in a batch
+ */
+
+#include "TleCatalogue.h"
+
+#include <Library/math/Constant.hpp>
+#include <Library/sgp4/sgp4io.h>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+#include "PhysicalConstants.hpp"
+
+TleCatalogue::TleCatalogue(const gravconsttype whichconst, const double update_interval_sec, const size_t num_of_threads)
+    : whichconst_(whichconst), update_interval_sec_(update_interval_sec), thread_pool_(new ThreadPool(num_of_threads)) {}
+
+bool TleCatalogue::ReadContents(const std::string& file_path) {
+  std::ifstream ifs(file_path);
+  if (!ifs.is_open()) {
+    std::cerr << "TLE catalogue file open error: " << file_path << std::endl;
+    return false;
+  }
+
+  element_sets_ = TleElementSets();
+  std::string line;
+  std::string name;
+  size_t num_of_invalid_objects = 0;
+  while (std::getline(ifs, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.compare(0, 2, "1 ") != 0) {
+      // Title line of the three-line format. "0 " is the prefix of the title line in the format of Space-Track.
+      const size_t begin = line.compare(0, 2, "0 ") == 0 ? 2 : 0;
+      const size_t end = line.find_last_not_of(' ');
+      name = (end == std::string::npos || end < begin) ? "" : line.substr(begin, end + 1 - begin);
+      continue;
+    }
+    std::string line2;
+    std::getline(ifs, line2);
+    if (!line2.empty() && line2.back() == '\r') line2.pop_back();
+    if (!AddObject(name, line, line2)) num_of_invalid_objects++;
+    name.clear();
+  }
+  if (num_of_invalid_objects > 0) std::cerr << "Warning: " << num_of_invalid_objects << " invalid objects in " << file_path << " are skipped" << std::endl;
+
+  // Initialize SGP4 of all objects with the element sets
+  const size_t num_of_objects = GetNumOfObjects();
+  records_.assign(num_of_objects, elsetrec());
+  const size_t num_of_blocks = (num_of_objects + kBlockSize - 1) / kBlockSize;
+  thread_pool_->Run(num_of_blocks, [this, num_of_objects](const size_t block) {
+    const size_t end = (block + 1) * kBlockSize;
+    for (size_t i = block * kBlockSize; i < end && i < num_of_objects; i++) {
+      sgp4init(whichconst_, element_sets_.satellite_numbers[i], element_sets_.epoch_jd[i] - 2433281.5, element_sets_.bstar[i],
+               element_sets_.eccentricity[i], element_sets_.arg_perigee_rad[i], element_sets_.inclination_rad[i], element_sets_.mean_anomaly_rad[i],
+               element_sets_.mean_motion_rad_min[i], element_sets_.raan_rad[i], records_[i]);
+    }
+  });
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  positions_i_m_.assign(num_of_objects * 3, nan);
+  velocities_i_m_s_.assign(num_of_objects * 3, nan);
+  positions_ecef_m_.assign(num_of_objects * 3, nan);
+  velocities_ecef_m_s_.assign(num_of_objects * 3, nan);
+  error_codes_.assign(num_of_objects, 0);
+  last_update_elapsed_sec_ = -1.0;
+  return true;
+}
+
+void TleCatalogue::Update(const SimTime& sim_time, const CelestialRotation& earth_rotation) {
+  if (!IsCalcEnabled) return;
+  const double elapsed_sec = sim_time.GetElapsedSec();
+  // The catalogue is propagated again when the simulation time is reset
+  const bool is_updated = last_update_elapsed_sec_ >= 0.0 && elapsed_sec >= last_update_elapsed_sec_;
+  if (is_updated && elapsed_sec - last_update_elapsed_sec_ < update_interval_sec_) return;
+
+  Propagate(sim_time.GetCurrentJd(), earth_rotation.GetDCMJ2000toXCXF());
+  last_update_elapsed_sec_ = elapsed_sec;
+}
+
+void TleCatalogue::Propagate(const double current_jd, const libra::Matrix<3, 3>& dcm_i_to_ecef) {
+  propagated_jd_ = current_jd;
+  dcm_i_to_ecef_ = dcm_i_to_ecef;
+  const size_t num_of_objects = GetNumOfObjects();
+  const size_t num_of_blocks = (num_of_objects + kBlockSize - 1) / kBlockSize;
+  thread_pool_->Run(num_of_blocks, [this, num_of_objects](const size_t block) {
+    const size_t end = (block + 1) * kBlockSize;
+    PropagateBlock(block * kBlockSize, end < num_of_objects ? end : num_of_objects);
+  });
+}
+
+size_t TleCatalogue::GetNumOfErrors() const {
+  size_t num_of_errors = 0;
+  for (auto itr = error_codes_.begin(); itr != error_codes_.end(); ++itr) {
+    if (*itr != 0) num_of_errors++;
+  }
+  return num_of_errors;
+}
+
+void TleCatalogue::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("TleCatalogue");
+  writer.Write(last_update_elapsed_sec_);
+  writer.Write(propagated_jd_);
+  writer.Write(dcm_i_to_ecef_);
+}
+
+void TleCatalogue::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("TleCatalogue")) return;
+  double propagated_jd = 0.0;
+  libra::Matrix<3, 3> dcm_i_to_ecef;
+  reader.Read(last_update_elapsed_sec_);
+  reader.Read(propagated_jd);
+  reader.Read(dcm_i_to_ecef);
+  if (reader.IsValid() && last_update_elapsed_sec_ >= 0.0) Propagate(propagated_jd, dcm_i_to_ecef);
+}
+
+bool TleCatalogue::AddObject(const std::string& name, const std::string& line1, const std::string& line2) {
+  // Columns 1 to 69 of both lines are required
+  const size_t kTleLineLength = 69;
+  if (line1.size() < kTleLineLength || line2.size() < kTleLineLength || line2.compare(0, 2, "2 ") != 0) return false;
+
+  // twoline2rv modifies the lines
+  char longstr1[130];
+  char longstr2[130];
+  strncpy(longstr1, line1.c_str(), sizeof(longstr1) - 1);
+  strncpy(longstr2, line2.c_str(), sizeof(longstr2) - 1);
+  longstr1[sizeof(longstr1) - 1] = '\0';
+  longstr2[sizeof(longstr2) - 1] = '\0';
+  elsetrec record;
+  double startmfe, stopmfe, deltamin;
+  twoline2rv(longstr1, longstr2, 'c', 0, whichconst_, startmfe, stopmfe, deltamin, record);
+
+  // SGP4 replaces the mean motion in the record with the Brouwer mean motion, so the mean motion in the TLE is read again as twoline2rv does
+  const double rev_per_day_to_rad_per_min = 1440.0 / (2.0 * libra::pi);
+  const double mean_motion_rev_day = std::strtod(line2.substr(52, 11).c_str(), nullptr);
+  if (!(mean_motion_rev_day > 0.0)) return false;
+
+  element_sets_.names.push_back(name);
+  element_sets_.satellite_numbers.push_back(record.satnum);
+  element_sets_.epoch_jd.push_back(record.jdsatepoch);
+  element_sets_.bstar.push_back(record.bstar);
+  element_sets_.inclination_rad.push_back(record.inclo);
+  element_sets_.raan_rad.push_back(record.nodeo);
+  element_sets_.eccentricity.push_back(record.ecco);
+  element_sets_.arg_perigee_rad.push_back(record.argpo);
+  element_sets_.mean_anomaly_rad.push_back(record.mo);
+  element_sets_.mean_motion_rad_min.push_back(mean_motion_rev_day / rev_per_day_to_rad_per_min);
+  return true;
+}
+
+void TleCatalogue::PropagateBlock(const size_t begin, const size_t end) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  double r_km[3];
+  double v_km_s[3];
+  for (size_t i = begin; i < end; i++) {
+    const double elapse_time_min = (propagated_jd_ - element_sets_.epoch_jd[i]) * (24.0 * 60.0);
+    sgp4(whichconst_, records_[i], elapse_time_min, r_km, v_km_s);
+    error_codes_[i] = records_[i].error;
+    for (size_t axis = 0; axis < 3; axis++) {
+      positions_i_m_[i * 3 + axis] = (error_codes_[i] == 0) ? r_km[axis] * 1000 : nan;
+      velocities_i_m_s_[i * 3 + axis] = (error_codes_[i] == 0) ? v_km_s[axis] * 1000 : nan;
+    }
+  }
+
+  // Conversion into the ECEF frame in the same order of the operations as Orbit::TransEciToEcef
+  const double omega_earth_rad_s = environment::earth_mean_angular_velocity_rad_s;
+  const double* position_i = &positions_i_m_[begin * 3];
+  const double* velocity_i = &velocities_i_m_s_[begin * 3];
+  double* position_ecef = &positions_ecef_m_[begin * 3];
+  double* velocity_ecef = &velocities_ecef_m_s_[begin * 3];
+  for (size_t i = 0; i < (end - begin) * 3; i += 3) {
+    // Velocity relative to the rotating frame: v - omega x r
+    const double relative_velocity[3] = {velocity_i[i] + omega_earth_rad_s * position_i[i + 1],
+                                         velocity_i[i + 1] - omega_earth_rad_s * position_i[i], velocity_i[i + 2]};
+    for (size_t row = 0; row < 3; row++) {
+      position_ecef[i + row] = dcm_i_to_ecef_[row][0] * position_i[i] + dcm_i_to_ecef_[row][1] * position_i[i + 1] +
+                               dcm_i_to_ecef_[row][2] * position_i[i + 2];
+      velocity_ecef[i + row] = dcm_i_to_ecef_[row][0] * relative_velocity[0] + dcm_i_to_ecef_[row][1] * relative_velocity[1] +
+                               dcm_i_to_ecef_[row][2] * relative_velocity[2];
+    }
+  }
+}
@@ -0,0 +1,177 @@
+/**
+ * @file TleCatalogue.h
+ * @brief Class to propagate all objects of a TLE catalogue with SGP4 in a batch
+ */
+
+#ifndef __TLE_CATALOGUE_H__
+#define __TLE_CATALOGUE_H__
+
+#include <Library/math/Matrix.hpp>
+#include <Library/sgp4/sgp4unit.h>
+#include <Library/utils/Checkpoint.hpp>
+#include <Library/utils/ThreadPool.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CelestialRotation.h"
+#include "SimTime.h"
+
+/**
+ * @struct TleElementSets
+ * @brief Mean elements of the TLE catalogue stored as structure of arrays. The index of each array is the index of the object in the file.
+ */
+struct TleElementSets {
+  std::vector<std::string> names;           //!< Names in the title lines (empty for the objects without the title line)
+  std::vector<long> satellite_numbers;      //!< NORAD catalogue numbers
+  std::vector<double> epoch_jd;             //!< Epochs of the element sets [Julian day]
+  std::vector<double> bstar;                //!< Drag terms [1/earth radii]
+  std::vector<double> inclination_rad;      //!< Inclinations [rad]
+  std::vector<double> raan_rad;             //!< Right ascensions of the ascending node [rad]
+  std::vector<double> eccentricity;         //!< Eccentricities
+  std::vector<double> arg_perigee_rad;      //!< Arguments of perigee [rad]
+  std::vector<double> mean_anomaly_rad;     //!< Mean anomalies [rad]
+  std::vector<double> mean_motion_rad_min;  //!< Mean motions in the TLE (Kozai) [rad/min]
+
+  /**
+   * @fn GetSize
+   * @brief Return the number of the element sets
+   */
+  inline size_t GetSize() const { return epoch_jd.size(); }
+};
+
+/**
+ * @class TleCatalogue
+ * @brief Class to propagate all objects of a TLE catalogue with SGP4 in a batch
+ * @details The objects are divided into blocks, and the blocks are propagated on the thread pool. Each block runs SGP4 of the objects and converts
+ * the results into the ECEF frame in a loop over the contiguous arrays. The results are identical to Sgp4OrbitPropagation of each object.
+ * The positions and the velocities are stored as contiguous arrays of x, y, and z of each object in the file order.
+ */
+class TleCatalogue : public ICheckpointable {
+ public:
+  /**
+   * @fn TleCatalogue
+   * @brief Constructor
+   * @param [in] whichconst: Gravity constant value type of SGP4
+   * @param [in] update_interval_sec: Interval of the propagation in the simulation [sec]. The catalogue is propagated every step when it is zero.
+   * @param [in] num_of_threads: Number of threads to propagate the objects including the simulation thread
+   */
+  TleCatalogue(const gravconsttype whichconst, const double update_interval_sec, const size_t num_of_threads);
+
+  /**
+   * @fn ReadContents
+   * @brief Read the TLE file in the two-line or the three-line format and initialize SGP4 of all objects
+   * @param [in] file_path: Path to the TLE file
+   * @return False when the file is not found
+   */
+  bool ReadContents(const std::string& file_path);
+  /**
+   * @fn Update
+   * @brief Propagate all objects to the current time when the update interval has passed
+   * @param [in] sim_time: Simulation time
+   * @param [in] earth_rotation: Rotation of the earth at the current time
+   */
+  void Update(const SimTime& sim_time, const CelestialRotation& earth_rotation);
+  /**
+   * @fn Propagate
+   * @brief Propagate all objects to the epoch
+   * @param [in] current_jd: Julian day of the epoch
+   * @param [in] dcm_i_to_ecef: DCM from the inertial frame to the ECEF frame at the epoch
+   */
+  void Propagate(const double current_jd, const libra::Matrix<3, 3>& dcm_i_to_ecef);
+
+  // Getters
+  /**
+   * @fn GetNumOfObjects
+   * @brief Return the number of the objects
+   */
+  inline size_t GetNumOfObjects() const { return element_sets_.GetSize(); }
+  /**
+   * @fn GetElementSets
+   * @brief Return the mean elements of all objects
+   */
+  inline const TleElementSets& GetElementSets() const { return element_sets_; }
+  /**
+   * @fn GetPropagatedJd
+   * @brief Return the Julian day of the last propagation
+   */
+  inline double GetPropagatedJd() const { return propagated_jd_; }
+  /**
+   * @fn GetPositions_i
+   * @brief Return the positions in the inertial frame (x, y, z of each object) [m]
+   */
+  inline const std::vector<double>& GetPositions_i() const { return positions_i_m_; }
+  /**
+   * @fn GetVelocities_i
+   * @brief Return the velocities in the inertial frame (x, y, z of each object) [m/s]
+   */
+  inline const std::vector<double>& GetVelocities_i() const { return velocities_i_m_s_; }
+  /**
+   * @fn GetPositions_ecef
+   * @brief Return the positions in the ECEF frame (x, y, z of each object) [m]
+   */
+  inline const std::vector<double>& GetPositions_ecef() const { return positions_ecef_m_; }
+  /**
+   * @fn GetVelocities_ecef
+   * @brief Return the velocities in the ECEF frame (x, y, z of each object) [m/s]
+   */
+  inline const std::vector<double>& GetVelocities_ecef() const { return velocities_ecef_m_s_; }
+  /**
+   * @fn GetErrorCodes
+   * @brief Return the SGP4 error codes of the last propagation (0: no error). The positions and the velocities of the objects with errors are NaN.
+   */
+  inline const std::vector<int>& GetErrorCodes() const { return error_codes_; }
+  /**
+   * @fn GetNumOfErrors
+   * @brief Return the number of the objects with the SGP4 errors in the last propagation
+   */
+  size_t GetNumOfErrors() const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the time of the last propagation
+   * @note The results are not written because they are derived from the epoch.
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the time written by SaveState and propagate all objects to it again
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
+  bool IsCalcEnabled = true;  //!< Calculation enable flag
+
+ private:
+  static const size_t kBlockSize = 256;  //!< Number of the objects propagated in a task of the thread pool
+
+  gravconsttype whichconst_;                 //!< Gravity constant value type of SGP4
+  double update_interval_sec_;               //!< Interval of the propagation [sec]
+  double last_update_elapsed_sec_ = -1.0;    //!< Elapsed time of the last propagation [sec]. Negative before the first propagation.
+  std::unique_ptr<ThreadPool> thread_pool_;  //!< Thread pool to propagate the blocks
+  TleElementSets element_sets_;              //!< Mean elements of all objects
+  std::vector<elsetrec> records_;            //!< SGP4 records of all objects
+  double propagated_jd_ = 0.0;               //!< Julian day of the last propagation
+  libra::Matrix<3, 3> dcm_i_to_ecef_;        //!< DCM from the inertial frame to the ECEF frame at the last propagation
+  std::vector<double> positions_i_m_;        //!< Positions in the inertial frame [m]
+  std::vector<double> velocities_i_m_s_;     //!< Velocities in the inertial frame [m/s]
+  std::vector<double> positions_ecef_m_;     //!< Positions in the ECEF frame [m]
+  std::vector<double> velocities_ecef_m_s_;  //!< Velocities in the ECEF frame [m/s]
+  std::vector<int> error_codes_;             //!< SGP4 error codes of the last propagation
+
+  /**
+   * @fn AddObject
+   * @brief Parse the lines of an object and add it to the element sets
+   * @return False when the lines are not valid
+   */
+  bool AddObject(const std::string& name, const std::string& line1, const std::string& line2);
+  /**
+   * @fn PropagateBlock
+   * @brief Propagate the objects of a block with SGP4 and convert the results into the ECEF frame
+   * @param [in] begin: Index of the first object
+   * @param [in] end: Index of the object after the last one
+   */
+  void PropagateBlock(const size_t begin, const size_t end);
+};
+
+#endif  //__TLE_CATALOGUE_H__
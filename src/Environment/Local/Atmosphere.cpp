@@ -6,7 +6,7 @@
 #include "Atmosphere.h"
 
 #include <Interface/LogOutput/LogUtility.h>
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 #include <Library/math/NormalRand.hpp>
 #include <Library/math/RandomWalk.hpp>
@@ -21,16 +21,18 @@ using std::string;
 using namespace libra;
 
 Atmosphere::Atmosphere(string model, string fname, double gauss_stddev, bool is_manual_param_used, double manual_daily_f107,
-                       double manual_average_f107, double manual_ap)
+                       double manual_average_f107, double manual_ap, bool is_table_interpolated)
     : model_(model),
       fname_(fname),
       air_density_(0.0),
       gauss_stddev_(gauss_stddev),
+      density_nr_(0.0, gauss_stddev, libra::RandomContext::GetCurrent().MakeSeed("Atmosphere")),
       is_table_imported_(false),
       is_manual_param_used_(is_manual_param_used),
       manual_daily_f107_(manual_daily_f107),
       manual_average_f107_(manual_average_f107),
       manual_ap_(manual_ap) {
+  table_.SetInterpolation(is_table_interpolated);
   if (model_ == "STANDARD") {
     std::cerr << "Air density model : STANDARD" << std::endl;
   } else if (model_ == "NRLMSISE00") {
@@ -43,7 +45,7 @@ Atmosphere::Atmosphere(string model, string fname, double gauss_stddev, bool is_
 
 int Atmosphere::GetSpaceWeatherTable(double decyear, double endsec) {
   // Get table of simulation duration only to decrease memory
-  return GetSpaceWeatherTable_(decyear, endsec, fname_, table_);
+  return table_.Read(decyear, endsec, fname_);
 }
 
 double Atmosphere::GetAirDensity() const { return air_density_; }
@@ -70,7 +72,14 @@ double Atmosphere::CalcAirDensity(double decyear, double endsec, Vector<3> lat_l
     double latrad = lat_lon_alt(0);
     double lonrad = lat_lon_alt(1);
     double alt = lat_lon_alt(2);
-    air_density_ = CalcNRLMSISE00(decyear, latrad, lonrad, alt, table_, is_manual_param_used_, manual_daily_f107_, manual_average_f107_, manual_ap_);
+    double f107 = manual_daily_f107_;
+    double f107a = manual_average_f107_;
+    double ap = manual_ap_;
+    if (is_manual_param_used_ || table_.GetParameters(decyear, table_cursor_, f107, f107a, ap)) {
+      air_density_ = CalcNRLMSISE00(decyear, latrad, lonrad, alt, f107, f107a, ap);
+    } else {
+      air_density_ = 0.0;  // No space weather data
+    }
   } else {
     // No suitable model
     return air_density_ = 0.0;
@@ -212,8 +221,8 @@ double Atmosphere::CalcStandard(double altitude_m) {
 
 double Atmosphere::AddNoise(double rho) {
   // RandomWalk rw(rho*rw_stepwidth_,rho*rw_stddev_,rho*rw_limit_);
-  NormalRand nr(0.0, rho * gauss_stddev_, g_rand.MakeSeed());
-  double nrd = nr;
+  density_nr_.set_param(0.0, rho * gauss_stddev_);
+  double nrd = density_nr_;
 
   return rho + nrd;
 }
@@ -232,3 +241,15 @@ string Atmosphere::GetLogHeader() const {
 
   return str_tmp;
 }
+
+void Atmosphere::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("Atmosphere");
+  writer.Write(air_density_);
+  writer.Write(density_nr_);
+}
+
+void Atmosphere::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("Atmosphere")) return;
+  reader.Read(air_density_);
+  reader.Read(density_nr_);
+}
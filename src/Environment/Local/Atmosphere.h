@@ -10,8 +10,10 @@
 #include <Interface/LogOutput/ILoggable.h>
 #include <Library/nrlmsise00/Wrapper_nrlmsise00.h>
 
+#include <Library/math/NormalRand.hpp>
 #include <Library/math/Quaternion.hpp>
 #include <Library/math/Vector.hpp>
+#include <Library/utils/Checkpoint.hpp>
 #include <string>
 #include <vector>
 
@@ -22,7 +24,7 @@ using libra::Vector;
  * @class Atmosphere
  * @brief Class to calculate earth's atmospheric density
  */
-class Atmosphere : public ILoggable {
+class Atmosphere : public ILoggable, public ICheckpointable {
  public:
   bool IsCalcEnabled = true;  //!< Calculation enable flag
 
@@ -36,9 +38,10 @@ class Atmosphere : public ILoggable {
    * @param [in] manual_f107: Manual value of daily F10.7
    * @param [in] manual_f107a: Manual value of averaged F10.7 (3-month averaged value)
    * @param [in] manual_ap: Manual value of ap value
+   * @param [in] is_table_interpolated: Flag to interpolate the space weather parameters between days
    */
   Atmosphere(std::string model, std::string fname, double gauss_stddev, bool is_manual_param, double manual_f107, double manual_f107a,
-             double manual_ap);
+             double manual_ap, bool is_table_interpolated);
   /**
    * @fn ~Atmosphere
    * @brief Destructor
@@ -71,14 +74,28 @@ class Atmosphere : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the air density and the state of the density noise
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
-  std::string model_;                  //!< Atmospheric density model name
-  std::string fname_;                  //!< Path and name of initialize file
-  double air_density_;                 //!< Atmospheric density [kg/m^3]
-  double gauss_stddev_;                //!< Standard deviation of density noise (defined as percentage)
-  std::vector<nrlmsise_table> table_;  //!< Space weather table
-  bool is_table_imported_;             //!< Flag of the space weather table is imported or not
-  bool is_manual_param_used_;          //!< Flag to use manual parameters
+  std::string model_;                       //!< Atmospheric density model name
+  std::string fname_;                       //!< Path and name of initialize file
+  double air_density_;                      //!< Atmospheric density [kg/m^3]
+  double gauss_stddev_;                     //!< Standard deviation of density noise (defined as percentage)
+  libra::NormalRand density_nr_;            //!< Normal random for density noise
+  SpaceWeatherTable table_;                 //!< Space weather table
+  SpaceWeatherTable::Cursor table_cursor_;  //!< Cache of the last looked up day in the space weather table
+  bool is_table_imported_;                  //!< Flag of the space weather table is imported or not
+  bool is_manual_param_used_;               //!< Flag to use manual parameters
 
   // Reference of the following setting parameters https://www.swpc.noaa.gov/phenomena/f107-cm-radio-emissions
   double manual_daily_f107_;    //!< Manual daily f10.7 value
@@ -64,8 +64,10 @@ Atmosphere InitAtmosphere(std::string ini_path) {
     manual_average_f107 = f107_default;
   }
   double manual_ap = conf.ReadDouble(section, "manual_ap");
+  bool is_table_interpolated = conf.ReadEnable(section, "is_table_interpolated");
 
-  Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap);
+  Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap,
+                        is_table_interpolated);
   atmosphere.IsCalcEnabled = conf.ReadEnable(section, CALC_LABEL);
   atmosphere.IsLogEnabled = conf.ReadEnable(section, LOG_LABEL);
 
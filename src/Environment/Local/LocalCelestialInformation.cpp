@@ -5,6 +5,7 @@
 
 #include "LocalCelestialInformation.h"
 
+#include <Environment/Global/SpiceLock.h>
 #include <Interface/LogOutput/LogUtility.h>
 #include <SpiceUsr.h>
 
@@ -126,39 +127,32 @@ void Convert_i2b_velocity(const double* r_i, const double* v_i, double* v_b, Qua
   }
 }
 
-Vector<3> LocalCelestialInformation::GetPosFromSC_i(const char* body_name) const {
+Vector<3> LocalCelestialInformation::GetPosFromSC_i(const int id) const {
   Vector<3> position;
-  int index = 0;
-  index = glo_celes_info_->CalcBodyIdFromName(body_name);
   for (int i = 0; i < 3; i++) {
-    position[i] = celes_objects_pos_from_sc_i_[index * 3 + i];
+    position[i] = celes_objects_pos_from_sc_i_[id * 3 + i];
   }
   return position;
 }
 
-Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_i() const {
-  string body_name = glo_celes_info_->GetCenterBodyName();
-  Vector<3> position = GetPosFromSC_i(body_name.c_str());
-  return position;
-}
+Vector<3> LocalCelestialInformation::GetPosFromSC_i(const char* body_name) const { return GetPosFromSC_i(CalcBodyIdFromName(body_name)); }
 
-Vector<3> LocalCelestialInformation::GetPosFromSC_b(const char* body_name) const {
+Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_i() const { return GetPosFromSC_i(glo_celes_info_->GetCenterBodyId()); }
+
+Vector<3> LocalCelestialInformation::GetPosFromSC_b(const int id) const {
   Vector<3> position;
-  int index = 0;
-  index = glo_celes_info_->CalcBodyIdFromName(body_name);
   for (int i = 0; i < 3; i++) {
-    position[i] = celes_objects_pos_from_sc_b_[index * 3 + i];
+    position[i] = celes_objects_pos_from_sc_b_[id * 3 + i];
   }
   return position;
 }
 
-Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_b(void) const {
-  string body_name = glo_celes_info_->GetCenterBodyName();
-  Vector<3> position = GetPosFromSC_b(body_name.c_str());
-  return position;
-}
+Vector<3> LocalCelestialInformation::GetPosFromSC_b(const char* body_name) const { return GetPosFromSC_b(CalcBodyIdFromName(body_name)); }
+
+Vector<3> LocalCelestialInformation::GetCenterBodyPosFromSC_b(void) const { return GetPosFromSC_b(glo_celes_info_->GetCenterBodyId()); }
 
 string LocalCelestialInformation::GetLogHeader() const {
+  std::lock_guard<std::recursive_mutex> spice_lock(GetSpiceMutex());
   SpiceBoolean found;
   const int maxlen = 100;
   char namebuf[maxlen];
@@ -190,3 +184,31 @@ string LocalCelestialInformation::GetLogValue() const {
   }
   return str_tmp;
 }
+
+void LocalCelestialInformation::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("LocalCelestialInformation");
+  const int num_of_state = glo_celes_info_->GetNumBody() * 3;
+  writer.Write((uint64_t)num_of_state);
+  for (int i = 0; i < num_of_state; i++) {
+    writer.Write(celes_objects_pos_from_sc_i_[i]);
+    writer.Write(celes_objects_vel_from_sc_i_[i]);
+    writer.Write(celes_objects_pos_from_center_b_[i]);
+    writer.Write(celes_objects_pos_from_sc_b_[i]);
+    writer.Write(celes_objects_vel_from_center_b_[i]);
+    writer.Write(celes_objects_vel_from_sc_b_[i]);
+  }
+}
+
+void LocalCelestialInformation::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("LocalCelestialInformation")) return;
+  const int num_of_state = glo_celes_info_->GetNumBody() * 3;
+  if (!reader.ReadSize(num_of_state, "local celestial information")) return;
+  for (int i = 0; i < num_of_state; i++) {
+    reader.Read(celes_objects_pos_from_sc_i_[i]);
+    reader.Read(celes_objects_vel_from_sc_i_[i]);
+    reader.Read(celes_objects_pos_from_center_b_[i]);
+    reader.Read(celes_objects_pos_from_sc_b_[i]);
+    reader.Read(celes_objects_vel_from_center_b_[i]);
+    reader.Read(celes_objects_vel_from_sc_b_[i]);
+  }
+}
@@ -12,7 +12,7 @@
  * @class LocalCelestialInformation
  * @brief Class to manage celestial body information in the spacecraft body frame
  */
-class LocalCelestialInformation : public ILoggable {
+class LocalCelestialInformation : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn LocalCelestialInformation
@@ -47,6 +47,13 @@ class LocalCelestialInformation : public ILoggable {
   /**
    * @fn GetPosFromSC_i
    * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] id: ID of CelestialInformation list (see CelestialInformation::CalcBodyIdFromName)
+   */
+  Vector<3> GetPosFromSC_i(const int id) const;
+  /**
+   * @fn GetPosFromSC_i
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @note The body name is converted to the ID in each call. Use the ID version in each step.
    * @param [in] body_name Celestial body name
    */
   Vector<3> GetPosFromSC_i(const char* body_name) const;
@@ -59,6 +66,13 @@ class LocalCelestialInformation : public ILoggable {
   /**
    * @fn GetPosFromSC_b
    * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] id: ID of CelestialInformation list (see CelestialInformation::CalcBodyIdFromName)
+   */
+  Vector<3> GetPosFromSC_b(const int id) const;
+  /**
+   * @fn GetPosFromSC_b
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @note The body name is converted to the ID in each call. Use the ID version in each step.
    * @param [in] body_name Celestial body name
    */
   Vector<3> GetPosFromSC_b(const char* body_name) const;
@@ -73,6 +87,12 @@ class LocalCelestialInformation : public ILoggable {
    * @brief Return global celestial information
    */
   inline const CelestialInformation& GetGlobalInfo() const { return *glo_celes_info_; }
+  /**
+   * @fn CalcBodyIdFromName
+   * @brief Return ID of CelestialInformation list from body name
+   * @param [in] body_name Celestial body name
+   */
+  inline int CalcBodyIdFromName(const char* body_name) const { return glo_celes_info_->CalcBodyIdFromName(body_name); }
 
   // Override ILoggable
   /**
@@ -86,6 +106,18 @@ class LocalCelestialInformation : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the positions and velocities of the celestial bodies seen from the spacecraft
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   const CelestialInformation* glo_celes_info_;  //!< Global celestial information
   // Local Information
@@ -66,3 +66,17 @@ void LocalEnvironment::LogSetup(Logger& logger) {
   logger.AddLoggable(atmosphere_);
   logger.AddLoggable(celes_info_);
 }
+
+void LocalEnvironment::SaveState(CheckpointWriter& writer) const {
+  atmosphere_->SaveState(writer);
+  mag_->SaveState(writer);
+  srp_->SaveState(writer);
+  celes_info_->SaveState(writer);
+}
+
+void LocalEnvironment::LoadState(CheckpointReader& reader) {
+  atmosphere_->LoadState(reader);
+  mag_->LoadState(reader);
+  srp_->LoadState(reader);
+  celes_info_->LoadState(reader);
+}
@@ -57,6 +57,18 @@ class LocalEnvironment {
    * @brief Log setup for local environments
    */
   void LogSetup(Logger& logger);
+  /**
+   * @fn SaveState
+   * @brief Write the states of the local environments
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetAtmosphere
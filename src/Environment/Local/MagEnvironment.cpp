@@ -7,7 +7,7 @@
 
 #include <Interface/InitInput/IniAccess.h>
 #include <Library/igrf/igrf.h>
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 #include <Library/math/NormalRand.hpp>
 #include <Library/math/RandomWalk.hpp>
@@ -16,14 +16,19 @@ using libra::NormalRand;
 using namespace std;
 
 MagEnvironment::MagEnvironment(string fname, double mag_rwdev, double mag_rwlimit, double mag_wnvar)
-    : mag_rwdev_(mag_rwdev), mag_rwlimit_(mag_rwlimit), mag_wnvar_(mag_wnvar), fname_(fname) {
+    : mag_rwdev_(mag_rwdev),
+      mag_rwlimit_(mag_rwlimit),
+      mag_wnvar_(mag_wnvar),
+      fname_(fname),
+      igrf_model_(IgrfModel::Load(fname)),
+      rw_(0.1, Vector<3>(mag_rwdev), Vector<3>(mag_rwlimit), "MagEnvironment/rw"),
+      nr_(0.0, mag_wnvar, libra::RandomContext::GetCurrent().MakeSeed("MagEnvironment")) {
   for (int i = 0; i < 3; ++i) {
     Mag_i_[i] = 0;
   }
   for (int i = 0; i < 3; ++i) {
     Mag_b_[i] = 0;
   }
-  set_file_path(fname_.c_str());
 }
 
 void MagEnvironment::CalcMag(double decyear, double side, Vector<3> lat_lon_alt, Quaternion q_i2b) {
@@ -34,7 +39,7 @@ void MagEnvironment::CalcMag(double decyear, double side, Vector<3> lat_lon_alt,
   double alt = lat_lon_alt(2);
 
   double mag_i_array[3];
-  IgrfCalc(decyear, latrad, lonrad, alt, side, mag_i_array);
+  igrf_model_.CalcMagEci(decyear, latrad, lonrad, alt, side, igrf_coef_, mag_i_array);
   AddNoise(mag_i_array);
   for (int i = 0; i < 3; ++i) {
     Mag_i_[i] = mag_i_array[i];
@@ -43,14 +48,10 @@ void MagEnvironment::CalcMag(double decyear, double side, Vector<3> lat_lon_alt,
 }
 
 void MagEnvironment::AddNoise(double* mag_i_array) {
-  static Vector<3> stddev(mag_rwdev_);
-  static Vector<3> limit(mag_rwlimit_);
-  static RandomWalk<3> rw(0.1, stddev, limit);
-  static NormalRand nr(0.0, mag_wnvar_, g_rand.MakeSeed());
   for (int i = 0; i < 3; ++i) {
-    mag_i_array[i] += rw[i] + nr;
+    mag_i_array[i] += rw_[i] + nr_;
   }
-  ++rw;  // Update random walk
+  ++rw_;  // Update random walk
 }
 
 Vector<3> MagEnvironment::GetMag_i() const { return Mag_i_; }
@@ -74,3 +75,21 @@ string MagEnvironment::GetLogValue() const {
 
   return str_tmp;
 }
+
+void MagEnvironment::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("MagEnvironment");
+  writer.Write(Mag_i_);
+  writer.Write(Mag_b_);
+  writer.Write(igrf_coef_);
+  rw_.SaveState(writer);
+  writer.Write(nr_);
+}
+
+void MagEnvironment::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("MagEnvironment")) return;
+  reader.Read(Mag_i_);
+  reader.Read(Mag_b_);
+  reader.Read(igrf_coef_);
+  rw_.LoadState(reader);
+  reader.Read(nr_);
+}
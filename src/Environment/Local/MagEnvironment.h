@@ -11,12 +11,17 @@ using libra::Vector;
 using libra::Quaternion;
 
 #include <Interface/LogOutput/ILoggable.h>
+#include <Library/igrf/igrf.h>
+
+#include <Library/math/NormalRand.hpp>
+#include <Library/math/RandomWalk.hpp>
+#include <Library/utils/Checkpoint.hpp>
 
 /**
  * @class MagEnvironment
  * @brief Class to calculate magnetic field of the earth
  */
-class MagEnvironment : public ILoggable {
+class MagEnvironment : public ILoggable, public ICheckpointable {
  public:
   bool IsCalcEnabled = true;  //!< Calculation flag
 
@@ -68,13 +73,29 @@ class MagEnvironment : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the magnetic field, the IGRF coefficients, and the states of the noises
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
-  Vector<3> Mag_i_;     //!< Magnetic field vector at the inertial frame
-  Vector<3> Mag_b_;     //!< Magnetic field vector at the spacecraft body fixed frame
-  double mag_rwdev_;    //!< Standard deviation of Random Walk [nT]
-  double mag_rwlimit_;  //!< Limit of Random Walk [nT]
-  double mag_wnvar_;    //!< Standard deviation of white noise [nT]
-  std::string fname_;   //!< Path to the initialize file
+  Vector<3> Mag_i_;              //!< Magnetic field vector at the inertial frame
+  Vector<3> Mag_b_;              //!< Magnetic field vector at the spacecraft body fixed frame
+  double mag_rwdev_;             //!< Standard deviation of Random Walk [nT]
+  double mag_rwlimit_;           //!< Limit of Random Walk [nT]
+  double mag_wnvar_;             //!< Standard deviation of white noise [nT]
+  std::string fname_;            //!< Path to the initialize file
+  const IgrfModel& igrf_model_;  //!< IGRF model shared by all users of the coefficient file
+  IgrfCoefficients igrf_coef_;   //!< Time-interpolated IGRF coefficients
+  RandomWalk<3> rw_;             //!< Random walk of the noise
+  libra::NormalRand nr_;         //!< White noise
 
   /**
    * @fn AddNoise
@@ -20,18 +20,20 @@ SRPEnvironment::SRPEnvironment(LocalCelestialInformation* local_celes_info) : lo
   solar_constant_ = 1366.0;                                       // [W/m2]
   pressure_ = solar_constant_ / environment::speed_of_light_m_s;  // [N/m2]
   shadow_source_name_ = local_celes_info_->GetGlobalInfo().GetCenterBodyName();
-  sun_radius_m_ = local_celes_info_->GetGlobalInfo().GetMeanRadiusFromName("SUN");
+  sun_id_ = local_celes_info_->CalcBodyIdFromName("SUN");
+  shadow_source_id_ = local_celes_info_->CalcBodyIdFromName(shadow_source_name_.c_str());
+  sun_radius_m_ = local_celes_info_->GetGlobalInfo().GetMeanRadius(sun_id_);
 }
 
 void SRPEnvironment::UpdateAllStates() {
   if (!IsCalcEnabled) return;
 
   UpdatePressure();
-  CalcShadowCoefficient(shadow_source_name_);
+  CalcShadowCoefficient(shadow_source_id_);
 }
 
 void SRPEnvironment::UpdatePressure() {
-  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i("SUN");
+  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i(sun_id_);
   const double distance_sat_to_sun = norm(r_sc2sun_eci);
   pressure_ = solar_constant_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun / environment::astronomical_unit_m, 2.0);
 }
@@ -64,16 +66,16 @@ string SRPEnvironment::GetLogValue() const {
   return str_tmp;
 }
 
-void SRPEnvironment::CalcShadowCoefficient(string shadow_source_name) {
-  if (shadow_source_name == "SUN") {
+void SRPEnvironment::CalcShadowCoefficient(const int shadow_source_id) {
+  if (shadow_source_id == sun_id_) {
     shadow_coefficient_ = 1.0;
     return;
   }
 
-  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i("SUN");
-  const Vector<3> r_sc2source_eci = local_celes_info_->GetPosFromSC_i(shadow_source_name.c_str());
+  const Vector<3> r_sc2sun_eci = local_celes_info_->GetPosFromSC_i(sun_id_);
+  const Vector<3> r_sc2source_eci = local_celes_info_->GetPosFromSC_i(shadow_source_id);
 
-  const double shadow_source_radius_m = local_celes_info_->GetGlobalInfo().GetMeanRadiusFromName(shadow_source_name.c_str());
+  const double shadow_source_radius_m = local_celes_info_->GetGlobalInfo().GetMeanRadius(shadow_source_id);
 
   const double distance_sat_to_sun = norm(r_sc2sun_eci);
   const double sd_sun = asin(sun_radius_m_ / distance_sat_to_sun);                // Apparent radius of the sun
@@ -134,3 +136,15 @@ void SRPEnvironment::CalcShadowCoefficient(string shadow_source_name) {
         log2 << srp.GetP() << ",";
     }
 }*/
+
+void SRPEnvironment::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("SRPEnvironment");
+  writer.Write(pressure_);
+  writer.Write(shadow_coefficient_);
+}
+
+void SRPEnvironment::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("SRPEnvironment")) return;
+  reader.Read(pressure_);
+  reader.Read(shadow_coefficient_);
+}
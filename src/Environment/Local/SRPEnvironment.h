@@ -8,6 +8,7 @@
 #include <Interface/LogOutput/ILoggable.h>
 
 #include <Library/math/Vector.hpp>
+#include <Library/utils/Checkpoint.hpp>
 
 using libra::Vector;
 
@@ -15,7 +16,7 @@ using libra::Vector;
  * @class SRPEnvironment
  * @brief Class to calculate Solar Radiation Pressure
  */
-class SRPEnvironment : public ILoggable {
+class SRPEnvironment : public ILoggable, public ICheckpointable {
  public:
   bool IsCalcEnabled = true;  //!< Calculation flag
 
@@ -85,21 +86,35 @@ class SRPEnvironment : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the solar radiation pressure and the shadow coefficient
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   double pressure_;                  //!< Solar radiation pressure [N/m^2]
   double solar_constant_;            //!< solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
   double shadow_coefficient_ = 1.0;  //!< shadow function
   double sun_radius_m_;              //!< Sun radius [m]
   std::string shadow_source_name_;   //!< Shadow source name
+  int sun_id_;                       //!< ID of the sun in CelestialInformation list
+  int shadow_source_id_;             //!< ID of the shadow source in CelestialInformation list
 
   LocalCelestialInformation* local_celes_info_;  //!< Local celestial information
 
   /**
    * @fn CalcShadowCoefficient
    * @brief Calculate shadow coefficient
-   * @param [in] shadow_source_name_: Shadow source name
+   * @param [in] shadow_source_id: ID of the shadow source in CelestialInformation list
    */
-  void CalcShadowCoefficient(std::string shadow_source_name);
+  void CalcShadowCoefficient(const int shadow_source_id);
 };
 
 #endif /* SRPEnvironment_h */
@@ -0,0 +1,72 @@
+/**
+ * @file AsyncLogWriter.cpp
+ * @brief Class to write log outputs in a dedicated thread through a bounded ring of buffers
+ */
+
+#include "AsyncLogWriter.h"
+
+AsyncLogWriter::AsyncLogWriter(const WriteFunction write_function, const size_t num_buffers, const LogBackPressure back_pressure)
+    : write_function_(write_function), back_pressure_(back_pressure) {
+  buffers_.resize(num_buffers > 0 ? num_buffers : 1);
+  writer_thread_ = std::thread(&AsyncLogWriter::WriterLoop, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  committed_.notify_one();
+  writer_thread_.join();
+}
+
+LogBuffer* AsyncLogWriter::Acquire(const bool is_droppable) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (num_committed_ >= buffers_.size()) {
+    if (is_droppable && back_pressure_ == LogBackPressure::kDrop) {
+      num_dropped_++;
+      return nullptr;
+    }
+    written_.wait(lock, [this] { return num_committed_ < buffers_.size(); });
+  }
+  // The head buffer is not read by the writer thread until it is committed
+  LogBuffer* buffer = &buffers_[head_];
+  buffer->text.clear();
+  return buffer;
+}
+
+void AsyncLogWriter::Commit() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    head_ = (head_ + 1) % buffers_.size();
+    num_committed_++;
+  }
+  committed_.notify_one();
+}
+
+void AsyncLogWriter::WaitUntilWritten() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  written_.wait(lock, [this] { return num_committed_ == 0; });
+}
+
+void AsyncLogWriter::WriterLoop() {
+  while (true) {
+    LogBuffer* buffer;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      committed_.wait(lock, [this] { return num_committed_ > 0 || is_stopped_; });
+      // Remaining buffers are written even after the stop request
+      if (num_committed_ == 0) return;
+      buffer = &buffers_[tail_];
+    }
+
+    write_function_(*buffer);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tail_ = (tail_ + 1) % buffers_.size();
+      num_committed_--;
+    }
+    written_.notify_all();
+  }
+}
@@ -0,0 +1,118 @@
+/**
+ * @file AsyncLogWriter.h
+ * @brief Class to write log outputs in a dedicated thread through a bounded ring of buffers
+ */
+
+#ifndef __ASYNC_LOG_WRITER_H__
+#define __ASYNC_LOG_WRITER_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @enum LogBackPressure
+ * @brief Behavior when all buffers of the ring are waiting to be written
+ */
+enum class LogBackPressure {
+  kBlock = 0,  //!< Wait until the writer thread frees a buffer. No output is lost.
+  kDrop,       //!< Discard the new row and count it. Raw texts (e.g. headers and newlines) always wait since they are not droppable.
+};
+
+/**
+ * @struct LogBuffer
+ * @brief Buffer of an output which is passed to the writer thread
+ */
+struct LogBuffer {
+  /**
+   * @enum Type
+   * @brief Type of the output
+   */
+  enum class Type {
+    kText = 0,  //!< Raw text written to the CSV file
+    kRow,       //!< Values of a log row
+  };
+  Type type = Type::kText;     //!< Type of the output
+  std::string text;            //!< Raw text, or the string values of a row separated by null characters. The capacity is reused.
+  std::vector<double> values;  //!< Typed values of a row. The capacity is reused.
+  bool add_newline = true;     //!< Add newline after the row in the CSV file
+};
+
+/**
+ * @class AsyncLogWriter
+ * @brief Class to write log outputs in a dedicated thread through a bounded ring of buffers
+ * @details The simulation thread fills a buffer obtained by Acquire and passes it with Commit. The writer thread calls the write function for each
+ * committed buffer in the committed order. The buffers are allocated once in the constructor.
+ */
+class AsyncLogWriter {
+ public:
+  /**
+   * @brief Function called in the writer thread to write a buffer
+   */
+  typedef std::function<void(const LogBuffer& buffer)> WriteFunction;
+
+  /**
+   * @fn AsyncLogWriter
+   * @brief Constructor. The writer thread starts here.
+   * @param [in] write_function: Function to write a buffer
+   * @param [in] num_buffers: Number of buffers in the ring
+   * @param [in] back_pressure: Behavior when all buffers are waiting to be written
+   */
+  AsyncLogWriter(const WriteFunction write_function, const size_t num_buffers, const LogBackPressure back_pressure);
+  /**
+   * @fn ~AsyncLogWriter
+   * @brief Destructor. All committed buffers are written before the writer thread stops.
+   */
+  ~AsyncLogWriter();
+
+  /**
+   * @fn Acquire
+   * @brief Get the next buffer to fill
+   * @param [in] is_droppable: The output can be dropped by the kDrop policy. Otherwise, wait until a buffer is freed.
+   * @return Pointer to the buffer. nullptr when the output is dropped by the kDrop policy.
+   */
+  LogBuffer* Acquire(const bool is_droppable);
+  /**
+   * @fn Commit
+   * @brief Pass the buffer obtained by Acquire to the writer thread
+   */
+  void Commit();
+  /**
+   * @fn WaitUntilWritten
+   * @brief Wait until all committed buffers are written
+   */
+  void WaitUntilWritten();
+
+  /**
+   * @fn GetNumDropped
+   * @brief Return the number of dropped rows
+   */
+  inline uint64_t GetNumDropped() const { return num_dropped_; }
+
+ private:
+  WriteFunction write_function_;    //!< Function to write a buffer
+  std::vector<LogBuffer> buffers_;  //!< Ring of buffers
+  LogBackPressure back_pressure_;   //!< Behavior when all buffers are waiting to be written
+  size_t head_ = 0;                 //!< Index of the next buffer to fill
+  size_t tail_ = 0;                 //!< Index of the next buffer to write
+  size_t num_committed_ = 0;        //!< Number of buffers waiting to be written
+  bool is_stopped_ = false;         //!< Flag to stop the writer thread
+  uint64_t num_dropped_ = 0;        //!< Number of dropped rows
+
+  std::mutex mutex_;                   //!< Mutex for the ring indices
+  std::condition_variable committed_;  //!< Notified when a buffer is committed
+  std::condition_variable written_;    //!< Notified when a buffer is written
+  std::thread writer_thread_;          //!< Writer thread
+
+  /**
+   * @fn WriterLoop
+   * @brief Main loop of the writer thread
+   */
+  void WriterLoop();
+};
+
+#endif  //__ASYNC_LOG_WRITER_H__
@@ -0,0 +1,189 @@
+/**
+ * @file BinaryLog.cpp
+ * @brief Classes to write and read the binary columnar log file
+ */
+
+#include "BinaryLog.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+const char kMagic[8] = "S2EBLOG";
+const uint32_t kVersion = 2;
+const uint32_t kVersionWithoutPrecision = 1;
+}  // namespace
+
+BinaryLogWriter::BinaryLogWriter(const size_t block_rows) : block_rows_(block_rows) {
+  if (block_rows_ == 0) block_rows_ = 1;
+}
+
+BinaryLogWriter::~BinaryLogWriter() { Close(); }
+
+bool BinaryLogWriter::Open(const std::string& file_path, const bool append) {
+  file_.open(file_path, std::ios::out | std::ios::binary | (append ? std::ios::app | std::ios::ate : std::ios::trunc));
+  return file_.is_open();
+}
+
+void BinaryLogWriter::Close() {
+  if (!file_.is_open()) return;
+  Flush();
+  file_.close();
+}
+
+void BinaryLogWriter::RegisterChannels(const std::vector<std::string>& channel_names, const std::vector<int>& channel_precisions) {
+  num_channels_ = channel_names.size();
+  block_.assign(num_channels_ * block_rows_, 0.0);
+  num_rows_ = 0;
+  if (!file_.is_open()) return;
+
+  file_.write(kMagic, sizeof(kMagic));
+  file_.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+  uint32_t num_channels = static_cast<uint32_t>(num_channels_);
+  file_.write(reinterpret_cast<const char*>(&num_channels), sizeof(num_channels));
+  for (size_t c = 0; c < num_channels_; c++) {
+    uint32_t length = static_cast<uint32_t>(channel_names[c].size());
+    file_.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    file_.write(channel_names[c].data(), length);
+    int32_t precision = (c < channel_precisions.size()) ? channel_precisions[c] : kShortestCsvPrecision;
+    file_.write(reinterpret_cast<const char*>(&precision), sizeof(precision));
+  }
+}
+
+void BinaryLogWriter::AppendRow(const double* values) {
+  for (size_t c = 0; c < num_channels_; c++) {
+    block_[c * block_rows_ + num_rows_] = values[c];
+  }
+  num_rows_++;
+  if (num_rows_ >= block_rows_) Flush();
+}
+
+void BinaryLogWriter::Flush() {
+  if (num_rows_ == 0 || !file_.is_open()) return;
+  uint32_t num_rows = static_cast<uint32_t>(num_rows_);
+  file_.write(reinterpret_cast<const char*>(&num_rows), sizeof(num_rows));
+  for (size_t c = 0; c < num_channels_; c++) {
+    file_.write(reinterpret_cast<const char*>(&block_[c * block_rows_]), sizeof(double) * num_rows_);
+  }
+  num_rows_ = 0;
+}
+
+uint64_t BinaryLogWriter::GetFileSize() {
+  if (!file_.is_open()) return 0;
+  file_.flush();
+  return (uint64_t)file_.tellp();
+}
+
+void BinaryLogWriter::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("BinaryLogWriter");
+  writer.Write((uint64_t)num_channels_);
+  writer.Write((uint64_t)num_rows_);
+  for (size_t c = 0; c < num_channels_; c++) {
+    for (size_t r = 0; r < num_rows_; r++) writer.Write(block_[c * block_rows_ + r]);
+  }
+}
+
+void BinaryLogWriter::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("BinaryLogWriter")) return;
+  if (!reader.ReadSize(num_channels_, "log channels")) return;
+  uint64_t num_rows = 0;
+  reader.Read(num_rows);
+  if (reader.IsValid() && num_rows >= block_rows_) reader.SetError("too many rows in the binary log block");
+  if (!reader.IsValid()) return;
+  num_rows_ = (size_t)num_rows;
+  for (size_t c = 0; c < num_channels_; c++) {
+    for (size_t r = 0; r < num_rows_; r++) reader.Read(block_[c * block_rows_ + r]);
+  }
+}
+
+bool BinaryLogReader::Open(const std::string& file_path) {
+  file_.open(file_path, std::ios::in | std::ios::binary);
+  if (!file_.is_open()) return false;
+
+  char magic[sizeof(kMagic)];
+  uint32_t version = 0, num_channels = 0;
+  file_.read(magic, sizeof(magic));
+  file_.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file_.read(reinterpret_cast<char*>(&num_channels), sizeof(num_channels));
+  if (!file_ || memcmp(magic, kMagic, sizeof(kMagic)) != 0) return false;
+  if (version != kVersion && version != kVersionWithoutPrecision) return false;
+
+  channel_names_.clear();
+  channel_precisions_.clear();
+  for (uint32_t c = 0; c < num_channels; c++) {
+    uint32_t length = 0;
+    file_.read(reinterpret_cast<char*>(&length), sizeof(length));
+    std::string name(length, '\0');
+    file_.read(&name[0], length);
+    channel_names_.push_back(name);
+    int32_t precision = kShortestCsvPrecision;
+    if (version != kVersionWithoutPrecision) file_.read(reinterpret_cast<char*>(&precision), sizeof(precision));
+    channel_precisions_.push_back(precision);
+  }
+  return static_cast<bool>(file_);
+}
+
+size_t BinaryLogReader::ReadBlock(std::vector<double>& values) {
+  uint32_t num_rows = 0;
+  file_.read(reinterpret_cast<char*>(&num_rows), sizeof(num_rows));
+  if (!file_ || num_rows == 0) return 0;
+
+  values.resize(channel_names_.size() * num_rows);
+  file_.read(reinterpret_cast<char*>(values.data()), sizeof(double) * values.size());
+  if (!file_) return 0;
+  return num_rows;
+}
+
+std::string WriteCsvValue(const double value, const int precision) {
+  char buf[32];
+  if (precision > kShortestCsvPrecision) {
+    // Same as AppendLogValue of the CSV logger
+    snprintf(buf, sizeof(buf), "%.*g", precision, value);
+    return buf;
+  }
+
+  // The CSV logger uses 6 digits by default, so start from 6 digits to reproduce the same text
+  for (int precision = 6; precision < 17; precision++) {
+    snprintf(buf, sizeof(buf), "%.*g", precision, value);
+    if (strtod(buf, nullptr) == value) return buf;
+  }
+  snprintf(buf, sizeof(buf), "%.17g", value);
+  return buf;
+}
+
+bool ConvertBinaryLogToCsv(const std::string& binary_file_path, const std::string& csv_file_path, std::string& error_message) {
+  BinaryLogReader reader;
+  if (!reader.Open(binary_file_path)) {
+    error_message = "Error reading binary log file: " + binary_file_path;
+    return false;
+  }
+  std::ofstream csv_file(csv_file_path);
+  if (!csv_file.is_open()) {
+    error_message = "Error opening log file: " + csv_file_path;
+    return false;
+  }
+
+  // Same layout as the CSV logger: each column ends with a comma
+  const std::vector<std::string>& channel_names = reader.GetChannelNames();
+  const std::vector<int>& channel_precisions = reader.GetChannelPrecisions();
+  const size_t num_channels = channel_names.size();
+  for (const auto& name : channel_names) csv_file << name << ",";
+  csv_file << "\n";
+
+  std::vector<double> values;
+  std::string line;
+  size_t num_rows;
+  while ((num_rows = reader.ReadBlock(values)) > 0) {
+    for (size_t row = 0; row < num_rows; row++) {
+      line.clear();
+      for (size_t c = 0; c < num_channels; c++) {
+        line += WriteCsvValue(values[c * num_rows + row], channel_precisions[c]);
+        line += ",";
+      }
+      line += "\n";
+      csv_file << line;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file BinaryLog.h
+ * @brief Classes to write and read the binary columnar log file
+ * @details File format (native endian, little endian on all supported platforms)
+ * - Header: magic "S2EBLOG" (8 bytes including the null terminator), version (uint32), number of channels (uint32),
+ *   and each channel name (uint32 length + characters without the null terminator) followed by its CSV precision (int32).
+ *   The channel name is the CSV header of the column. The precision is the number of significant digits of the CSV output, and
+ *   kShortestCsvPrecision is used for the values whose precision is unknown. Version 1 files without the precisions are also read.
+ * - Blocks: number of rows (uint32) followed by the values (double) stored column by column, [channel][row].
+ */
+
+#ifndef __BINARY_LOG_H__
+#define __BINARY_LOG_H__
+
+#include <Library/utils/Checkpoint.hpp>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+const int kShortestCsvPrecision = 0;  //!< Precision to convert a value into the shortest text which is read as the same value
+
+/**
+ * @class BinaryLogWriter
+ * @brief Class to write the binary columnar log file
+ */
+class BinaryLogWriter {
+ public:
+  /**
+   * @fn BinaryLogWriter
+   * @brief Constructor
+   * @param [in] block_rows: Number of rows buffered in a block before writing to the file
+   */
+  BinaryLogWriter(const size_t block_rows = 1024);
+  /**
+   * @fn ~BinaryLogWriter
+   * @brief Destructor. Buffered rows are written to the file.
+   */
+  ~BinaryLogWriter();
+
+  /**
+   * @fn Open
+   * @brief Open the log file
+   * @param [in] file_path: Path to the log file
+   * @param [in] append: Append the rows to the existing file instead of truncating it
+   * @return True when the file is opened
+   */
+  bool Open(const std::string& file_path, const bool append = false);
+  /**
+   * @fn Close
+   * @brief Write buffered rows and close the log file
+   */
+  void Close();
+  /**
+   * @fn RegisterChannels
+   * @brief Register the channels and write the file header. Call this only once before AppendRow.
+   * @param [in] channel_names: Channel names (CSV header of each column)
+   * @param [in] channel_precisions: CSV precision of each channel. kShortestCsvPrecision is used for the channels not in the list.
+   */
+  void RegisterChannels(const std::vector<std::string>& channel_names, const std::vector<int>& channel_precisions = {});
+  /**
+   * @fn AppendRow
+   * @brief Append a row into the buffer
+   * @param [in] values: Values of all channels in the registered order
+   */
+  void AppendRow(const double* values);
+  /**
+   * @fn Flush
+   * @brief Write the buffered rows as a block
+   */
+  void Flush();
+
+  /**
+   * @fn GetNumChannels
+   * @brief Return the number of the registered channels
+   */
+  inline size_t GetNumChannels() const { return num_channels_; }
+  /**
+   * @fn IsOpen
+   * @brief Return true when the file is opened
+   */
+  inline bool IsOpen() const { return file_.is_open(); }
+  /**
+   * @fn GetFileSize
+   * @brief Return the size written into the file [byte]. The rows buffered in the current block are not included.
+   */
+  uint64_t GetFileSize();
+
+  /**
+   * @fn SaveState
+   * @brief Write the rows buffered in the current block into the checkpoint
+   * @note The rows are not flushed so that the blocks of the file are the same as those without the checkpoint.
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the rows buffered in the current block. Call this after RegisterChannels.
+   */
+  void LoadState(CheckpointReader& reader);
+
+ private:
+  std::ofstream file_;         //!< Binary file stream
+  size_t block_rows_;          //!< Number of rows in a block
+  size_t num_channels_ = 0;    //!< Number of channels
+  size_t num_rows_ = 0;        //!< Number of rows in the current block
+  std::vector<double> block_;  //!< Buffer of the current block [channel][row]
+};
+
+/**
+ * @class BinaryLogReader
+ * @brief Class to read the binary columnar log file
+ */
+class BinaryLogReader {
+ public:
+  /**
+   * @fn Open
+   * @brief Open the log file and read the header
+   * @param [in] file_path: Path to the log file
+   * @return True when the header is read successfully
+   */
+  bool Open(const std::string& file_path);
+  /**
+   * @fn ReadBlock
+   * @brief Read a block
+   * @param [out] values: Values of the block [channel][row]
+   * @return Number of rows in the block. Zero at the end of the file.
+   */
+  size_t ReadBlock(std::vector<double>& values);
+
+  /**
+   * @fn GetChannelNames
+   * @brief Return the channel names
+   */
+  inline const std::vector<std::string>& GetChannelNames() const { return channel_names_; }
+  /**
+   * @fn GetChannelPrecisions
+   * @brief Return the CSV precision of each channel
+   */
+  inline const std::vector<int>& GetChannelPrecisions() const { return channel_precisions_; }
+
+ private:
+  std::ifstream file_;                      //!< Binary file stream
+  std::vector<std::string> channel_names_;  //!< Channel names
+  std::vector<int> channel_precisions_;     //!< CSV precision of each channel
+};
+
+/**
+ * @fn WriteCsvValue
+ * @brief Convert a value into the string of the CSV log
+ * @param [in] value: Value
+ * @param [in] precision: Number of significant digits as the CSV logger. kShortestCsvPrecision for the shortest string which is read as the same
+ * double value.
+ */
+std::string WriteCsvValue(const double value, const int precision = kShortestCsvPrecision);
+
+/**
+ * @fn ConvertBinaryLogToCsv
+ * @brief Convert the binary log file into the CSV log file with the same layout as the CSV logger
+ * @param [in] binary_file_path: Path to the binary log file
+ * @param [in] csv_file_path: Path to the CSV file
+ * @param [out] error_message: Reason of the failure
+ * @return True when the file is converted
+ */
+bool ConvertBinaryLogToCsv(const std::string& binary_file_path, const std::string& csv_file_path, std::string& error_message);
+
+#endif  //__BINARY_LOG_H__
@@ -0,0 +1,35 @@
+/**
+ * @file BinaryLogConverter.cpp
+ * @brief Tool to convert the binary log file into the CSV log file
+ * @note Usage: S2E_LOG_CONVERTER <binary log file> [CSV file]
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "BinaryLog.h"
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    std::cout << "Usage: S2E_LOG_CONVERTER <binary log file> [CSV file]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::string input_path = argv[1];
+  std::string output_path;
+  if (argc > 2) {
+    output_path = argv[2];
+  } else {
+    output_path = input_path;
+    size_t extension_pos = output_path.rfind('.');
+    if (extension_pos != std::string::npos) output_path.erase(extension_pos);
+    output_path += ".csv";
+  }
+
+  std::string error_message;
+  if (!ConvertBinaryLogToCsv(input_path, output_path, error_message)) {
+    std::cerr << error_message << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file ITypedLoggable.h
+ * @brief Abstract class to manage logging with typed values
+ */
+
+#pragma once
+
+#include "ILoggable.h"
+#include "LogChannel.h"
+
+/**
+ * @class ITypedLoggable
+ * @brief Abstract class to manage logging with typed values
+ * @details The channels are declared once, and the values are written as doubles into the memory prepared by Logger at each log output.
+ * Logger uses this path instead of the string conversion. GetLogHeader and GetLogValue are generated from the typed interface for other users.
+ */
+class ITypedLoggable : public ILoggable {
+ public:
+  /**
+   * @fn DeclareLogChannels
+   * @brief Declare the logged values. The declaration must not change after the log header is written.
+   * @param [out] channels: List to add the channels
+   */
+  virtual void DeclareLogChannels(LogChannelList& channels) const = 0;
+  /**
+   * @fn WriteLogValues
+   * @brief Write the logged values in the declared order
+   * @param [out] values: Memory to write the values
+   */
+  virtual void WriteLogValues(LogValueSpan& values) const = 0;
+
+  /**
+   * @fn GetLogHeader
+   * @brief Get headers to write in CSV output file
+   */
+  virtual std::string GetLogHeader() const {
+    LogChannelList channels;
+    DeclareLogChannels(channels);
+    return channels.GetHeader();
+  }
+  /**
+   * @fn GetLogValue
+   * @brief Get values to write in CSV output file
+   */
+  virtual std::string GetLogValue() const {
+    LogChannelList channels;
+    DeclareLogChannels(channels);
+    std::vector<int> precisions;
+    channels.GetPrecisions(precisions);
+    std::vector<double> values(precisions.size());
+    LogValueSpan span(values.data(), values.size());
+    WriteLogValues(span);
+    span.FillRemaining();
+
+    std::string str_tmp = "";
+    for (size_t i = 0; i < values.size(); i++) AppendLogValue(str_tmp, values[i], precisions[i]);
+    return str_tmp;
+  }
+};
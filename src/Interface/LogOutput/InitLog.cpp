@@ -13,7 +13,10 @@ Logger* InitLog(std::string file_name) {
   std::string log_file_path = ini_file.ReadString("SIM_SETTING", "log_file_path");
   bool log_ini = ini_file.ReadBoolean("SIM_SETTING", "log_inifile");
 
-  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true);
+  LogFormat log_format = ReadLogFormat(file_name, "log_format");
+
+  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true, log_format);
+  InitLogAsync(log, file_name);
 
   return log;
 }
@@ -24,7 +27,29 @@ Logger* InitLogMC(std::string file_name, bool enable) {
   std::string log_file_path = ini_file.ReadString("SIM_SETTING", "log_file_path");
   bool log_ini = ini_file.ReadBoolean("SIM_SETTING", "log_inifile");
 
-  Logger* log = new Logger("mont.csv", log_file_path, file_name, log_ini, enable);
+  LogFormat log_format = ReadLogFormat(file_name, "mc_log_format");
+
+  Logger* log = new Logger("mont.csv", log_file_path, file_name, log_ini, enable, log_format);
 
   return log;
 }
+
+LogFormat ReadLogFormat(std::string file_name, const char* key_name) {
+  IniAccess ini_file(file_name);
+
+  std::string format_name = ini_file.ReadString("SIM_SETTING", key_name);
+  if (format_name == "BINARY") return LogFormat::kBinary;
+  return LogFormat::kCsv;
+}
+
+void InitLogAsync(Logger* logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  if (!ini_file.ReadEnable("SIM_SETTING", "log_async")) return;
+  int num_buffers = ini_file.ReadInt("SIM_SETTING", "log_async_buffer_rows");
+  if (num_buffers <= 0) num_buffers = 256;
+  std::string back_pressure_name = ini_file.ReadString("SIM_SETTING", "log_async_back_pressure");
+  LogBackPressure back_pressure = (back_pressure_name == "DROP") ? LogBackPressure::kDrop : LogBackPressure::kBlock;
+
+  logger->EnableAsync((size_t)num_buffers, back_pressure);
+}
@@ -21,3 +21,19 @@ Logger* InitLog(std::string file_name);
  * @param [in] enable: Enable flag for logging
  */
 Logger* InitLogMC(std::string file_name, bool enable);
+
+/**
+ * @fn ReadLogFormat
+ * @brief Read the log output format from the SIM_SETTING section
+ * @param [in] file_name: File name of the ini file
+ * @param [in] key_name: Key name of the format setting. CSV is used when the key is not found.
+ */
+LogFormat ReadLogFormat(std::string file_name, const char* key_name);
+
+/**
+ * @fn InitLogAsync
+ * @brief Enable the asynchronous writer of the logger according to the SIM_SETTING section
+ * @param [in,out] logger: Logger
+ * @param [in] file_name: File name of the ini file
+ */
+void InitLogAsync(Logger* logger, std::string file_name);
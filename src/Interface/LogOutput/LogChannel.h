@@ -0,0 +1,228 @@
+/**
+ * @file LogChannel.h
+ * @brief Classes to declare log channels and write log values without string conversion
+ */
+
+#pragma once
+
+#include <Library/math/MatVec.hpp>
+#include <Library/math/Quaternion.hpp>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ * @struct LogChannel
+ * @brief Declaration of a logged value (scalar, vector, or matrix)
+ */
+struct LogChannel {
+  /**
+   * @enum Type
+   * @brief Shape of the logged value
+   */
+  enum class Type {
+    kScalar = 0,  //!< Scalar value
+    kVector,      //!< Vector value
+    kMatrix,      //!< Matrix value
+  };
+  Type type;          //!< Shape of the value
+  std::string name;   //!< Name of the value
+  std::string frame;  //!< Frame of the value. Empty for scalar.
+  std::string unit;   //!< Unit of the value
+  size_t rows;        //!< Number of rows (number of elements for vector)
+  size_t columns;     //!< Number of columns
+  int precision;      //!< Precision for the CSV output (number of digit)
+
+  /**
+   * @fn GetDimension
+   * @brief Return the number of doubles of the value
+   */
+  inline size_t GetDimension() const { return rows * columns; }
+};
+
+/**
+ * @class LogChannelList
+ * @brief List of log channels declared by a loggable
+ */
+class LogChannelList {
+ public:
+  /**
+   * @fn AddScalar
+   * @brief Declare a scalar value
+   * @param [in] name: Name of the scalar value
+   * @param [in] unit: Unit of the scalar value
+   * @param [in] precision: Precision for the CSV output (number of digit)
+   */
+  inline void AddScalar(const std::string& name, const std::string& unit, const int precision = 6) {
+    channels_.push_back({LogChannel::Type::kScalar, name, "", unit, 1, 1, precision});
+  }
+  /**
+   * @fn AddVector
+   * @brief Declare a vector value (a quaternion is declared as a vector with 4 elements)
+   * @param [in] name: Name of the vector value
+   * @param [in] frame: Frame of the vector value
+   * @param [in] unit: Unit of the vector value
+   * @param [in] n: Number of elements
+   * @param [in] precision: Precision for the CSV output (number of digit)
+   */
+  inline void AddVector(const std::string& name, const std::string& frame, const std::string& unit, const size_t n, const int precision = 6) {
+    channels_.push_back({LogChannel::Type::kVector, name, frame, unit, n, 1, precision});
+  }
+  /**
+   * @fn AddMatrix
+   * @brief Declare a matrix value
+   * @param [in] name: Name of the matrix value
+   * @param [in] frame: Frame of the matrix value
+   * @param [in] unit: Unit of the matrix value
+   * @param [in] r: Row length
+   * @param [in] c: Column length
+   */
+  inline void AddMatrix(const std::string& name, const std::string& frame, const std::string& unit, const size_t r, const size_t c) {
+    channels_.push_back({LogChannel::Type::kMatrix, name, frame, unit, r, c, 6});
+  }
+
+  /**
+   * @fn GetChannels
+   * @brief Return the declared channels
+   */
+  inline const std::vector<LogChannel>& GetChannels() const { return channels_; }
+  /**
+   * @fn GetDimension
+   * @brief Return the total number of doubles of the declared channels
+   */
+  inline size_t GetDimension() const;
+  /**
+   * @fn GetHeader
+   * @brief Return the CSV header of the declared channels. The text is same with WriteScalar, WriteVector, and WriteMatrix in LogUtility.h.
+   */
+  inline std::string GetHeader() const;
+  /**
+   * @fn GetPrecisions
+   * @brief Append the CSV precision of each double into the list
+   * @param [in,out] precisions: List of precisions
+   */
+  inline void GetPrecisions(std::vector<int>& precisions) const;
+
+ private:
+  std::vector<LogChannel> channels_;  //!< Declared channels
+};
+
+/**
+ * @class LogValueSpan
+ * @brief Caller-provided memory to write the log values of a loggable
+ * @note Values beyond the size are ignored.
+ */
+class LogValueSpan {
+ public:
+  /**
+   * @fn LogValueSpan
+   * @brief Constructor
+   * @param [in] data: Pointer to the memory
+   * @param [in] size: Number of doubles in the memory
+   */
+  LogValueSpan(double* data, const size_t size) : data_(data), size_(size) {}
+
+  /**
+   * @fn Write
+   * @brief Write a scalar value
+   */
+  inline void Write(const double value) {
+    if (position_ < size_) data_[position_] = value;
+    position_++;
+  }
+  /**
+   * @fn Write
+   * @brief Write a vector value
+   */
+  template <size_t NUM>
+  inline void Write(const libra::Vector<NUM, double>& vec) {
+    for (size_t n = 0; n < NUM; n++) Write(vec[n]);
+  }
+  /**
+   * @fn Write
+   * @brief Write a matrix value in the row major order
+   */
+  template <size_t ROW, size_t COLUMN>
+  inline void Write(const libra::Matrix<ROW, COLUMN, double>& mat) {
+    for (size_t n = 0; n < ROW; n++) {
+      for (size_t m = 0; m < COLUMN; m++) Write(mat[n][m]);
+    }
+  }
+  /**
+   * @fn Write
+   * @brief Write a quaternion value
+   */
+  inline void Write(const libra::Quaternion& quat) {
+    for (size_t i = 0; i < 4; i++) Write(quat[i]);
+  }
+
+  /**
+   * @fn FillRemaining
+   * @brief Fill the values which are not written with NaN
+   */
+  inline void FillRemaining() {
+    for (; position_ < size_; position_++) data_[position_] = std::numeric_limits<double>::quiet_NaN();
+  }
+  /**
+   * @fn GetPosition
+   * @brief Return the number of written values
+   */
+  inline size_t GetPosition() const { return position_; }
+
+ private:
+  double* data_;         //!< Pointer to the memory
+  size_t size_;          //!< Number of doubles in the memory
+  size_t position_ = 0;  //!< Index of the next value
+};
+
+/**
+ * @fn AppendLogValue
+ * @brief Append a value to the CSV text. The text is same with WriteScalar in LogUtility.h.
+ * @param [in,out] text: CSV text
+ * @param [in] value: Value
+ * @param [in] precision: Precision (number of digit)
+ */
+inline void AppendLogValue(std::string& text, const double value, const int precision) {
+  char buf[32];
+  int length = snprintf(buf, sizeof(buf), "%.*g,", precision, value);
+  text.append(buf, length);
+}
+
+size_t LogChannelList::GetDimension() const {
+  size_t dimension = 0;
+  for (const auto& channel : channels_) dimension += channel.GetDimension();
+  return dimension;
+}
+
+std::string LogChannelList::GetHeader() const {
+  const std::string axis[3] = {"(X)", "(Y)", "(Z)"};
+  std::string str_tmp = "";
+  for (const auto& channel : channels_) {
+    switch (channel.type) {
+      case LogChannel::Type::kScalar:
+        str_tmp += channel.name + "[" + channel.unit + "],";
+        break;
+      case LogChannel::Type::kVector:
+        for (size_t i = 0; i < channel.rows; i++) {
+          std::string index = (channel.rows == 3) ? axis[i] : "(" + std::to_string(i) + ")";
+          str_tmp += channel.name + "_" + channel.frame + index + "[" + channel.unit + "],";
+        }
+        break;
+      case LogChannel::Type::kMatrix:
+        for (size_t i = 0; i < channel.rows; i++) {
+          for (size_t j = 0; j < channel.columns; j++) {
+            str_tmp += channel.name + "_" + channel.frame + "(" + std::to_string(i) + std::to_string(j) + ")[" + channel.unit + "],";
+          }
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return str_tmp;
+}
+
+void LogChannelList::GetPrecisions(std::vector<int>& precisions) const {
+  for (const auto& channel : channels_) precisions.insert(precisions.end(), channel.GetDimension(), channel.precision);
+}
@@ -5,7 +5,11 @@
 
 #include "Logger.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <limits>
 #include <sstream>
 #ifdef _WIN32
 #include <direct.h>
@@ -15,7 +19,9 @@
 
 std::vector<ILoggable *> loggables_;
 
-Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable) {
+Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable,
+               const LogFormat format)
+    : format_(format) {
   is_enabled_ = enable;
   is_open_ = false;
   is_enabled_inilog_ = enable_inilog;
@@ -36,9 +42,19 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
   std::stringstream file_path;
   file_path << directory_path_ << start_time_c << "_" << file_name;
   if (is_enabled_) {
-    csv_file_.open(file_path.str());
-    is_open_ = csv_file_.is_open();
-    if (!is_open_) std::cerr << "Error opening log file: " << file_path.str() << std::endl;
+    if (format_ == LogFormat::kBinary) {
+      std::string binary_file_path = file_path.str();
+      size_t extension_pos = binary_file_path.rfind('.');
+      if (extension_pos != std::string::npos) binary_file_path.erase(extension_pos);
+      binary_file_path += ".bin";
+      file_path_ = binary_file_path;
+      is_open_ = binary_file_.Open(file_path_);
+    } else {
+      file_path_ = file_path.str();
+      csv_file_.open(file_path_);
+      is_open_ = csv_file_.is_open();
+    }
+    if (!is_open_) std::cerr << "Error opening log file: " << file_path_ << std::endl;
   }
   registered_num_ = 0;
 
@@ -47,38 +63,144 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
 }
 
 Logger::~Logger(void) {
+  if (async_writer_ != nullptr) {
+    uint64_t num_dropped = async_writer_->GetNumDropped();
+    delete async_writer_;
+    async_writer_ = nullptr;
+    if (num_dropped > 0) std::cerr << "Logger: " << num_dropped << " rows are dropped by the asynchronous writer" << std::endl;
+  }
   if (is_open_) {
-    csv_file_.close();
+    if (format_ == LogFormat::kBinary) {
+      binary_file_.Close();
+    } else {
+      csv_file_.close();
+    }
   }
 }
 
 void Logger::WriteHeaders(bool add_newline) {
+  if (format_ == LogFormat::kBinary) {
+    std::vector<std::string> channel_names;
+    std::vector<int> channel_precisions;
+    for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
+      if (!((*itr)->IsLogEnabled)) continue;
+      std::stringstream header((*itr)->GetLogHeader());
+      std::string name;
+      while (std::getline(header, name, ',')) {
+        if (!name.empty()) channel_names.push_back(name);
+      }
+      // The typed values are converted with their CSV precisions, and the parsed values of the others are converted into the shortest text
+      const ITypedLoggable *typed = dynamic_cast<const ITypedLoggable *>(*itr);
+      if (typed != nullptr) {
+        LogChannelList channels;
+        typed->DeclareLogChannels(channels);
+        channels.GetPrecisions(channel_precisions);
+      }
+      channel_precisions.resize(channel_names.size(), kShortestCsvPrecision);
+    }
+    // The file header must be written before the rows in the writer thread
+    if (async_writer_ != nullptr) async_writer_->WaitUntilWritten();
+    if (is_enabled_) binary_file_.RegisterChannels(channel_names, channel_precisions);
+    binary_row_.assign(channel_names.size(), 0.0);
+    return;
+  }
+
+  // The headers are written as a text
+  std::string headers;
   for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
     if (!((*itr)->IsLogEnabled)) continue;
-    Write((*itr)->GetLogHeader());
+    headers += (*itr)->GetLogHeader();
   }
-  if (add_newline) WriteNewLine();
+  if (add_newline) headers += "\n";
+  Write(headers);
 }
 
 void Logger::WriteValues(bool add_newline) {
-  for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
-    if (!((*itr)->IsLogEnabled)) continue;
-    Write((*itr)->GetLogValue());
+  if (!is_enabled_) return;
+  if (!is_row_prepared_) PrepareRow();
+
+  // Capture the values of a row into a buffer. The typed values are formatted and written in the writer thread of the asynchronous writer, while
+  // the other loggables are formatted by GetLogValue here.
+  LogBuffer *buffer = &row_buffer_;
+  if (async_writer_ != nullptr) {
+    buffer = async_writer_->Acquire(true);
+    if (buffer == nullptr) return;
+  }
+  buffer->type = LogBuffer::Type::kRow;
+  buffer->text.clear();
+  buffer->values.resize(num_typed_values_);
+  buffer->add_newline = add_newline;
+  for (const auto &item : row_items_) {
+    if (item.typed != nullptr) {
+      LogValueSpan span(&buffer->values[item.offset], item.dimension);
+      item.typed->WriteLogValues(span);
+      span.FillRemaining();
+    } else {
+      buffer->text += item.loggable->GetLogValue();
+      buffer->text += '\0';
+    }
+  }
+
+  if (async_writer_ != nullptr) {
+    async_writer_->Commit();
+  } else {
+    WriteBuffer(*buffer);
   }
-  if (add_newline) WriteNewLine();
 }
 
 void Logger::WriteNewLine() { Write("\n"); }
 
 void Logger::Write(std::string log, bool flag) {
-  if (flag && is_enabled_) {
+  if (flag && is_enabled_ && format_ == LogFormat::kCsv) {
+    if (async_writer_ != nullptr) {
+      // Raw texts are not dropped since a missing header or newline breaks the layout of the file
+      LogBuffer *buffer = async_writer_->Acquire(false);
+      buffer->type = LogBuffer::Type::kText;
+      buffer->text += log;
+      async_writer_->Commit();
+      return;
+    }
     csv_file_ << log;
   }
 }
 
-void Logger::AddLoggable(ILoggable *loggable) { loggables_.push_back(loggable); }
+void Logger::EnableAsync(const size_t num_buffers, const LogBackPressure back_pressure) {
+  if (!is_enabled_ || !is_open_ || async_writer_ != nullptr) return;
+  async_writer_ = new AsyncLogWriter([this](const LogBuffer &buffer) { WriteBuffer(buffer); }, num_buffers, back_pressure);
+}
+
+void Logger::AddLoggable(ILoggable *loggable) {
+  loggables_.push_back(loggable);
+  is_row_prepared_ = false;
+}
+
+void Logger::ClearLoggables() {
+  loggables_.clear();
+  is_row_prepared_ = false;
+}
 
-void Logger::ClearLoggables() { loggables_.clear(); }
+void Logger::PrepareRow() {
+  // The writer thread refers the row layout
+  if (async_writer_ != nullptr) async_writer_->WaitUntilWritten();
+
+  row_items_.clear();
+  value_precisions_.clear();
+  num_typed_values_ = 0;
+  for (auto itr = loggables_.begin(); itr != loggables_.end(); ++itr) {
+    if (!((*itr)->IsLogEnabled)) continue;
+    LogRowItem item = {*itr, dynamic_cast<ITypedLoggable *>(*itr), 0, 0};
+    if (item.typed != nullptr) {
+      LogChannelList channels;
+      item.typed->DeclareLogChannels(channels);
+      channels.GetPrecisions(value_precisions_);
+      item.offset = num_typed_values_;
+      item.dimension = channels.GetDimension();
+      num_typed_values_ += item.dimension;
+    }
+    row_items_.push_back(item);
+  }
+  is_row_prepared_ = true;
+}
 
 std::string Logger::CreateDirectory(const std::string &data_path, const std::string &time) {
   std::string directory_path_tmp_ = data_path + "/logs_" + time + "/";
@@ -111,6 +233,128 @@ void Logger::CopyFileToLogDir(const std::string &ini_file_name) {
   return;
 }
 
+void Logger::ParseValues(const char *values, size_t &column) {
+  const char *head = values;
+  while (*head != '\0') {
+    const char *tail = head;
+    while (*tail != ',' && *tail != '\0') tail++;
+    if (tail != head && column < binary_row_.size()) {
+      char *end;
+      double value = strtod(head, &end);
+      binary_row_[column] = (end == head) ? std::numeric_limits<double>::quiet_NaN() : value;
+      column++;
+    }
+    head = (*tail == ',') ? tail + 1 : tail;
+  }
+}
+
+void Logger::AppendBinaryRow(size_t column) {
+  // Fill missing values when a loggable writes less values than its header
+  for (; column < binary_row_.size(); column++) binary_row_[column] = std::numeric_limits<double>::quiet_NaN();
+  binary_file_.AppendRow(binary_row_.data());
+}
+
+void Logger::WriteBuffer(const LogBuffer &buffer) {
+  if (buffer.type == LogBuffer::Type::kText) {
+    csv_file_ << buffer.text;
+    return;
+  }
+
+  const char *text = buffer.text.c_str();
+  if (format_ == LogFormat::kBinary) {
+    size_t column = 0;
+    for (const auto &item : row_items_) {
+      if (item.typed != nullptr) {
+        for (size_t i = 0; i < item.dimension && column < binary_row_.size(); i++, column++) {
+          binary_row_[column] = buffer.values[item.offset + i];
+        }
+      } else {
+        ParseValues(text, column);
+        text += strlen(text) + 1;
+      }
+    }
+    AppendBinaryRow(column);
+    return;
+  }
+
+  row_text_.clear();
+  for (const auto &item : row_items_) {
+    if (item.typed != nullptr) {
+      for (size_t i = item.offset; i < item.offset + item.dimension; i++) AppendLogValue(row_text_, buffer.values[i], value_precisions_[i]);
+    } else {
+      row_text_ += text;
+      text += strlen(text) + 1;
+    }
+  }
+  if (buffer.add_newline) row_text_ += '\n';
+  csv_file_ << row_text_;
+}
+
+void Logger::SaveState(CheckpointWriter &writer) {
+  writer.WriteSection("Logger");
+  writer.Write(is_enabled_ && is_open_);
+  if (!is_enabled_ || !is_open_) return;
+
+  if (async_writer_ != nullptr) async_writer_->WaitUntilWritten();
+  uint64_t file_size = 0;
+  if (format_ == LogFormat::kBinary) {
+    file_size = binary_file_.GetFileSize();
+  } else {
+    csv_file_.flush();
+    file_size = (uint64_t)csv_file_.tellp();
+  }
+  writer.Write(file_path_);
+  writer.Write(file_size);
+  if (format_ == LogFormat::kBinary) binary_file_.SaveState(writer);
+}
+
+void Logger::LoadState(CheckpointReader &reader) {
+  if (!reader.ReadSection("Logger")) return;
+  bool is_written = false;
+  reader.Read(is_written);
+  if (reader.IsValid() && is_written != (is_enabled_ && is_open_)) reader.SetError("enable flag of the log is different from the configuration");
+  if (!reader.IsValid() || !is_written) return;
+
+  std::string previous_file_path;
+  uint64_t file_size = 0;
+  reader.Read(previous_file_path);
+  reader.Read(file_size);
+  if (!reader.IsValid()) return;
+  if (previous_file_path == file_path_) {
+    reader.SetError("the log file of the checkpoint is overwritten: " + file_path_);
+    return;
+  }
+
+  // Replace the headers written in this run with the log written until the checkpoint
+  if (async_writer_ != nullptr) async_writer_->WaitUntilWritten();
+  if (format_ == LogFormat::kBinary) {
+    binary_file_.Close();
+  } else {
+    csv_file_.close();
+  }
+  {
+    std::ifstream previous_file(previous_file_path, std::ios::in | std::ios::binary);
+    std::ofstream current_file(file_path_, std::ios::out | std::ios::binary | std::ios::trunc);
+    std::vector<char> buffer(1 << 16);
+    uint64_t remaining = file_size;
+    while (previous_file && remaining > 0) {
+      std::streamsize size = (std::streamsize)std::min<uint64_t>(remaining, buffer.size());
+      previous_file.read(buffer.data(), size);
+      current_file.write(buffer.data(), previous_file.gcount());
+      remaining -= (uint64_t)previous_file.gcount();
+    }
+    if (remaining > 0) reader.SetError("the log file of the checkpoint is shorter than the checkpoint: " + previous_file_path);
+  }
+  if (format_ == LogFormat::kBinary) {
+    is_open_ = binary_file_.Open(file_path_, true);
+    binary_file_.LoadState(reader);
+  } else {
+    csv_file_.open(file_path_, std::ios::out | std::ios::app | std::ios::ate);
+    is_open_ = csv_file_.is_open();
+  }
+  if (!is_open_) reader.SetError("failed to reopen the log file: " + file_path_);
+}
+
 std::string Logger::GetFileName(const std::string &path) {
   size_t pos1;
 
@@ -11,7 +11,21 @@
 #include <string>
 #include <vector>
 
+#include "AsyncLogWriter.h"
+#include "BinaryLog.h"
 #include "ILoggable.h"
+#include "ITypedLoggable.h"
+
+/**
+ * @enum LogFormat
+ * @brief Output format of the log file
+ * @note In the binary format, the values of ITypedLoggable are stored as raw doubles. The values of the other ILoggable are still formatted by
+ * GetLogValue in the simulation thread and parsed back, so they keep only the precision of their CSV strings.
+ */
+enum class LogFormat {
+  kCsv = 0,  //!< Text CSV file
+  kBinary,   //!< Binary columnar file (see BinaryLog.h). Convert it to CSV with S2E_LOG_CONVERTER.
+};
 
 /**
  * @class Logger
@@ -27,17 +41,20 @@ class Logger {
    * @param [in] ini_file_name: Initialize file name
    * @param [in] enable_inilog: Enable flag to save ini files
    * @param [in] enable: Enable flag for logging
+   * @param [in] format: Output format. The extension of the file name is replaced with `.bin` for the binary format.
    */
-  Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable = true);
+  Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool enable_inilog, bool enable = true,
+         const LogFormat format = LogFormat::kCsv);
   /**
    * @fn ~Logger
-   * @brief Destructor
+   * @brief Destructor. Outputs waiting in the asynchronous writer are written before the file is closed.
    */
   ~Logger(void);
 
   /**
    * @fn Write
    * @brief Write string to the log
+   * @note Raw strings are written only in the CSV format
    * @param [in] log: Write target
    * @param [in] flag: Enable flag to write
    */
@@ -57,6 +74,7 @@ class Logger {
   /**
    * @fn WriteHeaders
    * @brief Write all headers in the log list
+   * @note In the binary format, the headers are registered as the channels of the file. Call this only once.
    * @param add_newline: Add newline or not
    */
   void WriteHeaders(bool add_newline = true);
@@ -72,6 +90,21 @@ class Logger {
    */
   void WriteNewLine();
 
+  /**
+   * @fn EnableAsync
+   * @brief Move formatting of the typed values and file writing of the log into a writer thread
+   * @note Call this before WriteHeaders. The simulation thread captures the values of ITypedLoggable into a ring of buffers, but the other
+   * ILoggable are still formatted by GetLogValue in the simulation thread. Only the rows are dropped by the kDrop policy.
+   * @param [in] num_buffers: Number of rows buffered in the ring
+   * @param [in] back_pressure: Behavior when the ring is full
+   */
+  void EnableAsync(const size_t num_buffers, const LogBackPressure back_pressure);
+  /**
+   * @fn GetNumDroppedRows
+   * @brief Return the number of rows dropped by the asynchronous writer
+   */
+  inline uint64_t GetNumDroppedRows() const { return (async_writer_ == nullptr) ? 0 : async_writer_->GetNumDropped(); }
+
   /**
    * @fn IsEnabled
    * @brief Return enable flag of the log
@@ -93,14 +126,61 @@ class Logger {
    * @brief Return the path to the directory for log files
    */
   inline std::string GetLogPath() const;
+  /**
+   * @fn GetFilePath
+   * @brief Return the path to the log file
+   */
+  inline std::string GetFilePath() const { return file_path_; }
+  /**
+   * @fn GetFormat
+   * @brief Return the output format
+   */
+  inline LogFormat GetFormat() const { return format_; }
+
+  /**
+   * @fn SaveState
+   * @brief Write the path and the written size of the log file into the checkpoint
+   * @note Waiting outputs of the asynchronous writer are written before the size is recorded.
+   */
+  void SaveState(CheckpointWriter &writer);
+  /**
+   * @fn LoadState
+   * @brief Restart the log from the checkpoint. The written part of the previous log file is copied into the current log file.
+   * @note Call this after WriteHeaders and before WriteValues. The previous log file must not be changed after the checkpoint.
+   */
+  void LoadState(CheckpointReader &reader);
 
  private:
   std::ofstream csv_file_;              //!< CSV file stream
+  std::string file_path_;               //!< Path to the log file
   char registered_num_;                 //!< Number of registered log? (Not used now. TODO: delete?)
   bool is_enabled_;                     //!< Enable flag for logging
   bool is_open_;                        //!< Is the CSV file opened?
   std::vector<ILoggable *> loggables_;  //!< Log list
 
+  LogFormat format_;                //!< Output format
+  BinaryLogWriter binary_file_;     //!< Binary file writer
+  std::vector<double> binary_row_;  //!< Row buffer for the binary format
+
+  AsyncLogWriter *async_writer_ = nullptr;  //!< Asynchronous writer. nullptr when the log is written in the simulation thread.
+
+  /**
+   * @struct LogRowItem
+   * @brief Enabled loggable in a log row
+   */
+  struct LogRowItem {
+    ILoggable *loggable;    //!< Loggable
+    ITypedLoggable *typed;  //!< Typed interface of the loggable. nullptr when the loggable only supports the string values.
+    size_t offset;          //!< Index of the first typed value in the row
+    size_t dimension;       //!< Number of typed values
+  };
+  std::vector<LogRowItem> row_items_;  //!< Enabled loggables in the output order
+  std::vector<int> value_precisions_;  //!< CSV precision of each typed value
+  size_t num_typed_values_ = 0;        //!< Number of typed values in a row
+  bool is_row_prepared_ = false;       //!< Is the row layout prepared for the current loggables
+  LogBuffer row_buffer_;               //!< Row buffer used without the asynchronous writer
+  std::string row_text_;               //!< CSV text of a row
+
   bool is_enabled_inilog_;            //!< Enable flag to save ini files
   bool is_success_make_dir_ = false;  //!< Is success making a directory for log files
   std::string directory_path_;        //!< Path to the directory for log files
@@ -121,6 +201,31 @@ class Logger {
    * @return The extracted file name
    */
   std::string GetFileName(const std::string &path);
+  /**
+   * @fn ParseValues
+   * @brief Convert the comma separated values into the binary row buffer
+   * @note The values have only the precision of the formatted strings (e.g. 6 significant digits of the default stream)
+   * @param [in] values: Comma separated values terminated with null character
+   * @param [in,out] column: Column index to start writing. It is incremented for each value.
+   */
+  void ParseValues(const char *values, size_t &column);
+  /**
+   * @fn PrepareRow
+   * @brief Prepare the row layout of the enabled loggables. Typed loggables declare their channels here.
+   */
+  void PrepareRow();
+  /**
+   * @fn AppendBinaryRow
+   * @brief Fill the missing values of the binary row buffer and append it to the binary file
+   * @param [in] column: Number of columns written in the row buffer
+   */
+  void AppendBinaryRow(size_t column);
+  /**
+   * @fn WriteBuffer
+   * @brief Write a buffer passed from the asynchronous writer. This is called in the writer thread.
+   * @param [in] buffer: Buffer to write
+   */
+  void WriteBuffer(const LogBuffer &buffer);
 };
 
 bool Logger::IsEnabled() { return is_enabled_; }
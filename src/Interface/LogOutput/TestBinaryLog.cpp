@@ -0,0 +1,137 @@
+/**
+ * @file TestBinaryLog.cpp
+ * @brief Test codes for the binary log file and its conversion into the CSV log file with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BinaryLog.h"
+#include "Logger.h"
+
+namespace {
+
+namespace fs = std::filesystem;
+
+/**
+ * @class TypedLoggable
+ * @brief Loggable with a high-precision channel and a default-precision channel
+ */
+class TypedLoggable : public ITypedLoggable {
+ public:
+  void DeclareLogChannels(LogChannelList& channels) const {
+    channels.AddVector("position", "i", "m", 3, 16);
+    channels.AddScalar("ratio", "-");
+  }
+  void WriteLogValues(LogValueSpan& values) const {
+    for (size_t i = 0; i < 3; i++) values.Write(position_[i]);
+    values.Write(ratio_);
+  }
+  void Update(const int step) {
+    for (size_t i = 0; i < 3; i++) position_[i] = 6878137.123456789 + 1000.0 / 3.0 * (step + i) + 1.0e-7 * step;
+    ratio_ = 1.0 / (step + 3.0);
+  }
+
+ private:
+  double position_[3] = {};
+  double ratio_ = 0.0;
+};
+
+/**
+ * @class TextLoggable
+ * @brief Loggable formatting its value as a text
+ */
+class TextLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const { return WriteScalar("text", "-"); }
+  std::string GetLogValue() const { return WriteScalar(value_); }
+  void Update(const int step) { value_ = 2.0 / (step + 7.0); }
+
+ private:
+  double value_ = 0.0;
+};
+
+/**
+ * @fn ReadFile
+ * @brief Read all bytes of a file
+ */
+std::string ReadFile(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @fn WriteLog
+ * @brief Write the log of the loggables in the format and return the path to the file
+ */
+std::string WriteLog(const std::string& log_path, const LogFormat format) {
+  TypedLoggable typed;
+  TextLoggable text;
+  Logger logger("binary_log_test.csv", log_path, "", false, true, format);
+  logger.AddLoggable(&typed);
+  logger.AddLoggable(&text);
+  logger.WriteHeaders();
+  for (int step = 0; step < 2500; step++) {
+    typed.Update(step);
+    text.Update(step);
+    logger.WriteValues();
+  }
+  return logger.GetFilePath();
+}
+
+}  // namespace
+
+/**
+ * @brief The CSV precision of each channel is kept in the binary log file
+ */
+TEST(BinaryLog, ChannelPrecisions) {
+  const fs::path file_path = fs::temp_directory_path() / ("s2e_binary_log_test_" + std::to_string(std::random_device()()) + ".bin");
+  const std::vector<double> row = {6878137.123456789, 0.1, 1.0 / 3.0};
+  {
+    BinaryLogWriter writer;
+    ASSERT_TRUE(writer.Open(file_path.string()));
+    writer.RegisterChannels({"a[m]", "b[-]", "c[-]"}, {16, 6});
+    writer.AppendRow(row.data());
+  }
+
+  BinaryLogReader reader;
+  ASSERT_TRUE(reader.Open(file_path.string()));
+  const std::vector<int> expected_precisions = {16, 6, kShortestCsvPrecision};
+  EXPECT_EQ(expected_precisions, reader.GetChannelPrecisions());
+  std::vector<double> values;
+  ASSERT_EQ(1u, reader.ReadBlock(values));
+  EXPECT_EQ(row, values);
+  EXPECT_EQ("6878137.123456789", WriteCsvValue(values[0], reader.GetChannelPrecisions()[0]));
+  EXPECT_EQ("0.1", WriteCsvValue(values[1], reader.GetChannelPrecisions()[1]));
+  EXPECT_EQ(0u, reader.ReadBlock(values));
+
+  std::error_code error_code;
+  fs::remove(file_path, error_code);
+}
+
+/**
+ * @brief The binary log converted into the CSV file is the same as the CSV log including the high-precision channel
+ */
+TEST(BinaryLog, RoundTripToCsv) {
+  const fs::path log_dir = fs::temp_directory_path() / ("s2e_binary_log_test_" + std::to_string(std::random_device()()));
+  fs::create_directories(log_dir);
+  const std::string log_path = log_dir.string() + "/";
+
+  const std::string csv_file_path = WriteLog(log_path, LogFormat::kCsv);
+  const std::string binary_file_path = WriteLog(log_path, LogFormat::kBinary);
+  const std::string converted_file_path = log_path + "converted.csv";
+  std::string error_message;
+  ASSERT_TRUE(ConvertBinaryLogToCsv(binary_file_path, converted_file_path, error_message)) << error_message;
+
+  const std::string csv_log = ReadFile(csv_file_path);
+  EXPECT_NE(std::string::npos, csv_log.find("6878137.123456789,"));
+  EXPECT_EQ(csv_log, ReadFile(converted_file_path));
+
+  std::error_code error_code;
+  fs::remove_all(log_dir, error_code);
+}
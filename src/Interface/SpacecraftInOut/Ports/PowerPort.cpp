@@ -58,3 +58,23 @@ void PowerPort::SubtractAssumedPowerConsumption(const double power) {
   if (assumed_power_consumption_ < 0.0) assumed_power_consumption_ = 0.0;
   return;
 }
+
+void PowerPort::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("PowerPort");
+  writer.Write(current_limit_);
+  writer.Write(minimum_voltage_);
+  writer.Write(assumed_power_consumption_);
+  writer.Write(voltage_);
+  writer.Write(current_consumption_);
+  writer.Write(is_on_);
+}
+
+void PowerPort::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("PowerPort")) return;
+  reader.Read(current_limit_);
+  reader.Read(minimum_voltage_);
+  reader.Read(assumed_power_consumption_);
+  reader.Read(voltage_);
+  reader.Read(current_consumption_);
+  reader.Read(is_on_);
+}
@@ -5,12 +5,14 @@
 
 #pragma once
 
+#include <Library/utils/Checkpoint.hpp>
+
 /**
  * @class PowerPort
  * @brief Class to emulate electrical power port
  * @details When the power switch is turned off, the component doesn't work same with the real world.
  */
-class PowerPort {
+class PowerPort : public ICheckpointable {
  public:
   /**
    * @fn PowerPort
@@ -105,6 +107,18 @@ class PowerPort {
    */
   void SubtractAssumedPowerConsumption(const double power);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the power switch state and the settings changed by the setters
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   // PCU setting parameters
   const int kPortId;      //!< ID of the power port
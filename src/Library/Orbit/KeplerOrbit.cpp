@@ -95,3 +95,21 @@ double KeplerOrbit::SolveKeplerNewtonMethod(const double eccentricity, const dou
   }
   return u_rad;
 }
+
+void KeplerOrbit::SaveState(CheckpointWriter& writer) const {
+  writer.Write(position_i_m_);
+  writer.Write(velocity_i_m_s_);
+  writer.Write(mu_m3_s2_);
+  oe_.SaveState(writer);
+  writer.Write(mean_motion_rad_s_);
+  writer.Write(dcm_inplane_to_i_);
+}
+
+void KeplerOrbit::LoadState(CheckpointReader& reader) {
+  reader.Read(position_i_m_);
+  reader.Read(velocity_i_m_s_);
+  reader.Read(mu_m3_s2_);
+  oe_.LoadState(reader);
+  reader.Read(mean_motion_rad_s_);
+  reader.Read(dcm_inplane_to_i_);
+}
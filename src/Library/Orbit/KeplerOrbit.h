@@ -49,6 +49,17 @@ class KeplerOrbit {
    */
   inline const libra::Vector<3> GetVelocity_i_m_s() const { return velocity_i_m_s_; }
 
+  /**
+   * @fn SaveState
+   * @brief Write the orbit and the calculated position and velocity into the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  void LoadState(CheckpointReader& reader);
+
  protected:
   libra::Vector<3> position_i_m_;    //!< Position vector in the inertial frame [m]
   libra::Vector<3> velocity_i_m_s_;  //!< Velocity vector in the inertial frame [m/s]
@@ -85,3 +85,21 @@ void OrbitalElements::CalcOeFromPosVel(const double mu_m3_s2, const double time_
   double dt_s = (u_rad - eccentricity_ * sin(u_rad)) / n_rad_s;
   epoch_jday_ = time_jday - dt_s / (24.0 * 60.0 * 60.0);
 }
+
+void OrbitalElements::SaveState(CheckpointWriter& writer) const {
+  writer.Write(semi_major_axis_m_);
+  writer.Write(eccentricity_);
+  writer.Write(inclination_rad_);
+  writer.Write(raan_rad_);
+  writer.Write(arg_perigee_rad_);
+  writer.Write(epoch_jday_);
+}
+
+void OrbitalElements::LoadState(CheckpointReader& reader) {
+  reader.Read(semi_major_axis_m_);
+  reader.Read(eccentricity_);
+  reader.Read(inclination_rad_);
+  reader.Read(raan_rad_);
+  reader.Read(arg_perigee_rad_);
+  reader.Read(epoch_jday_);
+}
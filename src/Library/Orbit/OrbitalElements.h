@@ -5,6 +5,7 @@
 
 #pragma once
 #include "../math/Vector.hpp"
+#include "../utils/Checkpoint.hpp"
 
 /**
  * @class OrbitalElements
@@ -76,6 +77,17 @@ class OrbitalElements {
    */
   inline double GetEpoch() const { return epoch_jday_; }
 
+  /**
+   * @fn SaveState
+   * @brief Write the orbital elements into the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the orbital elements written by SaveState
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   // Common Variables
   // Shape
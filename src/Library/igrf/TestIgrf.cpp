@@ -0,0 +1,59 @@
+/**
+ * @file TestIgrf.cpp
+ * @brief Test codes for IgrfModel with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#include "igrf.h"
+
+namespace {
+
+const std::string kCoefficientFile = std::string(S2E_TEST_SOURCE_DIR) + "/src/Library/igrf/igrf13.coef";
+
+}  // namespace
+
+/**
+ * @brief The cached coefficients are the same as the newly calculated ones in an epoch interval and across the epochs
+ */
+TEST(Igrf, CachedCoefficients) {
+  if (!std::filesystem::exists(kCoefficientFile)) GTEST_SKIP() << "The coefficient file is not found: " << kCoefficientFile;
+  const IgrfModel& model = IgrfModel::Load(kCoefficientFile);
+
+  IgrfCoefficients cached;
+  // Before the first epoch, in an interval, across the epochs, back to the past, and after the last epoch
+  for (const double decyear : {1899.5, 2012.3, 2014.99, 2015.0, 2019.7, 2021.2, 2016.4, 2026.1}) {
+    model.CalcCoefficients(decyear, cached);
+    IgrfCoefficients calculated;
+    model.CalcCoefficients(decyear, calculated);
+
+    ASSERT_EQ(calculated.max_degree, cached.max_degree);
+    for (int n = 0; n <= cached.max_degree; n++) {
+      for (int m = 0; m <= cached.max_degree; m++) {
+        EXPECT_EQ(calculated.g[m][n], cached.g[m][n]) << "decyear " << decyear << ", m " << m << ", n " << n;
+      }
+    }
+  }
+}
+
+/**
+ * @brief The field is calculated with the coefficients of the epoch before the year
+ */
+TEST(Igrf, EpochInterval) {
+  if (!std::filesystem::exists(kCoefficientFile)) GTEST_SKIP() << "The coefficient file is not found: " << kCoefficientFile;
+  const IgrfModel& model = IgrfModel::Load(kCoefficientFile);
+
+  // The coefficients at an epoch are those of the file, and they are continuous at the epoch
+  IgrfCoefficients coef;
+  model.CalcCoefficients(2020.0, coef);
+  EXPECT_DOUBLE_EQ(-29404.8, coef.g[0][1]);
+  EXPECT_DOUBLE_EQ(2020.0, coef.epoch_year);
+  EXPECT_DOUBLE_EQ(2020.0, coef.interval_begin);
+  model.CalcCoefficients(2019.999999, coef);
+  EXPECT_NEAR(-29404.8, coef.g[0][1], 1.0e-3);
+  EXPECT_DOUBLE_EQ(2015.0, coef.epoch_year);
+  EXPECT_DOUBLE_EQ(2015.0, coef.interval_begin);
+  EXPECT_DOUBLE_EQ(2020.0, coef.interval_end);
+}
@@ -7,24 +7,115 @@
 #ifndef __igrf_H__
 #define __igrf_H__
 
-extern double testglobal[3];
+#include <string>
+#include <vector>
+
+/**
+ * @struct IgrfCoefficients
+ * @brief Time-interpolated Schmidt semi-normalized coefficients of IGRF
+ * @details Owned by each user of IgrfModel as a cache. The coefficients at the epoch and their secular variation are copied only when the year
+ * leaves the interval between the epochs, and the coefficients of the year are evaluated from them with the elapsed years at each change of the year.
+ */
+struct IgrfCoefficients {
+  static const int kMaxDegree = 19;  //!< Maximum degree supported by the model
+
+  bool is_calculated = false;                         //!< Flag to show the coefficients are calculated
+  double decyear = 0.0;                               //!< Decimal year of the coefficients
+  double epoch_year = 0.0;                            //!< Year of the epoch of the interval
+  double interval_begin = 0.0;                        //!< Beginning of the interval where the epoch is used [year]
+  double interval_end = 0.0;                          //!< End of the interval where the epoch is used (not included) [year]
+  int max_degree = 0;                                 //!< Maximum degree of the coefficients
+  double gh[kMaxDegree + 1][kMaxDegree + 1] = {{}};   //!< Coefficients at the epoch in the same layout as g
+  double ght[kMaxDegree + 1][kMaxDegree + 1] = {{}};  //!< Secular variation of the coefficients per year in the same layout as g
+  double g[kMaxDegree + 1][kMaxDegree + 1] = {{}};    //!< Coefficients of the year. g[m][n] for g(n,m) and g[n][m-1] for h(n,m).
+};
+
+/**
+ * @class IgrfModel
+ * @brief IGRF model loaded from a coefficient file
+ * @details The coefficient table is loaded once for each file and is never changed after that. All calculation functions are const and keep
+ * their working memory on the stack, so they can be called from many threads at the same time.
+ */
+class IgrfModel {
+ public:
+  /**
+   * @fn Load
+   * @brief Return the model of the coefficient file. The file is read at the first call for the file.
+   * @param [in] file_name: Path to the coefficient file (e.g. igrf13.coef)
+   */
+  static const IgrfModel& Load(const std::string& file_name);
+
+  /**
+   * @fn CalcCoefficients
+   * @brief Calculate the time-interpolated coefficients
+   * @param [in] decyear: Decimal year
+   * @param [in,out] coef: Coefficients. The epoch is searched only when the year is out of the cached interval.
+   */
+  void CalcCoefficients(const double decyear, IgrfCoefficients& coef) const;
+  /**
+   * @fn CalcMagGeocentric
+   * @brief Calculate the magnetic field in the local geocentric frame (North, East, Down)
+   * @param [in] coef: Time-interpolated coefficients
+   * @param [in] lat_deg: Geodetic latitude [deg]
+   * @param [in] lon_deg: Longitude [deg]
+   * @param [in] alt_km: Altitude [km]
+   * @param [out] mag: Magnetic field [nT]
+   * @param [out] cos_theta: Cosine of the geocentric colatitude
+   */
+  void CalcMagGeocentric(const IgrfCoefficients& coef, const double lat_deg, const double lon_deg, const double alt_km, double mag[3],
+                         double& cos_theta) const;
+  /**
+   * @fn CalcMagEci
+   * @brief Calculate the magnetic field in the ECI frame
+   * @param [in] decyear: Decimal year
+   * @param [in] latrad: Geodetic latitude [rad]
+   * @param [in] lonrad: Longitude [rad]
+   * @param [in] alt: Altitude [m]
+   * @param [in] side: Greenwich sidereal time [rad]
+   * @param [in,out] coef: Cache of the time-interpolated coefficients
+   * @param [out] mag: Magnetic field in the ECI frame [nT]
+   */
+  void CalcMagEci(const double decyear, const double latrad, const double lonrad, const double alt, const double side, IgrfCoefficients& coef,
+                  double mag[3]) const;
+
+ private:
+  /**
+   * @struct Epoch
+   * @brief Schmidt semi-normalized coefficients and their secular variation of an epoch
+   */
+  struct Epoch {
+    double year;                                                                     //!< Year of the epoch
+    int max_degree;                                                                  //!< Maximum degree of the non-zero coefficients
+    double gh[IgrfCoefficients::kMaxDegree + 1][IgrfCoefficients::kMaxDegree + 1];   //!< Coefficients at the epoch
+    double ght[IgrfCoefficients::kMaxDegree + 1][IgrfCoefficients::kMaxDegree + 1];  //!< Secular variation per year
+  };
+  std::vector<Epoch> epochs_;  //!< Epochs in ascending order
+
+  /**
+   * @fn IgrfModel
+   * @brief Constructor. Read the coefficient file.
+   * @param [in] file_name: Path to the coefficient file
+   */
+  explicit IgrfModel(const std::string& file_name);
+  /**
+   * @fn FindEpoch
+   * @brief Return the index of the epoch used for the year
+   */
+  size_t FindEpoch(const double decyear) const;
+};
 
-void set_file_path(const char *fname);
-void field(double are, double aflat, double ara, int maxoda);
-void tcoef(double *agh, double *aght, double atzero, int kexta, double aext[3]);
-void tyear(double ayear);
-void mfldg(double alat, double alon, double ahi, double *ax, double *ay, double *az, double *af);
-void mfldc(double athe, double alon, double ar, double *ax, double *ay, double *az, double *af);
-void gcomp(double *axg, double *ayg, double *azg);
-void gigrf(int gen, double year);
-void igrfc(double fido, double fkeido, double hght, double *tf);
-void igrfresult(double *mag, double *theta);
-void igrfm(double fm[6]);
-void sigrf(double year);
-void sdgrf(double year);
-void spgrf(double year);
-void igrfelement(double *mag, double *thetarad);
 int TransMagaxisToECI(const double *mag, double *pos, double lonrad, double thetarad, double gmst);
+
+/**
+ * @fn set_file_path
+ * @brief Set the coefficient file used by IgrfCalc
+ */
+void set_file_path(const char *fname);
+/**
+ * @fn IgrfCalc
+ * @brief Calculate the magnetic field in the ECI frame with the coefficient file set by set_file_path
+ * @note Compatibility wrapper of IgrfModel::CalcMagEci
+ */
 void IgrfCalc(double decyear, double latrad, double lonrad, double alt, double side, double *mag);
 
-#endif  //__igrf_H__
\ No newline at end of file
+#endif  //__igrf_H__
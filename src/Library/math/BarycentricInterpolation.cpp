@@ -0,0 +1,62 @@
+/**
+ * @file BarycentricInterpolation.cpp
+ * @brief Interpolation with the barycentric form of the Lagrange and trigonometric bases
+ * @note Ref: J.-P. Berrut and L. N. Trefethen, "Barycentric Lagrange interpolation", SIAM Review, 46(3), 2004.
+ */
+
+#include "BarycentricInterpolation.hpp"
+using libra::BarycentricInterpolation;
+
+#include <cmath>  //sin
+
+BarycentricInterpolation::BarycentricInterpolation() : basis_(InterpolationBasis::kLagrange), angular_frequency_(0.0) {}
+
+void BarycentricInterpolation::SetNodes(const std::vector<double>& nodes, const InterpolationBasis basis, const double angular_frequency) {
+  nodes_ = nodes;
+  basis_ = basis;
+  angular_frequency_ = angular_frequency;
+
+  const size_t n = nodes_.size();
+  weights_.assign(n, 1.0);
+  for (size_t k = 0; k < n; k++) {
+    double denominator = 1.0;
+    for (size_t j = 0; j < n; j++) {
+      if (j == k) continue;
+      denominator *= CalcBasisDifference(nodes_[k] - nodes_[j]);
+    }
+    weights_[k] = 1.0 / denominator;
+  }
+}
+
+void BarycentricInterpolation::CalcCoefficients(const double x, std::vector<double>& coefficients) const {
+  const size_t n = nodes_.size();
+  coefficients.resize(n);
+
+  // First barycentric form: l_k(x) = l(x) * w_k / d(x - x_k) with l(x) = prod_j d(x - x_j)
+  double node_polynomial = 1.0;
+  for (size_t k = 0; k < n; k++) {
+    const double difference = CalcBasisDifference(x - nodes_[k]);
+    if (difference == 0.0) {
+      // x is on a node
+      coefficients.assign(n, 0.0);
+      coefficients[k] = 1.0;
+      return;
+    }
+    coefficients[k] = weights_[k] / difference;
+    node_polynomial *= difference;
+  }
+  for (size_t k = 0; k < n; k++) coefficients[k] *= node_polynomial;
+}
+
+double BarycentricInterpolation::Interpolate(const double x, const std::vector<double>& values) const {
+  std::vector<double> coefficients;
+  CalcCoefficients(x, coefficients);
+  double result = 0.0;
+  for (size_t k = 0; k < coefficients.size(); k++) result += coefficients[k] * values[k];
+  return result;
+}
+
+double BarycentricInterpolation::CalcBasisDifference(const double dx) const {
+  if (basis_ == InterpolationBasis::kTrigonometric) return sin(angular_frequency_ * dx / 2.0);
+  return dx;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file BarycentricInterpolation.hpp
+ * @brief Interpolation with the barycentric form of the Lagrange and trigonometric bases
+ * @note Ref: J.-P. Berrut and L. N. Trefethen, "Barycentric Lagrange interpolation", SIAM Review, 46(3), 2004.
+ */
+
+#ifndef BARYCENTRIC_INTERPOLATION_HPP_
+#define BARYCENTRIC_INTERPOLATION_HPP_
+
+#include <vector>
+
+namespace libra {
+
+/**
+ * @enum InterpolationBasis
+ * @brief Basis function of the interpolation
+ */
+enum class InterpolationBasis {
+  kLagrange = 0,   //!< Lagrange polynomial basis
+  kTrigonometric,  //!< Trigonometric basis: product of sin(w * (x - x_j) / 2) instead of (x - x_j)
+};
+
+/**
+ * @class BarycentricInterpolation
+ * @brief Interpolation with the barycentric form of the Lagrange and trigonometric bases
+ * @details The weights are calculated once for the nodes in O(n^2). The interpolation coefficients at a point are calculated in O(n) and they
+ * are shared by all components of the interpolated values. Except for the rounding errors, the results are equal to the product form
+ * l_k(x) = prod_{j!=k} (x - x_j) / (x_k - x_j).
+ */
+class BarycentricInterpolation {
+ public:
+  /**
+   * @fn BarycentricInterpolation
+   * @brief Default constructor without nodes
+   */
+  BarycentricInterpolation();
+
+  /**
+   * @fn SetNodes
+   * @brief Set the nodes and calculate the barycentric weights
+   * @param [in] nodes: Independent variables of the given values (e.g. time). They must be different with each other.
+   * @param [in] basis: Basis function
+   * @param [in] angular_frequency: Angular frequency w of the trigonometric basis (Not used for the Lagrange basis)
+   */
+  void SetNodes(const std::vector<double>& nodes, const InterpolationBasis basis, const double angular_frequency = 0.0);
+
+  /**
+   * @fn CalcCoefficients
+   * @brief Calculate the coefficients of the given values at x. The interpolated value is sum_k coefficients[k] * values[k].
+   * @param [in] x: Independent variable to interpolate
+   * @param [out] coefficients: Coefficients of the given values (resized to the number of nodes)
+   */
+  void CalcCoefficients(const double x, std::vector<double>& coefficients) const;
+
+  /**
+   * @fn Interpolate
+   * @brief Return the interpolated value at x
+   * @param [in] x: Independent variable to interpolate
+   * @param [in] values: Given values at the nodes
+   */
+  double Interpolate(const double x, const std::vector<double>& values) const;
+
+  /**
+   * @fn GetNodes
+   * @brief Return the nodes
+   */
+  inline const std::vector<double>& GetNodes() const { return nodes_; }
+
+ private:
+  std::vector<double> nodes_;    //!< Independent variables of the given values
+  std::vector<double> weights_;  //!< Barycentric weights 1 / prod_{j!=k} d(x_k - x_j)
+  InterpolationBasis basis_;     //!< Basis function
+  double angular_frequency_;     //!< Angular frequency of the trigonometric basis
+
+  /**
+   * @fn CalcBasisDifference
+   * @brief Return d(dx): dx for the Lagrange basis and sin(w * dx / 2) for the trigonometric basis
+   */
+  double CalcBasisDifference(const double dx) const;
+};
+
+}  // namespace libra
+
+#endif  // BARYCENTRIC_INTERPOLATION_HPP_
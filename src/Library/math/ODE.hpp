@@ -5,16 +5,27 @@
 #ifndef ODE_HPP_
 #define ODE_HPP_
 
+#include <Library/utils/Checkpoint.hpp>
+
 #include "./Vector.hpp"
 
 namespace libra {
 
+/**
+ * @enum OdeMethod
+ * @brief Integration method of ODE
+ */
+enum class OdeMethod {
+  kRk4 = 0,          //!< Classic 4th order Runge-Kutta method with the fixed step width
+  kDormandPrince54,  //!< Dormand-Prince 5(4) method with the adaptive step width and the dense output
+};
+
 /**
  * @class ODE
  * @brief Class for Ordinary Difference Equation
  */
 template <size_t N>
-class ODE {
+class ODE : public ICheckpointable {
  public:
   /**
    * @fn ODE
@@ -51,11 +62,35 @@ class ODE {
    */
   void setStepWidth(double new_step);
 
+  /**
+   * @fn setAdaptiveStep
+   * @brief Use the Dormand-Prince 5(4) method with the adaptive step width in Integrate
+   * @note The current step width is used as the first trial step width.
+   * @param [in] abs_tolerance: Absolute tolerance of the local error of each state element
+   * @param [in] rel_tolerance: Relative tolerance of the local error of each state element
+   */
+  void setAdaptiveStep(double abs_tolerance, double rel_tolerance);
+
   /**
    * @fn step_width
    * @brief Return step width
    */
   inline double step_width() const;
+  /**
+   * @fn method
+   * @brief Return the integration method used in Integrate
+   */
+  inline OdeMethod method() const;
+  /**
+   * @fn adaptive_step_width
+   * @brief Return the next trial step width of the adaptive step method
+   */
+  inline double adaptive_step_width() const;
+  /**
+   * @fn rhs_count
+   * @brief Return the number of the evaluations of RHS in Update and Integrate
+   */
+  inline size_t rhs_count() const;
 
   /**
    * @fn x
@@ -90,10 +125,39 @@ class ODE {
 
   /**
    * @fn Update
-   * @brief Update the state
+   * @brief Update the state with one step of the 4th order Runge-Kutta method
    */
   void Update();
 
+  /**
+   * @fn Integrate
+   * @brief Integrate the state until the independent variable reaches x_end
+   * @details With kRk4, the state is updated with the fixed step width and the last step is shortened to reach x_end. With kDormandPrince54,
+   * the step width is controlled to satisfy the tolerances and the last step is shortened to reach x_end. The controlled step width is kept for
+   * the next call, so the step width is not limited by the interval of the calls.
+   * @param [in] x_end: Target value of the independent variable
+   */
+  void Integrate(double x_end);
+
+  /**
+   * @fn DenseOutput
+   * @brief Return the interpolated state in the last step of the adaptive step method (4th order accuracy)
+   * @param [in] x: Independent variable in the last step
+   */
+  Vector<N> DenseOutput(double x) const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the independent variable, the state vector, and the step width control
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  protected:
   /**
    * @fn state
@@ -106,6 +170,26 @@ class ODE {
   Vector<N> state_;    //!< Latest state vector
   Vector<N> rhs_;      //!< Latest differentiate of the state vector
   double step_width_;  //!< Step width
+  size_t rhs_count_;   //!< Number of the evaluations of RHS
+
+  // Adaptive step method
+  OdeMethod method_;            //!< Integration method used in Integrate
+  double abs_tolerance_;        //!< Absolute tolerance of the local error
+  double rel_tolerance_;        //!< Relative tolerance of the local error
+  double adaptive_step_width_;  //!< Next trial step width
+  double last_x_;               //!< Independent variable at the beginning of the last step
+  double last_step_width_;      //!< Step width of the last step
+  Vector<N> dense_coeffs_[5];   //!< Coefficients of the dense output in the last step
+
+  /**
+   * @fn DormandPrinceStep
+   * @brief Try one step of the Dormand-Prince 5(4) method. The state is updated when the error is within the tolerance.
+   * @param [in] step_width: Step width
+   * @param [in] is_forced: Accept the step regardless of the error
+   * @param [out] error_norm: Normalized error of the step (accepted when it is 1 or less)
+   * @return True when the step is accepted
+   */
+  bool DormandPrinceStep(double step_width, bool is_forced, double& error_norm);
 };
 
 }  // namespace libra
@@ -16,6 +16,21 @@ double ODE<N>::step_width() const {
   return step_width_;
 }
 
+template <size_t N>
+OdeMethod ODE<N>::method() const {
+  return method_;
+}
+
+template <size_t N>
+double ODE<N>::adaptive_step_width() const {
+  return adaptive_step_width_;
+}
+
+template <size_t N>
+size_t ODE<N>::rhs_count() const {
+  return rhs_count_;
+}
+
 template <size_t N>
 double ODE<N>::x() const {
   return x_;
@@ -5,10 +5,24 @@
 #ifndef ODE_TFS_HPP_
 #define ODE_TFS_HPP_
 
+#include <algorithm>
+#include <cmath>
+
 namespace libra {
 
 template <size_t N>
-ODE<N>::ODE(double step_width) : x_(0.0), state_(0.0), rhs_(0.0), step_width_(step_width) {}
+ODE<N>::ODE(double step_width)
+    : x_(0.0),
+      state_(0.0),
+      rhs_(0.0),
+      step_width_(step_width),
+      rhs_count_(0),
+      method_(OdeMethod::kRk4),
+      abs_tolerance_(0.0),
+      rel_tolerance_(0.0),
+      adaptive_step_width_(step_width),
+      last_x_(0.0),
+      last_step_width_(0.0) {}
 
 template <size_t N>
 void ODE<N>::setup(double init_x, const Vector<N>& init_cond) {
@@ -16,6 +30,40 @@ void ODE<N>::setup(double init_x, const Vector<N>& init_cond) {
   state_ = init_cond;
 }
 
+template <size_t N>
+void ODE<N>::SaveState(CheckpointWriter& writer) const {
+  writer.Write(x_);
+  writer.Write(state_);
+  writer.Write(rhs_);
+  writer.Write(step_width_);
+  writer.Write((uint64_t)rhs_count_);
+  writer.Write(method_);
+  writer.Write(abs_tolerance_);
+  writer.Write(rel_tolerance_);
+  writer.Write(adaptive_step_width_);
+  writer.Write(last_x_);
+  writer.Write(last_step_width_);
+  writer.Write(dense_coeffs_);
+}
+
+template <size_t N>
+void ODE<N>::LoadState(CheckpointReader& reader) {
+  uint64_t rhs_count = 0;
+  reader.Read(x_);
+  reader.Read(state_);
+  reader.Read(rhs_);
+  reader.Read(step_width_);
+  reader.Read(rhs_count);
+  reader.Read(method_);
+  reader.Read(abs_tolerance_);
+  reader.Read(rel_tolerance_);
+  reader.Read(adaptive_step_width_);
+  reader.Read(last_x_);
+  reader.Read(last_step_width_);
+  reader.Read(dense_coeffs_);
+  rhs_count_ = (size_t)rhs_count;
+}
+
 template <size_t N>
 ODE<N>& ODE<N>::operator++() {
   Update();
@@ -24,6 +72,7 @@ ODE<N>& ODE<N>::operator++() {
 
 template <size_t N>
 void ODE<N>::Update() {
+  rhs_count_ += 4;
   RHS(x_, state_, rhs_);  // Current derivative calculation
 
   // 4th order Runge-Kutta method
@@ -47,6 +96,129 @@ template <size_t N>
 void ODE<N>::setStepWidth(double new_step) {
   step_width_ = new_step;
 }
+
+template <size_t N>
+void ODE<N>::setAdaptiveStep(double abs_tolerance, double rel_tolerance) {
+  method_ = OdeMethod::kDormandPrince54;
+  abs_tolerance_ = abs_tolerance;
+  rel_tolerance_ = rel_tolerance;
+  adaptive_step_width_ = step_width_;
+}
+
+template <size_t N>
+void ODE<N>::Integrate(double x_end) {
+  if (method_ == OdeMethod::kRk4) {
+    const double step_width = step_width_;
+    while (x_end - x_ - step_width > 1.0e-6) {
+      Update();
+    }
+    setStepWidth(x_end - x_);  // Adjust the last step width
+    if (step_width_ > 0.0) Update();
+    x_ = x_end;
+    setStepWidth(step_width);
+    return;
+  }
+
+  // Step width control of E. Hairer et al., Solving Ordinary Differential Equations I, Section II.4
+  const double safety = 0.9;
+  const double min_factor = 0.2;
+  const double max_factor = 10.0;
+  bool is_rejected = false;
+  // The derivative is recalculated since the RHS can depend on the external inputs changed after the last call
+  RHS(x_, state_, rhs_);
+  rhs_count_++;
+  while (x_end - x_ > 1.0e-12 * std::max(1.0, std::fabs(x_end))) {
+    const double remaining = x_end - x_;
+    const bool is_last = adaptive_step_width_ >= remaining;
+    const double step_width = is_last ? remaining : adaptive_step_width_;
+    // Accept the step regardless of the error when the step width becomes too small to continue
+    const bool is_minimum = step_width <= 1.0e-12 * std::max(1.0, std::fabs(x_));
+
+    double error_norm;
+    const bool is_accepted = DormandPrinceStep(step_width, is_minimum, error_norm);
+    double factor = (error_norm > 0.0) ? safety * std::pow(error_norm, -0.2) : max_factor;
+    if (is_accepted) {
+      factor = std::min(is_rejected ? 1.0 : max_factor, std::max(min_factor, factor));
+      is_rejected = false;
+      if (is_last) {
+        x_ = x_end;
+        // The shortened last step is not used to shrink the next trial step width
+        adaptive_step_width_ = std::max(adaptive_step_width_, step_width * factor);
+      } else {
+        adaptive_step_width_ = step_width * factor;
+      }
+    } else {
+      factor = std::max(min_factor, std::min(1.0, factor));
+      is_rejected = true;
+      adaptive_step_width_ = step_width * factor;
+    }
+  }
+}
+
+template <size_t N>
+bool ODE<N>::DormandPrinceStep(double step_width, bool is_forced, double& error_norm) {
+  // Butcher tableau of Dormand-Prince 5(4)
+  static const double c2 = 1.0 / 5.0, c3 = 3.0 / 10.0, c4 = 4.0 / 5.0, c5 = 8.0 / 9.0;
+  static const double a21 = 1.0 / 5.0;
+  static const double a31 = 3.0 / 40.0, a32 = 9.0 / 40.0;
+  static const double a41 = 44.0 / 45.0, a42 = -56.0 / 15.0, a43 = 32.0 / 9.0;
+  static const double a51 = 19372.0 / 6561.0, a52 = -25360.0 / 2187.0, a53 = 64448.0 / 6561.0, a54 = -212.0 / 729.0;
+  static const double a61 = 9017.0 / 3168.0, a62 = -355.0 / 33.0, a63 = 46732.0 / 5247.0, a64 = 49.0 / 176.0, a65 = -5103.0 / 18656.0;
+  static const double a71 = 35.0 / 384.0, a73 = 500.0 / 1113.0, a74 = 125.0 / 192.0, a75 = -2187.0 / 6784.0, a76 = 11.0 / 84.0;
+  // Difference between the 5th order and the 4th order solutions
+  static const double e1 = 71.0 / 57600.0, e3 = -71.0 / 16695.0, e4 = 71.0 / 1920.0, e5 = -17253.0 / 339200.0, e6 = 22.0 / 525.0,
+                      e7 = -1.0 / 40.0;
+  // Dense output
+  static const double d1 = -12715105075.0 / 11282082432.0, d3 = 87487479700.0 / 32700410799.0, d4 = -10690763975.0 / 1880347072.0,
+                      d5 = 701980252875.0 / 199316789632.0, d6 = -1453857185.0 / 822651844.0, d7 = 69997945.0 / 29380423.0;
+
+  const double h = step_width;
+  // The derivative at the end of the last accepted step is reused as the first stage (FSAL: First Same As Last)
+  const Vector<N> k1(rhs_);
+  Vector<N> k2(0.0), k3(0.0), k4(0.0), k5(0.0), k6(0.0), k7(0.0);
+  RHS(x_ + c2 * h, state_ + h * (a21 * k1), k2);
+  RHS(x_ + c3 * h, state_ + h * (a31 * k1 + a32 * k2), k3);
+  RHS(x_ + c4 * h, state_ + h * (a41 * k1 + a42 * k2 + a43 * k3), k4);
+  RHS(x_ + c5 * h, state_ + h * (a51 * k1 + a52 * k2 + a53 * k3 + a54 * k4), k5);
+  RHS(x_ + h, state_ + h * (a61 * k1 + a62 * k2 + a63 * k3 + a64 * k4 + a65 * k5), k6);
+  Vector<N> next_state = state_ + h * (a71 * k1 + a73 * k3 + a74 * k4 + a75 * k5 + a76 * k6);
+  RHS(x_ + h, next_state, k7);
+  rhs_count_ += 6;
+
+  Vector<N> error = h * (e1 * k1 + e3 * k3 + e4 * k4 + e5 * k5 + e6 * k6 + e7 * k7);
+  double sum = 0.0;
+  for (size_t i = 0; i < N; i++) {
+    const double scale = abs_tolerance_ + rel_tolerance_ * std::max(std::fabs(state_[i]), std::fabs(next_state[i]));
+    sum += (error[i] / scale) * (error[i] / scale);
+  }
+  error_norm = std::sqrt(sum / N);
+  if (error_norm > 1.0 && !is_forced) return false;
+
+  // Coefficients of the dense output
+  Vector<N> diff = next_state - state_;
+  Vector<N> bspl = h * k1 - diff;
+  dense_coeffs_[0] = state_;
+  dense_coeffs_[1] = diff;
+  dense_coeffs_[2] = bspl;
+  dense_coeffs_[3] = diff - h * k7 - bspl;
+  dense_coeffs_[4] = h * (d1 * k1 + d3 * k3 + d4 * k4 + d5 * k5 + d6 * k6 + d7 * k7);
+  last_x_ = x_;
+  last_step_width_ = h;
+
+  state_ = next_state;
+  rhs_ = k7;
+  x_ += h;
+  return true;
+}
+
+template <size_t N>
+Vector<N> ODE<N>::DenseOutput(double x) const {
+  if (last_step_width_ <= 0.0) return state_;
+  const double theta = (x - last_x_) / last_step_width_;
+  const double theta1 = 1.0 - theta;
+  return dense_coeffs_[0] +
+         theta * (dense_coeffs_[1] + theta1 * (dense_coeffs_[2] + theta * (dense_coeffs_[3] + theta1 * dense_coeffs_[4])));
+}
 }  // namespace libra
 
 #endif  // ODE_TFS_HPP_
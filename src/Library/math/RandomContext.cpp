@@ -0,0 +1,50 @@
+/**
+ * @file RandomContext.cpp
+ * @brief Class to manage the random number streams of a simulation
+ */
+
+#include "RandomContext.hpp"
+using libra::RandomContext;
+using libra::RandomStream;
+
+#include "Ran0.hpp"
+
+thread_local RandomContext* RandomContext::current_ = nullptr;
+
+RandomContext::RandomContext() : RandomContext(kDefaultSeed, 0) {}
+
+RandomContext::RandomContext(const uint64_t seed, const uint32_t case_id)
+    : seed_(seed), case_id_(case_id), satellite_id_(kNoSatellite) {}
+
+RandomContext RandomContext::CreateSatelliteContext(const uint32_t satellite_id) const {
+  RandomContext context(seed_, case_id_);
+  context.satellite_id_ = satellite_id;
+  return context;
+}
+
+RandomStream RandomContext::MakeStream(const std::string& stream_name) {
+  // The component ID is the 32 bit FNV-1a hash of the name and its occurrence, so it does not depend on the other streams
+  const std::string key = stream_name + "#" + std::to_string(stream_counts_[stream_name]++);
+  uint32_t component_id = 0x811c9dc5;
+  for (const char c : key) {
+    component_id ^= (uint8_t)c;
+    component_id *= 0x01000193;
+  }
+  return RandomStream(seed_, case_id_, satellite_id_, component_id);
+}
+
+long RandomContext::MakeSeed(const std::string& stream_name) {
+  RandomStream stream = MakeStream(stream_name);
+  return 1 + (long)(stream() % (uint32_t)(Ran0::M - 1));
+}
+
+RandomContext& RandomContext::GetCurrent() {
+  // The spacecraft made without the scope use the default context. Its streams are also keyed by their names.
+  static thread_local RandomContext default_context;
+  if (current_ == nullptr) return default_context;
+  return *current_;
+}
+
+RandomContext::Scope::Scope(RandomContext& context) : previous_(current_) { current_ = &context; }
+
+RandomContext::Scope::~Scope() { current_ = previous_; }
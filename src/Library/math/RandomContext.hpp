@@ -0,0 +1,126 @@
+/**
+ * @file RandomContext.hpp
+ * @brief Class to manage the random number streams of a simulation
+ */
+
+#ifndef RANDOM_CONTEXT_HPP_
+#define RANDOM_CONTEXT_HPP_
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "RandomStream.hpp"
+
+namespace libra {
+
+/**
+ * @class RandomContext
+ * @brief Class to manage the random number streams of a simulation
+ * @details The context is identified by the seed, the case ID, and the satellite ID. Each noise source takes a substream which is keyed by these
+ * IDs and the component ID made from the name of the stream (e.g. "STT0/ortho"). The random values of a noise source therefore do not depend on
+ * the other cases, satellites, and noise sources nor on the order of the construction. Adding a component does not change the noises of the
+ * others. When the same name is requested again in a context, the occurrence is counted and the next substream of the name is returned.
+ * Noise sources take the substream from the current context of the thread, which is set by Scope while the simulation objects are constructed.
+ */
+class RandomContext {
+ public:
+  static const uint64_t kDefaultSeed = 0xdeadbeef;     //!< Seed used when no seed is specified
+  static const uint32_t kNoSatellite = 0xffffffff;     //!< Satellite ID of the context which is not related to a satellite
+
+  /**
+   * @fn RandomContext
+   * @brief Default constructor with the default seed
+   */
+  RandomContext();
+  /**
+   * @fn RandomContext
+   * @brief Constructor
+   * @param [in] seed: Seed of the simulation
+   * @param [in] case_id: ID of the simulation case (e.g. index of the Monte-Carlo case)
+   */
+  RandomContext(const uint64_t seed, const uint32_t case_id);
+
+  /**
+   * @fn CreateSatelliteContext
+   * @brief Create the context for a satellite in this case
+   * @param [in] satellite_id: ID of the satellite
+   */
+  RandomContext CreateSatelliteContext(const uint32_t satellite_id) const;
+
+  /**
+   * @fn MakeStream
+   * @brief Make the substream of a name
+   * @param [in] stream_name: Name of the stream unique in the context (e.g. the component name and its ID)
+   */
+  RandomStream MakeStream(const std::string& stream_name);
+  /**
+   * @fn MakeSeed
+   * @brief Make a seed for the Ran0 based random generators (NormalRand etc.) from the substream of a name
+   * @param [in] stream_name: Name of the stream unique in the context (e.g. the component name and its ID)
+   * @return Seed in [1, Ran0::M - 1]
+   */
+  long MakeSeed(const std::string& stream_name);
+
+  // Getter
+  /**
+   * @fn GetSeed
+   * @brief Return the seed of the simulation
+   */
+  inline uint64_t GetSeed() const { return seed_; }
+  /**
+   * @fn GetCaseId
+   * @brief Return the ID of the simulation case
+   */
+  inline uint32_t GetCaseId() const { return case_id_; }
+  /**
+   * @fn GetSatelliteId
+   * @brief Return the ID of the satellite
+   */
+  inline uint32_t GetSatelliteId() const { return satellite_id_; }
+
+  /**
+   * @fn GetCurrent
+   * @brief Return the current context of the thread
+   * @note When no Scope is active in the thread, the default context of the thread (the default seed without the satellite ID) is returned.
+   * Open the Scope of Spacecraft::random_context_ in the constructors of the user defined spacecraft to make the noises depend on the seed,
+   * the case, and the satellite.
+   */
+  static RandomContext& GetCurrent();
+
+  /**
+   * @class Scope
+   * @brief Set the current context of the thread during the lifetime of this object
+   */
+  class Scope {
+   public:
+    /**
+     * @fn Scope
+     * @brief Constructor. The context becomes the current context of the thread.
+     * @param [in] context: Context
+     */
+    explicit Scope(RandomContext& context);
+    /**
+     * @fn ~Scope
+     * @brief Destructor. The previous context is restored.
+     */
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    RandomContext* previous_;  //!< Previous current context
+  };
+
+ private:
+  uint64_t seed_;                                  //!< Seed of the simulation
+  uint32_t case_id_;                               //!< ID of the simulation case
+  uint32_t satellite_id_;                          //!< ID of the satellite
+  std::map<std::string, uint32_t> stream_counts_;  //!< Number of the substreams made for each name
+
+  static thread_local RandomContext* current_;  //!< Current context of the thread
+};
+
+}  // namespace libra
+
+#endif  // RANDOM_CONTEXT_HPP_
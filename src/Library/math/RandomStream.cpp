@@ -0,0 +1,67 @@
+/**
+ * @file RandomStream.cpp
+ * @brief Counter-based random number generator with the Philox4x32-10 method
+ * @note Ref: J. K. Salmon, et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11, 2011.
+ */
+
+#include "RandomStream.hpp"
+using libra::RandomStream;
+
+#include <cfloat>  //DBL_EPSILON
+#include <cmath>   //sqrt, log
+
+static const uint32_t PHILOX_M0 = 0xD2511F53;  //!< Multiplier of the first round function
+static const uint32_t PHILOX_M1 = 0xCD9E8D57;  //!< Multiplier of the second round function
+static const uint32_t PHILOX_W0 = 0x9E3779B9;  //!< Key schedule constant (golden ratio)
+static const uint32_t PHILOX_W1 = 0xBB67AE85;  //!< Key schedule constant (sqrt(3) - 1)
+
+RandomStream::RandomStream() : RandomStream(0, 0, 0, 0) {}
+
+RandomStream::RandomStream(const uint64_t key, const uint32_t id0, const uint32_t id1, const uint32_t id2) : position_(4) {
+  key_[0] = (uint32_t)key;
+  key_[1] = (uint32_t)(key >> 32);
+  counter_[0] = id0;
+  counter_[1] = id1;
+  counter_[2] = id2;
+  counter_[3] = 0;
+  for (int i = 0; i < 4; i++) output_[i] = 0;
+}
+
+void RandomStream::Philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]) {
+  uint32_t c[4] = {counter[0], counter[1], counter[2], counter[3]};
+  uint32_t k[2] = {key[0], key[1]};
+  for (int round = 0; round < 10; round++) {
+    uint64_t p0 = (uint64_t)PHILOX_M0 * c[0];
+    uint64_t p1 = (uint64_t)PHILOX_M1 * c[2];
+    uint32_t next[4] = {(uint32_t)(p1 >> 32) ^ c[1] ^ k[0], (uint32_t)p1, (uint32_t)(p0 >> 32) ^ c[3] ^ k[1], (uint32_t)p0};
+    for (int i = 0; i < 4; i++) c[i] = next[i];
+    k[0] += PHILOX_W0;
+    k[1] += PHILOX_W1;
+  }
+  for (int i = 0; i < 4; i++) output[i] = c[i];
+}
+
+RandomStream::result_type RandomStream::operator()() {
+  if (position_ >= 4) {
+    Philox4x32(counter_, key_, output_);
+    counter_[3]++;
+    position_ = 0;
+  }
+  return output_[position_++];
+}
+
+double RandomStream::GenerateUniform() {
+  uint32_t a = (*this)() >> 5;  // 27 bits
+  uint32_t b = (*this)() >> 6;  // 26 bits
+  return (a * 67108864.0 + b) / 9007199254740992.0;
+}
+
+double RandomStream::GenerateNormal() {
+  double v1, v2, rsq;
+  do {
+    v1 = 2.0 * GenerateUniform() - 1.0;
+    v2 = 2.0 * GenerateUniform() - 1.0;
+    rsq = v1 * v1 + v2 * v2;
+  } while (rsq >= 1.0 || rsq < DBL_EPSILON);
+  return v2 * std::sqrt(-2.0 * std::log(rsq) / rsq);
+}
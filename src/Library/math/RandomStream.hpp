@@ -0,0 +1,86 @@
+/**
+ * @file RandomStream.hpp
+ * @brief Counter-based random number generator with the Philox4x32-10 method
+ * @note Ref: J. K. Salmon, et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11, 2011.
+ */
+
+#ifndef RANDOM_STREAM_HPP_
+#define RANDOM_STREAM_HPP_
+
+#include <cstdint>
+
+namespace libra {
+
+/**
+ * @class RandomStream
+ * @brief Counter-based random number generator with the Philox4x32-10 method
+ * @details The output is a pure function of the key, the stream ID, and the number of generated values. Streams with different IDs are
+ * statistically independent, so a stream can be created for each user without sharing state. The class satisfies the requirements of
+ * UniformRandomBitGenerator.
+ */
+class RandomStream {
+ public:
+  typedef uint32_t result_type;  //!< Type of the generated value
+
+  /**
+   * @fn RandomStream
+   * @brief Default constructor with zero key and zero stream ID
+   */
+  RandomStream();
+  /**
+   * @fn RandomStream
+   * @brief Constructor
+   * @param [in] key: Key of the generator (seed)
+   * @param [in] id0: First element of the stream ID
+   * @param [in] id1: Second element of the stream ID
+   * @param [in] id2: Third element of the stream ID
+   */
+  RandomStream(const uint64_t key, const uint32_t id0, const uint32_t id1, const uint32_t id2);
+
+  /**
+   * @fn min
+   * @brief Return the minimum of the generated value
+   */
+  static constexpr result_type min() { return 0; }
+  /**
+   * @fn max
+   * @brief Return the maximum of the generated value
+   */
+  static constexpr result_type max() { return 0xffffffff; }
+
+  /**
+   * @fn operator()
+   * @brief Generate a 32 bit random value
+   */
+  result_type operator()();
+  /**
+   * @fn GenerateUniform
+   * @brief Generate a random value with the uniform distribution in [0, 1) with 53 bit resolution
+   */
+  double GenerateUniform();
+  /**
+   * @fn GenerateNormal
+   * @brief Generate a random value with the standard normal distribution with the Box-Muller method
+   * @note The result does not depend on the implementation of the standard library.
+   */
+  double GenerateNormal();
+
+  /**
+   * @fn Philox4x32
+   * @brief Philox4x32-10 block function
+   * @param [in] counter: Counter
+   * @param [in] key: Key
+   * @param [out] output: Random values
+   */
+  static void Philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]);
+
+ private:
+  uint32_t key_[2];      //!< Key of the generator
+  uint32_t counter_[4];  //!< Counter. The first three elements are the stream ID and the last element is the block index.
+  uint32_t output_[4];   //!< Random values of the current block
+  int position_;         //!< Index of the next value in the current block. 4 means that the block is used up.
+};
+
+}  // namespace libra
+
+#endif  // RANDOM_STREAM_HPP_
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "./NormalRand.hpp"
 #include "./ODE.hpp"
 #include "./Vector.hpp"
@@ -22,8 +24,9 @@ class RandomWalk : public libra::ODE<N> {
    * @param step_width: Step width
    * @param stddev: Standard deviation of random walk excitation noise
    * @param limit: Limit of random walk
+   * @param random_stream_name: Name of the random streams in the current RandomContext. Use a name unique in the spacecraft.
    */
-  RandomWalk(double step_width, const libra::Vector<N>& stddev, const libra::Vector<N>& limit);
+  RandomWalk(double step_width, const libra::Vector<N>& stddev, const libra::Vector<N>& limit, const std::string& random_stream_name = "RandomWalk");
 
   /**
    * @fn RHS
@@ -34,6 +37,18 @@ class RandomWalk : public libra::ODE<N> {
    */
   virtual void RHS(double x, const libra::Vector<N>& state, libra::Vector<N>& rhs);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the states of the integration and the excitation noise
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   libra::Vector<N> limit_;    //!< Limit of random walk
   libra::NormalRand nrs_[N];  //!< Random walk excitation noise
@@ -5,16 +5,16 @@
 
 #pragma once
 
-#include <Library/math/GlobalRand.h>
+#include <Library/math/RandomContext.hpp>
 
 #include <Library/utils/Macros.hpp>
 
 template <size_t N>
-RandomWalk<N>::RandomWalk(double step_width, const libra::Vector<N>& stddev, const libra::Vector<N>& limit)
+RandomWalk<N>::RandomWalk(double step_width, const libra::Vector<N>& stddev, const libra::Vector<N>& limit, const std::string& random_stream_name)
     : libra::ODE<N>(step_width), limit_(limit) {
   // Set standard deviation
   for (size_t i = 0; i < N; ++i) {
-    nrs_[i].set_param(0.0, stddev[i], g_rand.MakeSeed());
+    nrs_[i].set_param(0.0, stddev[i], libra::RandomContext::GetCurrent().MakeSeed(random_stream_name));
   }
 }
 
@@ -31,3 +31,15 @@ void RandomWalk<N>::RHS(double x, const libra::Vector<N>& state, libra::Vector<N
       rhs[i] = nrs_[i];
   }
 }
+
+template <size_t N>
+void RandomWalk<N>::SaveState(CheckpointWriter& writer) const {
+  libra::ODE<N>::SaveState(writer);
+  writer.Write(nrs_);
+}
+
+template <size_t N>
+void RandomWalk<N>::LoadState(CheckpointReader& reader) {
+  libra::ODE<N>::LoadState(reader);
+  reader.Read(nrs_);
+}
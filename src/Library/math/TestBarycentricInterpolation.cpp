@@ -0,0 +1,89 @@
+/**
+ * @file TestBarycentricInterpolation.cpp
+ * @brief Test codes for BarycentricInterpolation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "BarycentricInterpolation.hpp"
+
+namespace {
+
+/**
+ * @fn CalcProductForm
+ * @brief Interpolate with the product form of the basis as the reference
+ */
+double CalcProductForm(const std::vector<double>& nodes, const std::vector<double>& values, const double x, const bool is_trigonometric,
+                       const double w) {
+  double result = 0.0;
+  for (size_t k = 0; k < nodes.size(); k++) {
+    double l_k = 1.0;
+    for (size_t j = 0; j < nodes.size(); j++) {
+      if (j == k) continue;
+      if (is_trigonometric) {
+        l_k *= sin(w * (x - nodes[j]) / 2.0) / sin(w * (nodes[k] - nodes[j]) / 2.0);
+      } else {
+        l_k *= (x - nodes[j]) / (nodes[k] - nodes[j]);
+      }
+    }
+    result += l_k * values[k];
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(BarycentricInterpolation, LagrangeReproducesPolynomial) {
+  std::vector<double> nodes, values;
+  for (int i = 0; i < 5; i++) {
+    const double x = 1.0e9 + 900.0 * i;  // Unix time like nodes
+    nodes.push_back(x);
+    const double t = (x - 1.0e9) / 900.0;
+    values.push_back(2.0 - 3.0 * t + 0.5 * t * t * t * t);
+  }
+  libra::BarycentricInterpolation interpolation;
+  interpolation.SetNodes(nodes, libra::InterpolationBasis::kLagrange);
+
+  for (int i = 0; i <= 40; i++) {
+    const double x = 1.0e9 + 90.0 * i + 12.3;
+    const double t = (x - 1.0e9) / 900.0;
+    EXPECT_NEAR(2.0 - 3.0 * t + 0.5 * t * t * t * t, interpolation.Interpolate(x, values), 1.0e-9);
+  }
+}
+
+TEST(BarycentricInterpolation, OnNode) {
+  std::vector<double> nodes = {0.0, 1.0, 2.0, 4.0};
+  std::vector<double> values = {3.0, -1.0, 5.0, 7.0};
+  libra::BarycentricInterpolation interpolation;
+  interpolation.SetNodes(nodes, libra::InterpolationBasis::kLagrange);
+  for (size_t k = 0; k < nodes.size(); k++) {
+    EXPECT_DOUBLE_EQ(values[k], interpolation.Interpolate(nodes[k], values));
+  }
+}
+
+TEST(BarycentricInterpolation, TrigonometricMatchesProductForm) {
+  const double w = 2.0 * M_PI / 86400.0 * 1.03;
+  std::vector<double> nodes, values;
+  for (int i = 0; i < 9; i++) {
+    // Non-uniform nodes with a missing epoch
+    nodes.push_back(1.6e9 + 900.0 * (i < 4 ? i : i + 1));
+    values.push_back(2.6e7 * cos(1.4e-4 * 900.0 * i) + 1.0e3 * i);
+  }
+  libra::BarycentricInterpolation interpolation;
+  interpolation.SetNodes(nodes, libra::InterpolationBasis::kTrigonometric, w);
+
+  std::vector<double> coefficients;
+  for (int i = 0; i <= 80; i++) {
+    const double x = 1.6e9 + 100.0 * i + 0.25;
+    const double reference = CalcProductForm(nodes, values, x, true, w);
+    EXPECT_NEAR(reference, interpolation.Interpolate(x, values), 1.0e-6 * std::fabs(reference) + 1.0e-6);
+
+    // The coefficients sum to one for an odd number of the trigonometric nodes
+    interpolation.CalcCoefficients(x, coefficients);
+    double sum = 0.0;
+    for (const double c : coefficients) sum += c;
+    EXPECT_NEAR(1.0, sum, 1.0e-9);
+  }
+}
@@ -0,0 +1,118 @@
+/**
+ * @file TestODE.cpp
+ * @brief Test codes for ODE class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <sstream>
+
+#include "ODE.hpp"
+
+namespace {
+
+/**
+ * @class HarmonicOscillator
+ * @brief Harmonic oscillator x'' = -x with x(0) = 1 and x'(0) = 0. The solution is x = cos(t).
+ */
+class HarmonicOscillator : public libra::ODE<2> {
+ public:
+  explicit HarmonicOscillator(double step_width) : libra::ODE<2>(step_width) {
+    libra::Vector<2> init_state;
+    init_state[0] = 1.0;
+    init_state[1] = 0.0;
+    setup(0.0, init_state);
+  }
+  void RHS(double x, const libra::Vector<2>& state, libra::Vector<2>& rhs) {
+    (void)x;
+    rhs[0] = state[1];
+    rhs[1] = -state[0];
+  }
+};
+
+}  // namespace
+
+TEST(ODE, Rk4IntegrateReachesEnd) {
+  HarmonicOscillator ode(0.3);
+  ode.Integrate(1.0);
+  EXPECT_DOUBLE_EQ(1.0, ode.x());
+  EXPECT_DOUBLE_EQ(0.3, ode.step_width());
+  EXPECT_NEAR(std::cos(1.0), ode[0], 1.0e-4);
+}
+
+TEST(ODE, DormandPrinceAccuracy) {
+  HarmonicOscillator ode(0.1);
+  ode.setAdaptiveStep(1.0e-10, 1.0e-10);
+  EXPECT_EQ(libra::OdeMethod::kDormandPrince54, ode.method());
+
+  // Integrate with the interval of the calls smaller than the controlled step width
+  for (int i = 1; i <= 1000; i++) {
+    const double x_end = i * 0.01;
+    ode.Integrate(x_end);
+    EXPECT_DOUBLE_EQ(x_end, ode.x());
+  }
+  EXPECT_NEAR(std::cos(10.0), ode[0], 1.0e-8);
+  EXPECT_NEAR(-std::sin(10.0), ode[1], 1.0e-8);
+}
+
+TEST(ODE, DormandPrinceDenseOutput) {
+  HarmonicOscillator ode(0.5);
+  ode.setAdaptiveStep(1.0e-10, 1.0e-10);
+  ode.Integrate(3.0);
+  // One step with the controlled step width
+  const double step_width = ode.adaptive_step_width();
+  ode.Integrate(3.0 + step_width);
+  EXPECT_DOUBLE_EQ(3.0 + step_width, ode.x());
+
+  for (int i = 0; i <= 10; i++) {
+    const double x = 3.0 + 0.1 * i * step_width;
+    libra::Vector<2> state = ode.DenseOutput(x);
+    EXPECT_NEAR(std::cos(x), state[0], 1.0e-8);
+    EXPECT_NEAR(-std::sin(x), state[1], 1.0e-8);
+  }
+}
+
+TEST(ODE, DormandPrinceFewerEvaluations) {
+  // Fixed step RK4 with the step width to achieve a similar accuracy
+  HarmonicOscillator rk4(0.01);
+  rk4.Integrate(100.0);
+  const double rk4_error = std::fabs(rk4[0] - std::cos(100.0));
+
+  HarmonicOscillator dp(0.01);
+  dp.setAdaptiveStep(1.0e-10, 1.0e-10);
+  dp.Integrate(100.0);
+  const double dp_error = std::fabs(dp[0] - std::cos(100.0));
+
+  EXPECT_GT(rk4_error, dp_error);
+  EXPECT_GT(rk4.rhs_count(), 2 * dp.rhs_count());
+}
+
+TEST(ODE, CheckpointRestartIsIdentical) {
+  HarmonicOscillator reference(0.1);
+  reference.setAdaptiveStep(1.0e-10, 1.0e-10);
+  reference.Integrate(5.0);
+
+  std::stringstream checkpoint;
+  CheckpointWriter writer(checkpoint);
+  reference.SaveState(writer);
+  reference.Integrate(10.0);
+
+  // Restart from the checkpoint with the same configuration
+  HarmonicOscillator restarted(0.1);
+  restarted.setAdaptiveStep(1.0e-10, 1.0e-10);
+  CheckpointReader reader(checkpoint);
+  restarted.LoadState(reader);
+  ASSERT_TRUE(reader.IsValid()) << reader.GetErrorMessage();
+  EXPECT_EQ(5.0, restarted.x());
+  restarted.Integrate(10.0);
+  EXPECT_EQ(reference[0], restarted[0]);
+  EXPECT_EQ(reference[1], restarted[1]);
+  EXPECT_EQ(reference.adaptive_step_width(), restarted.adaptive_step_width());
+
+  // A truncated checkpoint is detected
+  std::stringstream truncated(checkpoint.str().substr(0, 16));
+  CheckpointReader truncated_reader(truncated);
+  HarmonicOscillator broken(0.1);
+  broken.LoadState(truncated_reader);
+  EXPECT_FALSE(truncated_reader.IsValid());
+}
@@ -0,0 +1,74 @@
+/**
+ * @file TestRandomStream.cpp
+ * @brief Test codes for RandomStream and RandomContext class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "RandomContext.hpp"
+#include "RandomStream.hpp"
+
+// Known answers of Philox4x32-10 in the Random123 library
+TEST(RandomStream, Philox4x32KnownAnswer) {
+  const uint32_t counter_zero[4] = {0, 0, 0, 0};
+  const uint32_t key_zero[2] = {0, 0};
+  uint32_t output[4];
+  libra::RandomStream::Philox4x32(counter_zero, key_zero, output);
+  EXPECT_EQ(0x6627e8d5u, output[0]);
+  EXPECT_EQ(0xe169c58du, output[1]);
+  EXPECT_EQ(0xbc57ac4cu, output[2]);
+  EXPECT_EQ(0x9b00dbd8u, output[3]);
+
+  const uint32_t counter_pi[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+  const uint32_t key_pi[2] = {0xa4093822, 0x299f31d0};
+  libra::RandomStream::Philox4x32(counter_pi, key_pi, output);
+  EXPECT_EQ(0xd16cfe09u, output[0]);
+  EXPECT_EQ(0x94fdccebu, output[1]);
+  EXPECT_EQ(0x5001e420u, output[2]);
+  EXPECT_EQ(0x24126ea1u, output[3]);
+}
+
+TEST(RandomStream, UniformRange) {
+  libra::RandomStream stream(1, 2, 3, 4);
+  for (int i = 0; i < 1000; i++) {
+    double value = stream.GenerateUniform();
+    EXPECT_LE(0.0, value);
+    EXPECT_GT(1.0, value);
+  }
+}
+
+TEST(RandomContext, IndependentOfOtherContexts) {
+  libra::RandomContext case_a(12345, 7);
+  libra::RandomContext case_b(12345, 7);
+  libra::RandomContext sat_a = case_a.CreateSatelliteContext(1);
+
+  // Substreams taken from other contexts do not affect the result
+  libra::RandomContext other = case_b.CreateSatelliteContext(0);
+  other.MakeSeed("Gyro0/nr");
+  libra::RandomContext sat_b = case_b.CreateSatelliteContext(1);
+
+  for (int i = 0; i < 10; i++) EXPECT_EQ(sat_a.MakeSeed("Gyro0/nr"), sat_b.MakeSeed("Gyro0/nr"));
+}
+
+TEST(RandomContext, IndependentOfOtherStreams) {
+  libra::RandomContext sat_a = libra::RandomContext(12345, 7).CreateSatelliteContext(1);
+  libra::RandomContext sat_b = libra::RandomContext(12345, 7).CreateSatelliteContext(1);
+
+  // A stream added before does not change the other streams
+  sat_b.MakeSeed("STT0/ortho");
+  EXPECT_EQ(sat_a.MakeSeed("Gyro0/nr"), sat_b.MakeSeed("Gyro0/nr"));
+  // The streams of the different names and the repeated name are different
+  EXPECT_NE(sat_a.MakeSeed("Gyro1/nr"), sat_a.MakeSeed("Gyro0/nr"));
+  EXPECT_NE(sat_b.MakeSeed("Gyro0/nr"), sat_b.MakeSeed("Gyro0/nr"));
+}
+
+TEST(RandomContext, Scope) {
+  libra::RandomContext& default_context = libra::RandomContext::GetCurrent();
+  libra::RandomContext context(1, 0);
+  {
+    libra::RandomContext::Scope scope(context);
+    EXPECT_EQ(&context, &libra::RandomContext::GetCurrent());
+  }
+  // The default context is used outside the scope
+  EXPECT_EQ(&default_context, &libra::RandomContext::GetCurrent());
+  EXPECT_EQ((uint64_t)libra::RandomContext::kDefaultSeed, libra::RandomContext::GetCurrent().GetSeed());
+}
@@ -0,0 +1,169 @@
+/**
+ * @file BenchSpaceWeatherTable.cpp
+ * @brief Micro-benchmark of the space weather lookup for NRLMSISE-00 (linear search and day number index)
+ * @note The legacy implementation (date conversion and linear search in each call) is kept here as a reference for the latency comparison.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Wrapper_nrlmsise00.h"
+
+namespace {
+
+using std::vector;
+
+int LegacyLeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
+
+/**
+ * @fn LegacyConvertDecyearToDate
+ * @brief Date conversion used before the day number index (only the year, month, and day are calculated)
+ */
+void LegacyConvertDecyearToDate(double decyear, int* date) {
+  int year = (int)(decyear);
+  int is_leap_year = LegacyLeapYear(year);
+  int days_per_year = is_leap_year ? 366 : 365;
+  int days = (int)((decyear - year) * days_per_year);
+  if (days == 0) {
+    days = 1;
+  }
+
+  int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (is_leap_year) {
+    days_month[1] = 29;
+  }
+  date[0] = year;
+  for (int month = 1; month <= 12; month++) {
+    // The accumulation in each comparison is the same as the legacy implementation
+    if (days > std::accumulate(days_month, days_month + month - 1, 0) && days <= std::accumulate(days_month, days_month + month, 0)) {
+      date[1] = month;
+      date[2] = days - std::accumulate(days_month, days_month + month - 1, 0);
+      break;
+    }
+  }
+}
+
+/**
+ * @fn LegacyFindIndex
+ * @brief Table lookup used before the day number index
+ */
+int LegacyFindIndex(double decyear, const SpaceWeatherTable& table) {
+  int date[3];
+  LegacyConvertDecyearToDate(decyear, date);
+  for (size_t i = 0; i < table.GetSize(); i++) {
+    const nrlmsise_table& entry = table.GetEntry(i);
+    if ((date[0] == entry.year) && (date[1] == entry.month) && (date[2] == entry.day)) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @fn WriteSyntheticTable
+ * @brief Write a daily space weather table in the CelesTrak format so that the benchmark does not depend on the external file
+ */
+void WriteSyntheticTable(const std::string& file_name, const int start_year, const int num_years) {
+  const int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  std::mt19937 mt(12345);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::ofstream ofs(file_name);
+  // Update date after the end of the table so that all entries are treated as daily entries
+  ofs << "UPDATED " << start_year + num_years << " Jun 01\n";
+  for (int year = start_year; year < start_year + num_years; year++) {
+    for (int month = 1; month <= 12; month++) {
+      const int num_days = days_month[month - 1] + ((month == 2 && LegacyLeapYear(year)) ? 1 : 0);
+      for (int day = 1; day <= num_days; day++) {
+        std::string line(130, ' ');
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%04d %02d %02d", year, month, day);
+        line.replace(0, 10, buf);
+        snprintf(buf, sizeof(buf), "%3d", (int)(3 + 40 * dist(mt)));
+        line.replace(80, 3, buf);
+        snprintf(buf, sizeof(buf), "%5.1f", 70.0 + 150.0 * dist(mt));
+        line.replace(93, 5, buf);
+        snprintf(buf, sizeof(buf), "%5.1f", 70.0 + 150.0 * dist(mt));
+        line.replace(101, 5, buf);
+        ofs << line << "\n";
+      }
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  const std::string file_name = "bench_space_weather.txt";
+  const int start_year = 1990;
+  const int num_years = 60;
+  WriteSyntheticTable(file_name, start_year, num_years);
+
+  SpaceWeatherTable table;
+  const double endsec = num_years * 365.0 * 86400.0;
+  table.Read(start_year + 0.1, endsec, file_name);
+  std::remove(file_name.c_str());
+  printf("table size: %zu\n", table.GetSize());
+
+  // Sequential times as a simulation with 10 sec step over 30 days, and random times over the table
+  const int num_times = 259200;
+  vector<double> sequential(num_times), random(num_times);
+  std::mt19937 mt(1);
+  std::uniform_real_distribution<double> dist(start_year + 0.2, start_year + num_years - 1.0);
+  for (int i = 0; i < num_times; i++) {
+    sequential[i] = start_year + 30.5 + i * 10.0 / 86400.0 / 365.25;
+    random[i] = dist(mt);
+  }
+
+  printf("times, legacy [us/call], index [us/call], index with cursor [us/call], speedup (index), speedup (cursor), mismatches\n");
+  const vector<double>* cases[2] = {&sequential, &random};
+  const char* names[2] = {"sequential", "random"};
+  for (int c = 0; c < 2; c++) {
+    const vector<double>& times = *cases[c];
+    // The legacy search is slow, so it is measured on a subset
+    const int num_legacy = num_times / 20;
+
+    int mismatches = 0;
+    double sink = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_legacy; i++) sink += table.GetEntry(LegacyFindIndex(times[i], table)).F107_adj;
+    auto end = std::chrono::steady_clock::now();
+    double legacy_us = std::chrono::duration<double, std::micro>(end - start).count() / num_legacy;
+
+    double f107, f107a, ap;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_times; i++) {
+      SpaceWeatherTable::Cursor cursor;
+      table.GetParameters(times[i], cursor, f107, f107a, ap);
+      sink += f107;
+    }
+    end = std::chrono::steady_clock::now();
+    double index_us = std::chrono::duration<double, std::micro>(end - start).count() / num_times;
+
+    SpaceWeatherTable::Cursor cursor;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_times; i++) {
+      table.GetParameters(times[i], cursor, f107, f107a, ap);
+      sink += f107;
+    }
+    end = std::chrono::steady_clock::now();
+    double cursor_us = std::chrono::duration<double, std::micro>(end - start).count() / num_times;
+
+    for (int i = 0; i < num_legacy; i++) {
+      SpaceWeatherTable::Cursor check_cursor;
+      table.GetParameters(times[i], check_cursor, f107, f107a, ap);
+      const nrlmsise_table& entry = table.GetEntry(LegacyFindIndex(times[i], table));
+      if (f107 != entry.F107_adj || f107a != entry.Ctr81_adj || ap != entry.Ap_avg) mismatches++;
+    }
+
+    printf("%s, %.4f, %.4f, %.4f, %.1f, %.1f, %d\n", names[c], legacy_us, index_us, cursor_us, legacy_us / index_us, legacy_us / cursor_us,
+           mismatches);
+    if (sink == 0.123) printf("\n");  // prevent the loops from being optimized out
+  }
+
+  return 0;
+}
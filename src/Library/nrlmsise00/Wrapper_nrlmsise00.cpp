@@ -17,6 +17,7 @@ extern "C" {
 #include <algorithm>
 #include <cctype>
 #include <cmath> /* maths functions */
+#include <mutex>
 #include <numeric>
 
 #include "Wrapper_nrlmsise00.h" /* header for nrlmsise-00.h */
@@ -27,7 +28,7 @@ using namespace std;
 /* ------------------------------ DEFINES ---------------------------- */
 /* ------------------------------------------------------------------- */
 
-static double decyear_monthly;
+static std::mutex gtd7_mutex;  // gtd7 uses global variables of the external library
 
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
@@ -38,84 +39,93 @@ void ConvertDaysToMonthDay(int days, int is_leap_year, int* month_day) {
     days_month[1] = 29;
   }
 
-  if (days <= days_month[0]) {
-    month_day[0] = 1;
-    month_day[1] = days;
-  } else if (days > days_month[0] && days <= accumulate(days_month, days_month + 2, 0)) {
-    month_day[0] = 2;
-    month_day[1] = days - days_month[0];
-  } else if (days > accumulate(days_month, days_month + 2, 0) && days <= accumulate(days_month, days_month + 3, 0)) {
-    month_day[0] = 3;
-    month_day[1] = days - accumulate(days_month, days_month + 2, 0);
-  } else if (days > accumulate(days_month, days_month + 3, 0) && days <= accumulate(days_month, days_month + 4, 0)) {
-    month_day[0] = 4;
-    month_day[1] = days - accumulate(days_month, days_month + 3, 0);
-  } else if (days > accumulate(days_month, days_month + 4, 0) && days <= accumulate(days_month, days_month + 5, 0)) {
-    month_day[0] = 5;
-    month_day[1] = days - accumulate(days_month, days_month + 4, 0);
-  } else if (days > accumulate(days_month, days_month + 5, 0) && days <= accumulate(days_month, days_month + 6, 0)) {
-    month_day[0] = 6;
-    month_day[1] = days - accumulate(days_month, days_month + 5, 0);
-  } else if (days > accumulate(days_month, days_month + 6, 0) && days <= accumulate(days_month, days_month + 7, 0)) {
-    month_day[0] = 7;
-    month_day[1] = days - accumulate(days_month, days_month + 6, 0);
-  } else if (days > accumulate(days_month, days_month + 7, 0) && days <= accumulate(days_month, days_month + 8, 0)) {
-    month_day[0] = 8;
-    month_day[1] = days - accumulate(days_month, days_month + 7, 0);
-  } else if (days > accumulate(days_month, days_month + 8, 0) && days <= accumulate(days_month, days_month + 9, 0)) {
-    month_day[0] = 9;
-    month_day[1] = days - accumulate(days_month, days_month + 8, 0);
-  } else if (days > accumulate(days_month, days_month + 9, 0) && days <= accumulate(days_month, days_month + 10, 0)) {
-    month_day[0] = 10;
-    month_day[1] = days - accumulate(days_month, days_month + 9, 0);
-  } else if (days > accumulate(days_month, days_month + 10, 0) && days <= accumulate(days_month, days_month + 11, 0)) {
-    month_day[0] = 11;
-    month_day[1] = days - accumulate(days_month, days_month + 10, 0);
-  } else if (days > accumulate(days_month, days_month + 11, 0) && days <= accumulate(days_month, days_month + 12, 0)) {
-    month_day[0] = 12;
-    month_day[1] = days - accumulate(days_month, days_month + 11, 0);
+  int days_before_month = 0;
+  for (int month = 0; month < 12; month++) {
+    if (days > days_before_month && days <= days_before_month + days_month[month]) {
+      month_day[0] = month + 1;
+      month_day[1] = days - days_before_month;
+      return;
+    }
+    days_before_month += days_month[month];
   }
 }
 
-void ConvertDecyearToDate(double decyear, int* date) {
-  // year
-  int year = (int)(decyear);
-  int is_leap_year = LeapYear(year);
-  int days_per_year = is_leap_year ? 366 : 365;
-  double reminder = decyear - year;
+/**
+ * @fn SplitDecyear
+ * @brief Split the decimal year into the year, the day of year, and the fraction of the day
+ * @note The day of year is rounded in the same way as the table lookup has been done (the first two days are both treated as the first day)
+ */
+static void SplitDecyear(double decyear, int* year, int* days, double* fraction_of_day) {
+  *year = (int)(decyear);
+  int days_per_year = LeapYear(*year) ? 366 : 365;
+  double reminder = decyear - *year;
 
-  // month day
   double days_d = reminder * days_per_year;
-  int days = (int)days_d;
-  if (days == 0) {
-    days = 1;
+  *days = (int)days_d;
+  if (*days == 0) {
+    *days = 1;
   }
-  reminder = days_d - (int)days_d;
+  *fraction_of_day = days_d - (int)days_d;
+}
+
+/**
+ * @fn CalcExactDayOfYear
+ * @brief Return the day of year of the decimal year without the rounding of SplitDecyear (1 for the first day)
+ * @param [in] decyear: Decimal year
+ * @param [in] year: Year of the decimal year
+ */
+static int CalcExactDayOfYear(double decyear, int year) {
+  const int days_per_year = LeapYear(year) ? 366 : 365;
+  return (int)((decyear - year) * days_per_year) + 1;
+}
+
+/**
+ * @fn CalcTimeOfDay
+ * @brief Convert the fraction of the day to hours, minutes, and seconds
+ */
+static void CalcTimeOfDay(double fraction_of_day, int* hms) {
+  double reminder = fraction_of_day;
 
   // hours
   double hours_d = reminder * 24;
-  int hours = (int)hours_d;
+  hms[0] = (int)hours_d;
   reminder = hours_d - (int)hours_d;
 
   // minutes
   double minutes_d = reminder * 60;
-  int minutes = (int)minutes_d;
+  hms[1] = (int)minutes_d;
   reminder = minutes_d - (int)minutes_d;
 
   // second
   double seconds_d = reminder * 60;
-  int seconds = (int)seconds_d;
-  reminder = seconds_d - (int)seconds_d;
+  hms[2] = (int)seconds_d;
+}
 
-  int month_day[2];
-  ConvertDaysToMonthDay(days, is_leap_year, month_day);
+void ConvertDecyearToDate(double decyear, int* date) {
+  int year, days;
+  double fraction_of_day;
+  SplitDecyear(decyear, &year, &days, &fraction_of_day);
+
+  int month_day[2] = {1, 1};
+  ConvertDaysToMonthDay(days, LeapYear(year), month_day);
 
   date[0] = year;
   date[1] = month_day[0];
   date[2] = month_day[1];
-  date[3] = hours;
-  date[4] = minutes;
-  date[5] = seconds;
+  CalcTimeOfDay(fraction_of_day, date + 3);
+}
+
+/**
+ * @fn CalcDayNumber
+ * @brief Return the number of days from 1970-01-01 in the proleptic Gregorian calendar
+ */
+static int CalcDayNumber(int year, int month, int day) {
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int year_of_era = year - era * 400;
+  const int day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
 }
 
 double ConvertDateToDecyear(int year, int month, int day) {
@@ -165,78 +175,55 @@ int ConvertMonthStrToMonthNum(string month_str) {
 /* ------------------------------------------------------------------- */
 /* --------------------------CalcNRLMSISE00--------------------------- */
 /* ------------------------------------------------------------------- */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap) {
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, double f107, double f107a, double ap) {
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
   struct ap_array aph;
 
   size_t i;
-  int date[6];
-  int idx = 0;
+  int year, days;
+  double fraction_of_day;
+  int hms[3];
 
   /* input values */
   for (i = 0; i < 24; i++) {
     flags.switches[i] = 1;
   }
 
-  ConvertDecyearToDate(decyear, date);
+  SplitDecyear(decyear, &year, &days, &fraction_of_day);
+  CalcTimeOfDay(fraction_of_day, hms);
 
   input.doy = (int)((decyear - (int)decyear) * 365.25);
   input.year = 0; /* without effect */
-  input.sec = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
+  input.sec = hms[0] * 60.0 * 60.0 + hms[1] * 60.0 + hms[2];
   input.alt = alt / 1000.0;
   input.g_lat = latrad * libra::rad_to_deg;
   input.g_long = lonrad * libra::rad_to_deg;
   input.lst = input.sec / 3600.0 + lonrad * libra::rad_to_deg / 15.0;
-
-  if (is_manual_param) {
-    input.f107 = manual_f107;
-    input.f107A = manual_f107a;
-    input.ap = manual_ap;
-  } else {
-    // f10.7 and ap from table
-    // If the table size is zero, return 0
-    if (table.size() == 0) {
-      return 0.0;
-    }
-
-    // search table index
-    for (i = 0; i < table.size(); i++) {
-      if (decyear < decyear_monthly) {
-        // Match year, month, date
-        if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) {
-          idx = i;
-          break;
-        }
-      } else {
-        // Match year, month
-        if ((date[0] == table[i].year) && (date[1] == table[i].month)) {
-          idx = i;
-          break;
-        }
-      }
-    }
-
-    input.f107A = table[idx].Ctr81_adj;
-    input.f107 = table[idx].F107_adj;
-    input.ap = table[idx].Ap_avg;
-  }
+  input.f107 = f107;
+  input.f107A = f107a;
+  input.ap = ap;
 
   for (i = 0; i < 7; i++) {
     aph.a[i] = input.ap;
   }
   input.ap_a = &aph;
 
-  gtd7(&input, &flags, &output);
+  {
+    std::lock_guard<std::mutex> lock(gtd7_mutex);
+    gtd7(&input, &flags, &output);
+  }
   return output.d[5];
 }
 
 /* ------------------------------------------------------------------- */
-/* -----------------------ReadSpaceWeatherTable----------------------- */
+/* -------------------------SpaceWeatherTable------------------------- */
 /* ------------------------------------------------------------------- */
-int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, vector<nrlmsise_table>& table) {
+SpaceWeatherTable::SpaceWeatherTable() : decyear_monthly_(0.0), is_interpolated_(false), first_day_number_(0), first_month_number_(0) {}
+
+int SpaceWeatherTable::Read(double decyear, double endsec, const string& filename) {
+  table_.clear();
   ifstream ifs(filename);
 
   if (!ifs.is_open()) {
@@ -256,6 +243,10 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
     cerr << "Year must be between 2015 and 2043 for NRLMSISE00 atmosphere model" << endl;
   }
 
+  // To get 1 month data, read the data before a month from the simulation starting date
+  const double decyear_ini_ymd = ConvertDateToDecyear(date_ini[0], date_ini[1], date_ini[2]) - 31.0 / 365.0;  // Subtract one month
+  const double decyear_end_ymd = ConvertDateToDecyear(date_end[0], date_end[1], date_end[2]);
+
   string line;
   while (getline(ifs, line)) {
     nrlmsise_table line_data;
@@ -273,7 +264,7 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
 
         // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
         int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-        decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
+        decyear_monthly_ = decyear_updated + (days_month[month_updated] + 14) / 365.0;
       }
       continue;
     }
@@ -282,9 +273,6 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
     int month = atoi(line.substr(5, 2).c_str());
     int day = atoi(line.substr(8, 2).c_str());
     double decyear_line = ConvertDateToDecyear(year, month, day);
-    // To get 1 month data, read the data before a month from the simulation starting date
-    double decyear_ini_ymd = ConvertDateToDecyear(date_ini[0], date_ini[1], date_ini[2]) - 31.0 / 365.0;  // Subtract one month
-    double decyear_end_ymd = ConvertDateToDecyear(date_end[0], date_end[1], date_end[2]);
 
     if (decyear_line < decyear_ini_ymd || decyear_line > decyear_end_ymd) continue;
 
@@ -300,8 +288,91 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
     line_data.Ctr81_obs = atof(line.substr(119, 5).c_str());
     line_data.Lst81_obs = atof(line.substr(125, 5).c_str());
 
-    table.push_back(line_data);
+    table_.push_back(line_data);
+  }
+
+  BuildIndex();
+  return table_.size();
+}
+
+void SpaceWeatherTable::BuildIndex() {
+  day_index_.clear();
+  month_index_.clear();
+  if (table_.empty()) return;
+
+  int last_day_number = CalcDayNumber(table_[0].year, table_[0].month, table_[0].day);
+  first_day_number_ = last_day_number;
+  first_month_number_ = table_[0].year * 12 + table_[0].month - 1;
+  int last_month_number = first_month_number_;
+  for (const auto& entry : table_) {
+    const int day_number = CalcDayNumber(entry.year, entry.month, entry.day);
+    const int month_number = entry.year * 12 + entry.month - 1;
+    first_day_number_ = min(first_day_number_, day_number);
+    last_day_number = max(last_day_number, day_number);
+    first_month_number_ = min(first_month_number_, month_number);
+    last_month_number = max(last_month_number, month_number);
+  }
+
+  // The first entry is used when the same day or month appears more than once
+  day_index_.assign(last_day_number - first_day_number_ + 1, -1);
+  month_index_.assign(last_month_number - first_month_number_ + 1, -1);
+  for (size_t i = 0; i < table_.size(); i++) {
+    int& day_index = day_index_[CalcDayNumber(table_[i].year, table_[i].month, table_[i].day) - first_day_number_];
+    if (day_index < 0) day_index = i;
+    int& month_index = month_index_[table_[i].year * 12 + table_[i].month - 1 - first_month_number_];
+    if (month_index < 0) month_index = i;
+  }
+}
+
+int SpaceWeatherTable::FindDay(const int day_number) const {
+  const int position = day_number - first_day_number_;
+  if (position < 0 || position >= (int)day_index_.size()) return -1;
+  return day_index_[position];
+}
+
+bool SpaceWeatherTable::GetParameters(double decyear, Cursor& cursor, double& f107, double& f107a, double& ap) const {
+  if (table_.empty()) return false;
+
+  int year, days;
+  double fraction_of_day;
+  SplitDecyear(decyear, &year, &days, &fraction_of_day);
+  const bool is_monthly = decyear >= decyear_monthly_;
+  // The interpolation is done from the true day since the fraction of the day is measured from it. The lookup without the interpolation keeps the
+  // legacy rounding of SplitDecyear.
+  if (is_interpolated_ && !is_monthly) days = CalcExactDayOfYear(decyear, year);
+
+  if (year != cursor.year || days != cursor.day_of_year || is_monthly != cursor.is_monthly) {
+    cursor.year = year;
+    cursor.day_of_year = days;
+    cursor.is_monthly = is_monthly;
+    cursor.next_index = -1;
+
+    int index;
+    if (!is_monthly) {
+      // Match year, month, date
+      const int day_number = CalcDayNumber(year, 1, 1) + days - 1;
+      index = FindDay(day_number);
+      if (index >= 0) cursor.next_index = FindDay(day_number + 1);
+    } else {
+      // Match year, month
+      int month_day[2] = {1, 1};
+      ConvertDaysToMonthDay(days, LeapYear(year), month_day);
+      const int position = year * 12 + month_day[0] - 1 - first_month_number_;
+      index = (position < 0 || position >= (int)month_index_.size()) ? -1 : month_index_[position];
+    }
+    cursor.index = index < 0 ? 0 : index;  // The first entry is used when the time is out of the table
+  }
+
+  const nrlmsise_table& entry = table_[cursor.index];
+  f107a = entry.Ctr81_adj;
+  f107 = entry.F107_adj;
+  ap = entry.Ap_avg;
+  if (is_interpolated_ && cursor.next_index >= 0) {
+    const nrlmsise_table& next = table_[cursor.next_index];
+    f107a += fraction_of_day * (next.Ctr81_adj - entry.Ctr81_adj);
+    f107 += fraction_of_day * (next.F107_adj - entry.F107_adj);
+    ap += fraction_of_day * (next.Ap_avg - entry.Ap_avg);
   }
 
-  return table.size();
+  return true;
 }
@@ -31,33 +31,107 @@ struct nrlmsise_table {
   double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
 };
 
+/**
+ * @class SpaceWeatherTable
+ * @brief Space weather table indexed by the day number
+ * @details The entry of a day (or of a month after the monthly prediction starts) is found without searching the table.
+ */
+class SpaceWeatherTable {
+ public:
+  /**
+   * @struct Cursor
+   * @brief Cache of the last looked up day
+   * @note Each user keeps its own cursor so that the consecutive steps in the same day skip the lookup.
+   */
+  struct Cursor {
+    int year = 0;             //!< Year of the cached day
+    int day_of_year = -1;     //!< Day of year of the cached day
+    bool is_monthly = false;  //!< Flag of the monthly entry is used
+    int index = 0;            //!< Table index of the cached day
+    int next_index = -1;      //!< Table index of the next day (-1 when it is not available)
+  };
+
+  /**
+   * @fn SpaceWeatherTable
+   * @brief Constructor
+   */
+  SpaceWeatherTable();
+
+  /**
+   * @fn Read
+   * @brief Read the space weather table file
+   * @param [in] decyear: Decimal year of the simulation start time
+   * @param [in] endsec: Simulation end time [sec]
+   * @param [in] filename: Path to the SpaceWeather file (Ex: ftp://ftp.agi.com/pub/DynamicEarthData/SpaceWeather-v1.2.txt)
+   * @return Size of table
+   */
+  int Read(double decyear, double endsec, const std::string& filename);
+  /**
+   * @fn GetParameters
+   * @brief Get F10.7 and Ap-index of the time
+   * @param [in] decyear: Decimal year
+   * @param [in,out] cursor: Cache of the last looked up day
+   * @param [out] f107: Daily F10.7
+   * @param [out] f107a: Centered 81-day averaged F10.7
+   * @param [out] ap: Daily averaged Ap-index
+   * @return False when the table is empty
+   */
+  bool GetParameters(double decyear, Cursor& cursor, double& f107, double& f107a, double& ap) const;
+
+  /**
+   * @fn SetInterpolation
+   * @brief Set the flag to interpolate the daily parameters linearly between the day and the next day
+   * @note The interpolation uses the true day of the time, while the lookup without the interpolation uses the legacy day (the previous day except
+   * on the first day of the year).
+   */
+  inline void SetInterpolation(const bool is_interpolated) { is_interpolated_ = is_interpolated; }
+  /**
+   * @fn GetSize
+   * @brief Return the number of the entries
+   */
+  inline size_t GetSize() const { return table_.size(); }
+  /**
+   * @fn GetEntry
+   * @brief Return an entry of the table
+   */
+  inline const nrlmsise_table& GetEntry(const size_t index) const { return table_[index]; }
+
+ private:
+  std::vector<nrlmsise_table> table_;  //!< Entries in the file order
+  double decyear_monthly_;             //!< Decimal year after which the table has monthly entries only
+  bool is_interpolated_;               //!< Flag to interpolate the daily parameters
+  int first_day_number_;               //!< Day number of the first element of day_index_
+  std::vector<int> day_index_;         //!< Table index of each day (-1 when the day is not in the table)
+  int first_month_number_;             //!< Month number of the first element of month_index_
+  std::vector<int> month_index_;       //!< Table index of the first entry of each month (-1 when the month is not in the table)
+
+  /**
+   * @fn BuildIndex
+   * @brief Build the day and month indices from the table
+   */
+  void BuildIndex();
+  /**
+   * @fn FindDay
+   * @brief Return the table index of the day
+   * @param [in] day_number: Day number
+   * @return Table index (-1 when the day is not in the table)
+   */
+  int FindDay(const int day_number) const;
+};
+
 /**
  * @fn CalcNRLMSISE00
- * @brief Read the space weather table file
- * @param [in] decyear: Decimal year of the simulation start time
+ * @brief Calculate the atmospheric density with NRLMSISE-00 model
+ * @param [in] decyear: Decimal year
  * @param [in] latrad: Latitude [rad]
  * @param [in] lonrad: Longitude [rad]
  * @param [in] alt: Altitude [m]
- * @param [in] table: Space Weather table
- * @param [in] is_manual_param: Flag to use manual parameters
- * @param [in] manual_f107: Manual setting F10.7
- * @param [in] manual_f107a: Manual setting averaged F10.7
- * @param [in] manual_ap: Manual setting Ap-index
+ * @param [in] f107: Daily F10.7
+ * @param [in] f107a: Averaged F10.7
+ * @param [in] ap: Ap-index
  * @return Atmospheric density [kg/m3]
  */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap);
-
-/**
- * @fn GetSpaceWeatherTable_
- * @brief Read the space weather table file
- * @param [in] decyear: Decimal year of the simulation start time
- * @param [in] endsec: Simulation end time [sec]
- * @param [in] filename: Path to the SpaceWeather file (Ex: ftp://ftp.agi.com/pub/DynamicEarthData/SpaceWeather-v1.2.txt)
- * @param [out] table: Space weather table
- * @return Size of table
- */
-int GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::vector<nrlmsise_table>& table);
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, double f107, double f107a, double ap);
 
 /* ------------------------------------------------------------------- */
 /* ----------------------- COMPILATION TWEAKS ------------------------ */
@@ -0,0 +1,241 @@
+/**
+ * @file Checkpoint.hpp
+ * @brief Classes to write and read the mutable states of the simulation into a checkpoint
+ * @details The values are stored in the native binary format without padding. Each object writes a section name before its values and the
+ * reader checks it, so that a checkpoint made with a different configuration is detected instead of being read silently.
+ */
+
+#ifndef CHECKPOINT_HPP_
+#define CHECKPOINT_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class CheckpointWriter
+ * @brief Class to write the states into a checkpoint stream
+ */
+class CheckpointWriter {
+ public:
+  /**
+   * @fn CheckpointWriter
+   * @brief Constructor
+   * @param [in] stream: Binary output stream
+   */
+  explicit CheckpointWriter(std::ostream& stream) : stream_(stream) {}
+
+  /**
+   * @fn WriteSection
+   * @brief Write the name of the section to check the order of the states in the reader
+   */
+  void WriteSection(const std::string& name) { Write(name); }
+
+  /**
+   * @fn Write
+   * @brief Write a trivially copyable value (e.g. double, libra::Vector, libra::NormalRand)
+   */
+  template <typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are written directly");
+    stream_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  /**
+   * @fn Write
+   * @brief Write the size and the elements of a vector
+   */
+  template <typename T>
+  void Write(const std::vector<T>& values) {
+    Write((uint64_t)values.size());
+    for (const T& value : values) Write(value);
+  }
+  /**
+   * @fn Write
+   * @brief Write the size and the elements of a deque
+   */
+  template <typename T>
+  void Write(const std::deque<T>& values) {
+    Write((uint64_t)values.size());
+    for (const T& value : values) Write(value);
+  }
+  /**
+   * @fn Write
+   * @brief Write the size and the characters of a string
+   */
+  void Write(const std::string& value) {
+    Write((uint64_t)value.size());
+    stream_.write(value.data(), value.size());
+  }
+
+  /**
+   * @fn IsValid
+   * @brief Return true when all values are written
+   */
+  inline bool IsValid() const { return static_cast<bool>(stream_); }
+
+ private:
+  std::ostream& stream_;  //!< Output stream
+};
+
+/**
+ * @class CheckpointReader
+ * @brief Class to read the states from a checkpoint stream
+ * @details The reader stops reading after the first error. The caller checks IsValid after reading all states.
+ */
+class CheckpointReader {
+ public:
+  /**
+   * @fn CheckpointReader
+   * @brief Constructor
+   * @param [in] stream: Binary input stream
+   */
+  explicit CheckpointReader(std::istream& stream) : stream_(stream) {}
+
+  /**
+   * @fn ReadSection
+   * @brief Read the name of the section and compare it with the expected name
+   * @return True when the name matches
+   */
+  bool ReadSection(const std::string& name) {
+    std::string read_name;
+    Read(read_name);
+    if (IsValid() && read_name != name) SetError("section " + name + " is expected but " + read_name + " is found");
+    return IsValid();
+  }
+
+  /**
+   * @fn Read
+   * @brief Read a trivially copyable value. The value is not changed after an error.
+   */
+  template <typename T>
+  void Read(T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are read directly");
+    if (!IsValid()) return;
+    char buffer[sizeof(T)];
+    stream_.read(buffer, sizeof(T));
+    if (!stream_) {
+      SetError("unexpected end of the checkpoint");
+      return;
+    }
+    std::memcpy(&value, buffer, sizeof(T));
+  }
+  /**
+   * @fn Read
+   * @brief Read a vector. The size of the vector is changed to the written size.
+   */
+  template <typename T>
+  void Read(std::vector<T>& values) {
+    uint64_t size = 0;
+    Read(size);
+    if (!IsValid()) return;
+    if (size > kMaxContainerSize) {
+      SetError("too large container in the checkpoint");
+      return;
+    }
+    values.resize((size_t)size);
+    for (T& value : values) Read(value);
+  }
+  /**
+   * @fn Read
+   * @brief Read a deque. The size of the deque is changed to the written size.
+   */
+  template <typename T>
+  void Read(std::deque<T>& values) {
+    uint64_t size = 0;
+    Read(size);
+    if (!IsValid()) return;
+    if (size > kMaxContainerSize) {
+      SetError("too large container in the checkpoint");
+      return;
+    }
+    values.resize((size_t)size);
+    for (T& value : values) Read(value);
+  }
+  /**
+   * @fn Read
+   * @brief Read a string
+   */
+  void Read(std::string& value) {
+    uint64_t size = 0;
+    Read(size);
+    if (!IsValid()) return;
+    if (size > kMaxContainerSize) {
+      SetError("too large string in the checkpoint");
+      return;
+    }
+    std::string read_value((size_t)size, '\0');
+    stream_.read(&read_value[0], (std::streamsize)size);
+    if (!stream_) {
+      SetError("unexpected end of the checkpoint");
+      return;
+    }
+    value = read_value;
+  }
+  /**
+   * @fn ReadSize
+   * @brief Read a size written with Write((uint64_t)size) and compare it with the expected size
+   * @return True when the size matches
+   */
+  bool ReadSize(const size_t expected_size, const std::string& name) {
+    uint64_t size = 0;
+    Read(size);
+    if (IsValid() && size != expected_size) SetError("size of " + name + " is different from the configuration");
+    return IsValid();
+  }
+
+  /**
+   * @fn SetError
+   * @brief Record an error. Only the first error is kept.
+   */
+  void SetError(const std::string& message) {
+    if (!IsValid()) return;
+    error_message_ = message;
+  }
+  /**
+   * @fn IsValid
+   * @brief Return true when no error occurred
+   */
+  inline bool IsValid() const { return error_message_.empty(); }
+  /**
+   * @fn GetErrorMessage
+   * @brief Return the message of the first error
+   */
+  inline const std::string& GetErrorMessage() const { return error_message_; }
+
+ private:
+  std::istream& stream_;       //!< Input stream
+  std::string error_message_;  //!< Message of the first error. Empty when no error occurred.
+
+  static const uint64_t kMaxContainerSize = 1ULL << 32;  //!< Upper limit of a container size to detect a broken checkpoint
+};
+
+/**
+ * @class ICheckpointable
+ * @brief Interface of the classes which have mutable states to be saved in a checkpoint
+ * @note The parameters read from the initialization files are not saved. The object is constructed with the same files before LoadState.
+ */
+class ICheckpointable {
+ public:
+  /**
+   * @fn ~ICheckpointable
+   * @brief Destructor
+   */
+  virtual ~ICheckpointable() {}
+  /**
+   * @fn SaveState
+   * @brief Write the mutable states
+   */
+  virtual void SaveState(CheckpointWriter& writer) const = 0;
+  /**
+   * @fn LoadState
+   * @brief Read the mutable states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader) = 0;
+};
+
+#endif  // CHECKPOINT_HPP_
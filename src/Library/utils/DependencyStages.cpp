@@ -0,0 +1,39 @@
+/**
+ * @file DependencyStages.cpp
+ * @brief Class to group tasks executed in order into stages whose tasks can run concurrently
+ */
+
+#include "DependencyStages.h"
+
+#include <algorithm>
+
+size_t DependencyStages::Add(const std::vector<const void*>& reads, const std::vector<const void*>& writes) {
+  size_t stage = barrier_stage_;
+  for (const void* object : reads) {
+    auto write = write_stages_.find(object);
+    if (write != write_stages_.end()) stage = std::max(stage, write->second);
+  }
+  for (const void* object : writes) {
+    auto write = write_stages_.find(object);
+    if (write != write_stages_.end()) stage = std::max(stage, write->second);
+    auto read = read_stages_.find(object);
+    if (read != read_stages_.end()) stage = std::max(stage, read->second);
+  }
+
+  for (const void* object : reads) {
+    size_t& read_stage = read_stages_[object];
+    read_stage = std::max(read_stage, stage + 1);
+  }
+  for (const void* object : writes) {
+    write_stages_[object] = stage + 1;
+  }
+  num_of_stages_ = std::max(num_of_stages_, stage + 1);
+  return stage;
+}
+
+size_t DependencyStages::AddBarrier() {
+  const size_t stage = num_of_stages_;
+  barrier_stage_ = stage + 1;
+  num_of_stages_ = stage + 1;
+  return stage;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file DependencyStages.h
+ * @brief Class to group tasks executed in order into stages whose tasks can run concurrently
+ */
+
+#ifndef __DEPENDENCY_STAGES_H__
+#define __DEPENDENCY_STAGES_H__
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class DependencyStages
+ * @brief Class to group tasks executed in order into stages whose tasks can run concurrently
+ * @details The tasks are added in the serial execution order with the objects they read and write. A task is assigned to the stage after all
+ * previous tasks writing the objects it reads, and after all previous tasks reading or writing the objects it writes. Executing the stages in
+ * order gives the same results as the serial execution.
+ */
+class DependencyStages {
+ public:
+  /**
+   * @fn Add
+   * @brief Add a task with the objects it reads and writes
+   * @param [in] reads: Objects read by the task
+   * @param [in] writes: Objects written by the task
+   * @return Stage of the task
+   */
+  size_t Add(const std::vector<const void*>& reads, const std::vector<const void*>& writes);
+  /**
+   * @fn AddBarrier
+   * @brief Add a task which may read and write any object. It runs after all previous tasks and before all following tasks.
+   * @return Stage of the task
+   */
+  size_t AddBarrier();
+
+  /**
+   * @fn GetNumOfStages
+   * @brief Return the number of stages of the added tasks
+   */
+  inline size_t GetNumOfStages() const { return num_of_stages_; }
+
+ private:
+  std::unordered_map<const void*, size_t> read_stages_;   //!< Next stage after the last task reading each object
+  std::unordered_map<const void*, size_t> write_stages_;  //!< Next stage after the last task writing each object
+  size_t barrier_stage_ = 0;                              //!< Next stage after the last barrier
+  size_t num_of_stages_ = 0;                              //!< Number of stages
+};
+
+#endif  //__DEPENDENCY_STAGES_H__
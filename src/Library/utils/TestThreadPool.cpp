@@ -0,0 +1,43 @@
+/**
+ * @file TestThreadPool.cpp
+ * @brief Test codes for ThreadPool class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "ThreadPool.h"
+
+/**
+ * @brief All tasks of a batch run once
+ */
+TEST(ThreadPool, RunAllTasks) {
+  ThreadPool thread_pool(4);
+  std::vector<int> counts(1000, 0);
+  for (int batch = 0; batch < 10; batch++) {
+    thread_pool.Run(counts.size(), [&counts](const size_t index) { counts[index]++; });
+  }
+  for (const int count : counts) EXPECT_EQ(10, count);
+}
+
+/**
+ * @brief An exception of a task is rethrown after the batch, and the pool runs the next batch
+ */
+TEST(ThreadPool, RethrowException) {
+  ThreadPool thread_pool(4);
+  std::atomic<int> num_of_running(0);
+  auto throwing_task = [&num_of_running](const size_t index) {
+    num_of_running++;
+    if (index == 10) throw std::runtime_error("task 10");
+    num_of_running--;
+  };
+  EXPECT_THROW(thread_pool.Run(1000, throwing_task), std::runtime_error);
+  // Only the throwing task is left counted after all threads leave the batch
+  EXPECT_EQ(1, num_of_running.load());
+
+  std::atomic<size_t> num_of_finished(0);
+  thread_pool.Run(1000, [&num_of_finished](const size_t) { num_of_finished++; });
+  EXPECT_EQ(1000u, num_of_finished.load());
+}
@@ -0,0 +1,84 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Class to run a batch of independent tasks on persistent worker threads
+ */
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(const size_t num_of_threads) : next_index_(0) {
+  for (size_t i = 1; i < num_of_threads; i++) workers_.push_back(std::thread(&ThreadPool::WorkerLoop, this));
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  started_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+void ThreadPool::Run(const size_t num_of_tasks, const Task& task) {
+  if (workers_.empty() || num_of_tasks <= 1) {
+    for (size_t i = 0; i < num_of_tasks; i++) task(i);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    num_of_tasks_ = num_of_tasks;
+    next_index_ = 0;
+    num_of_running_ = workers_.size();
+    batch_count_++;
+  }
+  started_.notify_all();
+
+  RunTasks();
+
+  // The task must be alive until all worker threads leave the batch
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    finished_.wait(lock, [this] { return num_of_running_ == 0; });
+    task_ = nullptr;
+    exception = exception_;
+    exception_ = nullptr;
+  }
+  if (exception) std::rethrow_exception(exception);
+}
+
+void ThreadPool::RunTasks() {
+  for (size_t index = next_index_++; index < num_of_tasks_; index = next_index_++) {
+    try {
+      (*task_)(index);
+    } catch (...) {
+      // Skip the tasks not started yet. The exception is rethrown in Run after the barrier.
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!exception_) exception_ = std::current_exception();
+      next_index_ = num_of_tasks_;
+    }
+  }
+}
+
+void ThreadPool::WorkerLoop() {
+  uint64_t done_batch_count = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      started_.wait(lock, [this, done_batch_count] { return is_stopped_ || batch_count_ != done_batch_count; });
+      if (is_stopped_) return;
+      done_batch_count = batch_count_;
+    }
+
+    RunTasks();
+
+    bool is_last = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      num_of_running_--;
+      is_last = num_of_running_ == 0;
+    }
+    if (is_last) finished_.notify_one();
+  }
+}
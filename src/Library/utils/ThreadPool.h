@@ -0,0 +1,86 @@
+/**
+ * @file ThreadPool.h
+ * @brief Class to run a batch of independent tasks on persistent worker threads
+ */
+
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Class to run a batch of independent tasks on persistent worker threads
+ * @details The worker threads are created once in the constructor and wait for the next batch. The calling thread also runs the tasks of the
+ * batch, so a pool of N threads has N - 1 worker threads. The tasks of a batch take their indexes in any order.
+ * When a task throws an exception, the tasks not started yet are skipped, and the first exception is rethrown by Run after all threads leave the
+ * batch.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Task called with the index of the task in the batch
+   */
+  typedef std::function<void(size_t index)> Task;
+
+  /**
+   * @fn ThreadPool
+   * @brief Constructor. The worker threads start here.
+   * @param [in] num_of_threads: Number of threads including the calling thread
+   */
+  explicit ThreadPool(const size_t num_of_threads);
+  /**
+   * @fn ~ThreadPool
+   * @brief Destructor. The worker threads stop here.
+   */
+  ~ThreadPool();
+
+  /**
+   * @fn Run
+   * @brief Run the task for the indexes 0 to num_of_tasks - 1 and wait until all of them are finished
+   * @note The first exception thrown by the tasks is rethrown here after all threads leave the batch.
+   * @param [in] num_of_tasks: Number of the tasks in the batch
+   * @param [in] task: Task called with each index
+   */
+  void Run(const size_t num_of_tasks, const Task& task);
+
+  /**
+   * @fn GetNumOfThreads
+   * @brief Return the number of threads including the calling thread
+   */
+  inline size_t GetNumOfThreads() const { return workers_.size() + 1; }
+
+ private:
+  std::vector<std::thread> workers_;  //!< Worker threads
+  const Task* task_ = nullptr;        //!< Task of the current batch
+  size_t num_of_tasks_ = 0;           //!< Number of the tasks in the current batch
+  std::atomic<size_t> next_index_;    //!< Index of the next task to run
+  size_t num_of_running_ = 0;         //!< Number of the worker threads running the current batch
+  uint64_t batch_count_ = 0;          //!< Number of the started batches to wake the worker threads
+  bool is_stopped_ = false;           //!< Flag to stop the worker threads
+  std::exception_ptr exception_;      //!< First exception thrown by the tasks of the current batch
+
+  std::mutex mutex_;                  //!< Mutex for the batch
+  std::condition_variable started_;   //!< Notified when a batch is started
+  std::condition_variable finished_;  //!< Notified when a worker thread finishes the batch
+
+  /**
+   * @fn RunTasks
+   * @brief Run the tasks of the current batch until no task is left
+   */
+  void RunTasks();
+  /**
+   * @fn WorkerLoop
+   * @brief Main loop of the worker threads
+   */
+  void WorkerLoop();
+};
+
+#endif  //__THREAD_POOL_H__
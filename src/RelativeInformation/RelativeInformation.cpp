@@ -5,32 +5,30 @@
 
 #include "RelativeInformation.h"
 
+#include <algorithm>
+
 RelativeInformation::RelativeInformation() {}
 
 RelativeInformation::~RelativeInformation() {}
 
 void RelativeInformation::Update() {
-  for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
-    for (size_t reference_sat_id = 0; reference_sat_id < dynamics_database_.size(); reference_sat_id++) {
-      // Position
-      libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_sat_id)->GetOrbit().GetSatPosition_i();
-      libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_sat_id)->GetOrbit().GetSatPosition_i();
-      rel_pos_list_i_m_[target_sat_id][reference_sat_id] = target_sat_pos_i - reference_sat_pos_i;
-      rel_pos_list_rtn_m_[target_sat_id][reference_sat_id] = CalcRelativePosition_rtn_m(target_sat_id, reference_sat_id);
-
-      // Distance
-      rel_distance_list_m_[target_sat_id][reference_sat_id] = norm(rel_pos_list_i_m_[target_sat_id][reference_sat_id]);
-
-      // Velocity
-      libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_sat_id)->GetOrbit().GetSatVelocity_i();
-      libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_sat_id)->GetOrbit().GetSatVelocity_i();
-      rel_vel_list_i_m_s_[target_sat_id][reference_sat_id] = target_sat_vel_i - reference_sat_vel_i;
-      rel_vel_list_rtn_m_s_[target_sat_id][reference_sat_id] = CalcRelativeVelocity_rtn_m_s(target_sat_id, reference_sat_id);
-
-      // Attitude Quaternion
-      rel_att_quaternion_list_[target_sat_id][reference_sat_id] = CalcRelativeAttitudeQuaternion(target_sat_id, reference_sat_id);
-    }
+  for (size_t sat_id = 0; sat_id < state_list_.size(); sat_id++) {
+    const Dynamics* dynamics = dynamics_database_.at(sat_id);
+    const Orbit& orbit = dynamics->GetOrbit();
+    SpacecraftState& state = state_list_[sat_id];
+    state.position_i_m = orbit.GetSatPosition_i();
+    state.velocity_i_m_s = orbit.GetSatVelocity_i();
+    state.q_i2b = dynamics->GetAttitude().GetQuaternion_i2b();
+
+    // RTN frame
+    state.q_i2rtn = orbit.CalcQuaternionI2LVLH();
+    state.rot_vec_rtn_i_rad_s = cross(state.position_i_m, state.velocity_i_m_s);
+    double r2_ref = norm(state.position_i_m) * norm(state.position_i_m);
+    state.rot_vec_rtn_i_rad_s /= r2_ref;
   }
+  // The relative information of the pairs is calculated when it is read
+  std::lock_guard<std::mutex> lock(pair_mutex_);
+  step_count_++;
 }
 
 void RelativeInformation::RegisterDynamicsInfo(const int sat_id, const Dynamics* dynamics) {
@@ -43,115 +41,159 @@ void RelativeInformation::RemoveDynamicsInfo(const int sat_id) {
   ResizeLists();
 }
 
-std::string RelativeInformation::GetLogHeader() const {
-  std::string str_tmp = "";
+void RelativeInformation::DeclareLogChannels(LogChannelList& channels) const {
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "i", "m", 3);
+      channels.AddVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "i", "m", 3);
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector("sat" + std::to_string(target_sat_id) + " velocity from sat" + std::to_string(reference_sat_id), "i", "m/s", 3);
+      channels.AddVector("sat" + std::to_string(target_sat_id) + " velocity from sat" + std::to_string(reference_sat_id), "i", "m/s", 3);
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "rtn", "m", 3);
+      channels.AddVector("sat" + std::to_string(target_sat_id) + " pos from sat" + std::to_string(reference_sat_id), "rtn", "m", 3);
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector("sat" + std::to_string(target_sat_id) + " velocity from sat" + std::to_string(reference_sat_id), "rtn", "m/s", 3);
+      channels.AddVector("sat" + std::to_string(target_sat_id) + " velocity from sat" + std::to_string(reference_sat_id), "rtn", "m/s", 3);
     }
   }
-
-  return str_tmp;
 }
 
-std::string RelativeInformation::GetLogValue() const {
-  std::string str_tmp = "";
+void RelativeInformation::WriteLogValues(LogValueSpan& values) const {
+  CalcAllPairs();
+
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector(GetRelativePosition_i_m(target_sat_id, reference_sat_id));
+      values.Write(GetRelativePosition_i_m(target_sat_id, reference_sat_id));
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_i_m_s(target_sat_id, reference_sat_id));
+      values.Write(GetRelativeVelocity_i_m_s(target_sat_id, reference_sat_id));
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector(GetRelativePosition_rtn_m(target_sat_id, reference_sat_id));
+      values.Write(GetRelativePosition_rtn_m(target_sat_id, reference_sat_id));
     }
   }
 
   for (size_t target_sat_id = 0; target_sat_id < dynamics_database_.size(); target_sat_id++) {
     for (size_t reference_sat_id = 0; reference_sat_id < target_sat_id; reference_sat_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_rtn_m_s(target_sat_id, reference_sat_id));
+      values.Write(GetRelativeVelocity_rtn_m_s(target_sat_id, reference_sat_id));
     }
   }
-
-  return str_tmp;
 }
 
 void RelativeInformation::LogSetup(Logger& logger) { logger.AddLoggable(this); }
 
-libra::Quaternion RelativeInformation::CalcRelativeAttitudeQuaternion(const int target_sat_id, const int reference_sat_id) {
-  // Observer SC Body frame(obs_sat) -> ECI frame(i)
-  Quaternion q_reference_i2b = dynamics_database_.at(reference_sat_id)->GetAttitude().GetQuaternion_i2b();
-  Quaternion q_reference_b2i = q_reference_i2b.conjugate();
+libra::Quaternion RelativeInformation::GetRelativeAttitudeQuaternion(const int target_sat_id, const int reference_sat_id) const {
+  if (target_sat_id == reference_sat_id) return libra::Quaternion(0, 0, 0, 1);
+  if (target_sat_id > reference_sat_id) return GetPairInformation(target_sat_id, reference_sat_id).rel_att_quaternion;
+  return GetPairInformation(reference_sat_id, target_sat_id).rel_att_quaternion.conjugate();
+}
 
-  // ECI frame(i) -> Target SC body frame(main_sat)
-  Quaternion q_target_i2b = dynamics_database_.at(target_sat_id)->GetAttitude().GetQuaternion_i2b();
+libra::Vector<3> RelativeInformation::GetRelativePosition_i_m(const int target_sat_id, const int reference_sat_id) const {
+  if (target_sat_id == reference_sat_id) return libra::Vector<3>(0.0);
+  if (target_sat_id > reference_sat_id) return GetPairInformation(target_sat_id, reference_sat_id).rel_pos_i_m;
+  return -GetPairInformation(reference_sat_id, target_sat_id).rel_pos_i_m;
+}
+
+libra::Vector<3> RelativeInformation::GetRelativeVelocity_i_m_s(const int target_sat_id, const int reference_sat_id) const {
+  if (target_sat_id == reference_sat_id) return libra::Vector<3>(0.0);
+  if (target_sat_id > reference_sat_id) return GetPairInformation(target_sat_id, reference_sat_id).rel_vel_i_m_s;
+  return -GetPairInformation(reference_sat_id, target_sat_id).rel_vel_i_m_s;
+}
 
-  return q_target_i2b * q_reference_b2i;
+double RelativeInformation::GetRelativeDistance_m(const int target_sat_id, const int reference_sat_id) const {
+  if (target_sat_id == reference_sat_id) return 0.0;
+  if (target_sat_id > reference_sat_id) return GetPairInformation(target_sat_id, reference_sat_id).rel_distance_m;
+  return GetPairInformation(reference_sat_id, target_sat_id).rel_distance_m;
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativePosition_rtn_m(const int target_sat_id, const int reference_sat_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_sat_id)->GetOrbit().GetSatPosition_i();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_sat_id)->GetOrbit().GetSatPosition_i();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+libra::Vector<3> RelativeInformation::GetRelativePosition_rtn_m(const int target_sat_id, const int reference_sat_id) const {
+  // The RTN frame depends on the reference spacecraft, so the transposed pair is not derived by the sign inversion
+  SpacecraftState reference_state = state_list_.at(reference_sat_id);
+  return reference_state.q_i2rtn.frame_conv(GetRelativePosition_i_m(target_sat_id, reference_sat_id));
+}
 
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_sat_id)->GetOrbit().CalcQuaternionI2LVLH();
+libra::Vector<3> RelativeInformation::GetRelativeVelocity_rtn_m_s(const int target_sat_id, const int reference_sat_id) const {
+  SpacecraftState reference_state = state_list_.at(reference_sat_id);
+  libra::Vector<3> relative_pos_i = GetRelativePosition_i_m(target_sat_id, reference_sat_id);
+  libra::Vector<3> relative_vel_i =
+      GetRelativeVelocity_i_m_s(target_sat_id, reference_sat_id) - cross(reference_state.rot_vec_rtn_i_rad_s, relative_pos_i);
+  return reference_state.q_i2rtn.frame_conv(relative_vel_i);
+}
 
-  libra::Vector<3> relative_pos_rtn = q_i2rtn.frame_conv(relative_pos_i);
-  return relative_pos_rtn;
+RelativeInformation::PairInformation RelativeInformation::GetPairInformation(const size_t target_sat_id, const size_t reference_sat_id) const {
+  std::lock_guard<std::mutex> lock(pair_mutex_);
+  PairInformation& pair = pair_list_.at(GetPairIndex(target_sat_id, reference_sat_id));
+  if (pair.calculated_step != step_count_) CalcPairInformation(target_sat_id, reference_sat_id, pair);
+  return pair;
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativeVelocity_rtn_m_s(const int target_sat_id, const int reference_sat_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_sat_id)->GetOrbit().GetSatPosition_i();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_sat_id)->GetOrbit().GetSatPosition_i();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+void RelativeInformation::CalcPairInformation(const size_t target_sat_id, const size_t reference_sat_id, PairInformation& pair) const {
+  const SpacecraftState& target_state = state_list_[target_sat_id];
+  const SpacecraftState& reference_state = state_list_[reference_sat_id];
 
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_sat_id)->GetOrbit().CalcQuaternionI2LVLH();
+  // Position and distance
+  pair.rel_pos_i_m = target_state.position_i_m - reference_state.position_i_m;
+  pair.rel_distance_m = norm(pair.rel_pos_i_m);
 
-  // Rotation vector of RTN frame
-  libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_sat_id)->GetOrbit().GetSatVelocity_i();
-  libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_sat_id)->GetOrbit().GetSatVelocity_i();
-  libra::Vector<3> rot_vec_rtn_i = cross(reference_sat_pos_i, reference_sat_vel_i);
-  double r2_ref = norm(reference_sat_pos_i) * norm(reference_sat_pos_i);
-  rot_vec_rtn_i /= r2_ref;
-  libra::Vector<3> relative_vel_i = target_sat_vel_i - reference_sat_vel_i - cross(rot_vec_rtn_i, relative_pos_i);
+  // Velocity
+  pair.rel_vel_i_m_s = target_state.velocity_i_m_s - reference_state.velocity_i_m_s;
+
+  // Attitude Quaternion
+  // Observer SC Body frame(obs_sat) -> ECI frame(i)
+  Quaternion q_reference_b2i = reference_state.q_i2b.conjugate();
+  // ECI frame(i) -> Target SC body frame(main_sat)
+  pair.rel_att_quaternion = target_state.q_i2b * q_reference_b2i;
 
-  libra::Vector<3> relative_vel_rtn = q_i2rtn.frame_conv(relative_vel_i);
-  return relative_vel_rtn;
+  pair.calculated_step = step_count_;
+}
+
+void RelativeInformation::CalcAllPairs() const {
+  std::lock_guard<std::mutex> lock(pair_mutex_);
+  const size_t num_pairs = pair_list_.size();
+  size_t num_tasks = 1;
+  if (thread_pool_ != nullptr) num_tasks = std::max<size_t>(std::min(thread_pool_->GetNumOfThreads(), num_pairs / kMinPairsPerTask), 1);
+
+  // Each range of the pairs is calculated in a task. The pairs are independent and only read the copied states.
+  auto calc_pairs = [this, num_pairs, num_tasks](const size_t task_id) {
+    const size_t begin = num_pairs * task_id / num_tasks;
+    const size_t end = num_pairs * (task_id + 1) / num_tasks;
+    // ID of the target spacecraft of the first pair in the range
+    size_t target_sat_id = 1;
+    while (GetPairIndex(target_sat_id + 1, 0) <= begin) target_sat_id++;
+    for (size_t index = begin; index < end; index++) {
+      if (index == GetPairIndex(target_sat_id + 1, 0)) target_sat_id++;
+      PairInformation& pair = pair_list_[index];
+      if (pair.calculated_step != step_count_) CalcPairInformation(target_sat_id, index - GetPairIndex(target_sat_id, 0), pair);
+    }
+  };
+
+  if (num_tasks == 1) {
+    calc_pairs(0);
+  } else {
+    thread_pool_->Run(num_tasks, calc_pairs);
+  }
 }
 
 void RelativeInformation::ResizeLists() {
   size_t size = dynamics_database_.size();
-  rel_pos_list_i_m_.assign(size, vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  rel_vel_list_i_m_s_.assign(size, vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  rel_distance_list_m_.assign(size, vector<double>(size, 0.0));
-  rel_pos_list_rtn_m_.assign(size, vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  rel_vel_list_rtn_m_s_.assign(size, vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  rel_att_quaternion_list_.assign(size, vector<libra::Quaternion>(size, libra::Quaternion(0, 0, 0, 1)));
+  state_list_.assign(size, SpacecraftState());
+  // The pairs are zero until the states are copied in Update
+  PairInformation initial_pair;
+  initial_pair.calculated_step = step_count_;
+  pair_list_.assign(size * (size - 1) / 2, initial_pair);
 }
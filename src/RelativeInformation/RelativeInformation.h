@@ -4,17 +4,25 @@
  */
 
 #pragma once
+#include <Library/utils/ThreadPool.h>
+
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "../Dynamics/Dynamics.h"
-#include "../Interface/LogOutput/ILoggable.h"
+#include "../Interface/LogOutput/ITypedLoggable.h"
 #include "../Interface/LogOutput/Logger.h"
 
 /**
  * @class RelativeInformation
  * @brief Base class to manage relative information between spacecraft
+ * @details The position, the velocity, the attitude, and the RTN frame of each spacecraft are copied in Update, so all relative information
+ * of a step is calculated from the states at the same time even when it is read while the spacecraft are updated. Only the pairs of the target
+ * ID larger than the reference ID (lower triangle) are stored, and the transposed pairs are derived from them. The relative information of a
+ * pair is calculated from the copied states when it is read for the first time after Update. The getters are thread-safe.
  */
-class RelativeInformation : public ILoggable {
+class RelativeInformation : public ITypedLoggable {
  public:
   /**
    * @fn RelativeInformation
@@ -29,9 +37,16 @@ class RelativeInformation : public ILoggable {
 
   /**
    * @fn Update
-   * @brief Update all relative information
+   * @brief Copy the states of all spacecraft and invalidate the relative information calculated in the previous step
+   * @note Call this after all spacecraft are updated. The relative information is calculated with the states copied here.
    */
   void Update();
+  /**
+   * @fn SetThreadPool
+   * @brief Set the thread pool to calculate all pairs for the log output
+   * @param [in] thread_pool: Thread pool shared with the simulation case. nullptr for the calculation in the calling thread.
+   */
+  inline void SetThreadPool(ThreadPool* thread_pool) { thread_pool_ = thread_pool; }
   /**
    * @fn RegisterDynamicsInfo
    * @brief Register dynamics information of target spacecraft
@@ -46,17 +61,17 @@ class RelativeInformation : public ILoggable {
    */
   void RemoveDynamicsInfo(const int sat_id);
 
-  // Override classes for ILoggable
+  // Override classes for ITypedLoggable
   /**
-   * @fn GetLogHeader
-   * @brief Override function of GetLogHeader
+   * @fn DeclareLogChannels
+   * @brief Override function of DeclareLogChannels
    */
-  virtual std::string GetLogHeader() const;
+  virtual void DeclareLogChannels(LogChannelList& channels) const;
   /**
-   * @fn GetLogValue
-   * @brief Override function of GetLogValue
+   * @fn WriteLogValues
+   * @brief Override function of WriteLogValues
    */
-  virtual std::string GetLogValue() const;
+  virtual void WriteLogValues(LogValueSpan& values) const;
 
   /**
    * @fn LogSetup
@@ -71,36 +86,28 @@ class RelativeInformation : public ILoggable {
    * @params [in] target_sat_id: ID of target spacecraft
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  inline libra::Quaternion GetRelativeAttitudeQuaternion(const int target_sat_id, const int reference_sat_id) const {
-    return rel_att_quaternion_list_[target_sat_id][reference_sat_id];
-  }
+  libra::Quaternion GetRelativeAttitudeQuaternion(const int target_sat_id, const int reference_sat_id) const;
   /**
    * @fn GetRelativePosition_i_m
    * @brief Return relative position of the target spacecraft with respect to the reference spacecraft in the inertial frame and unit [m]
    * @params [in] target_sat_id: ID of target spacecraft
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativePosition_i_m(const int target_sat_id, const int reference_sat_id) const {
-    return rel_pos_list_i_m_[target_sat_id][reference_sat_id];
-  }
+  libra::Vector<3> GetRelativePosition_i_m(const int target_sat_id, const int reference_sat_id) const;
   /**
    * @fn GetRelativeVelocity_i_m
    * @brief Return relative velocity of the target spacecraft with respect to the reference spacecraft in the inertial frame and unit [m]
    * @params [in] target_sat_id: ID of target spacecraft
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativeVelocity_i_m_s(const int target_sat_id, const int reference_sat_id) const {
-    return rel_vel_list_i_m_s_[target_sat_id][reference_sat_id];
-  }
+  libra::Vector<3> GetRelativeVelocity_i_m_s(const int target_sat_id, const int reference_sat_id) const;
   /**
    * @fn GetRelativeDistance_m
    * @brief Return relative distance between the target spacecraft and the reference spacecraft in unit [m]
    * @params [in] target_sat_id: ID of target spacecraft
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  inline double GetRelativeDistance_m(const int target_sat_id, const int reference_sat_id) const {
-    return rel_distance_list_m_[target_sat_id][reference_sat_id];
-  };
+  double GetRelativeDistance_m(const int target_sat_id, const int reference_sat_id) const;
   /**
    * @fn GetRelativePosition_rtn_m
    * @brief Return relative position of the target spacecraft with respect to the reference spacecraft in the RTN frame of the reference spacecraft
@@ -108,9 +115,7 @@ class RelativeInformation : public ILoggable {
    * @params [in] target_sat_id: ID of target spacecraft
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativePosition_rtn_m(const int target_sat_id, const int reference_sat_id) const {
-    return rel_pos_list_rtn_m_[target_sat_id][reference_sat_id];
-  }
+  libra::Vector<3> GetRelativePosition_rtn_m(const int target_sat_id, const int reference_sat_id) const;
   /**
    * @fn GetRelativeVelocity_rtn_m_s
    * @brief Return relative velocity of the target spacecraft with respect to the reference spacecraft in the RTN frame of the reference spacecraft
@@ -118,9 +123,7 @@ class RelativeInformation : public ILoggable {
    * @params [in] target_sat_id: ID of target spacecraft
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativeVelocity_rtn_m_s(const int target_sat_id, const int reference_sat_id) const {
-    return rel_vel_list_rtn_m_s_[target_sat_id][reference_sat_id];
-  }
+  libra::Vector<3> GetRelativeVelocity_rtn_m_s(const int target_sat_id, const int reference_sat_id) const;
 
   /**
    * @fn GetReferenceSatDynamics
@@ -131,36 +134,69 @@ class RelativeInformation : public ILoggable {
   inline const Dynamics* GetReferenceSatDynamics(const int reference_sat_id) const { return dynamics_database_.at(reference_sat_id); };
 
  private:
+  /**
+   * @struct PairInformation
+   * @brief Relative information of the target spacecraft with respect to the reference spacecraft of a stored pair
+   */
+  struct PairInformation {
+    size_t calculated_step = 0;                                            //!< Step count when the information is calculated
+    libra::Vector<3> rel_pos_i_m{0.0};                                     //!< Relative position in the inertial frame in unit [m]
+    libra::Vector<3> rel_vel_i_m_s{0.0};                                   //!< Relative velocity in the inertial frame in unit [m/s]
+    double rel_distance_m = 0.0;                                           //!< Relative distance in unit [m]
+    libra::Quaternion rel_att_quaternion = libra::Quaternion(0, 0, 0, 1);  //!< Relative attitude quaternion
+  };
+  /**
+   * @struct SpacecraftState
+   * @brief States of a spacecraft copied in Update
+   */
+  struct SpacecraftState {
+    libra::Vector<3> position_i_m{0.0};                         //!< Position in the inertial frame [m]
+    libra::Vector<3> velocity_i_m_s{0.0};                       //!< Velocity in the inertial frame [m/s]
+    libra::Quaternion q_i2b = libra::Quaternion(0, 0, 0, 1);    //!< Quaternion from the inertial frame to the body frame
+    libra::Quaternion q_i2rtn = libra::Quaternion(0, 0, 0, 1);  //!< Quaternion from the inertial frame to the RTN frame
+    libra::Vector<3> rot_vec_rtn_i_rad_s{0.0};                  //!< Rotation vector of the RTN frame in the inertial frame [rad/s]
+  };
+
+  static const size_t kMinPairsPerTask = 1024;  //!< Minimum number of the pairs calculated in a task by CalcAllPairs
+
   std::map<const int, const Dynamics*> dynamics_database_;  //!< Dynamics database of all spacecraft
+  ThreadPool* thread_pool_ = nullptr;                       //!< Thread pool to calculate all pairs. nullptr for the calling thread.
 
-  std::vector<std::vector<libra::Vector<3>>> rel_pos_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> rel_vel_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
-  std::vector<std::vector<libra::Vector<3>>> rel_pos_list_rtn_m_;        //!< Relative position list in the RTN frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> rel_vel_list_rtn_m_s_;      //!< Relative velocity list in the RTN frame in unit [m/s]
-  std::vector<std::vector<double>> rel_distance_list_m_;                 //!< Relative distance list in unit [m]
-  std::vector<std::vector<libra::Quaternion>> rel_att_quaternion_list_;  //!< Relative attitude quaternion list
+  size_t step_count_ = 1;                           //!< Count of Update calls to invalidate the information of the previous step
+  std::vector<SpacecraftState> state_list_;         //!< States of each spacecraft copied in Update
+  mutable std::vector<PairInformation> pair_list_;  //!< Information of the pairs of target_sat_id > reference_sat_id
+  mutable std::mutex pair_mutex_;                   //!< Mutex to calculate the pairs when they are read concurrently
 
   /**
-   * @fn CalcRelativeAttitudeQuaternion
-   * @brief Calculate and return the relative attitude quaternion
-   * @params [in] target_sat_id: ID of the spacecraft
+   * @fn GetPairIndex
+   * @brief Return the index of the pair in pair_list_
+   * @params [in] target_sat_id: ID of target spacecraft (larger than reference_sat_id)
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  libra::Quaternion CalcRelativeAttitudeQuaternion(const int target_sat_id, const int reference_sat_id);
+  inline size_t GetPairIndex(const size_t target_sat_id, const size_t reference_sat_id) const {
+    return target_sat_id * (target_sat_id - 1) / 2 + reference_sat_id;
+  }
   /**
-   * @fn CalcRelativePosition_rtn_m
-   * @brief Calculate and return the relative position in RTN frame
-   * @params [in] target_sat_id: ID of the spacecraft
+   * @fn GetPairInformation
+   * @brief Return the information of the stored pair calculated in the current step
+   * @params [in] target_sat_id: ID of target spacecraft (larger than reference_sat_id)
    * @params [in] reference_sat_id: ID of reference spacecraft
    */
-  libra::Vector<3> CalcRelativePosition_rtn_m(const int target_sat_id, const int reference_sat_id);
+  PairInformation GetPairInformation(const size_t target_sat_id, const size_t reference_sat_id) const;
   /**
-   * @fn CalcRelativeVelocity_rtn_m_s
-   * @brief Calculate and return the relative velocity in RTN frame
-   * @params [in] target_sat_id: ID of the spacecraft
+   * @fn CalcPairInformation
+   * @brief Calculate the information of the stored pair from the copied states
+   * @params [in] target_sat_id: ID of target spacecraft (larger than reference_sat_id)
    * @params [in] reference_sat_id: ID of reference spacecraft
+   * @params [out] pair: Relative information of the pair
+   */
+  void CalcPairInformation(const size_t target_sat_id, const size_t reference_sat_id, PairInformation& pair) const;
+  /**
+   * @fn CalcAllPairs
+   * @brief Calculate the information of all stored pairs which are not calculated in the current step
+   * @note The pairs are divided into the tasks of the thread pool when the number of the pairs is large.
    */
-  libra::Vector<3> CalcRelativeVelocity_rtn_m_s(const int target_sat_id, const int reference_sat_id);
+  void CalcAllPairs() const;
 
   /**
    * @fn ResizeLists
@@ -1,70 +1,133 @@
 /**
  * @file S2E_parallel.cpp
- * @brief The main file of S2E parallel execution
+ * @brief The main file of S2E Monte-Carlo simulation executed in parallel threads
  */
 
-#include <stdio.h>
-#include <string.h>
-#include <tchar.h>
-
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
-#include "src/Interface/HilsInOut/COSMOSWrapper.h"
-#include "src/Interface/HilsInOut/HardwareMessage.h"
-#include "src/Interface/InitInput/Initialize.h"
-#include "src/Interface/LogOutput/Logger.h"
-#include "src/Simulation/Case/EquuleusCase.h"
-#include "src/Simulation/Case/SimulationCase.h"
-#include "src/Simulation/MCSim/MCSimExecutor.h"
-
-using namespace System::Threading::Tasks;
-
-void mail_loop(int idx);
-
-string ini_fname = "data/ini/SimBase.ini";
-
-MCSimExecutor* mc_sim;
-
-int _tmain_parallel(int argc, _TCHAR* argv[]) {
-  mc_sim = InitMCSim("data/ini/SimBase.ini");
-  Logger mclog("mont.csv");
-
-  // Monte-Carlo Simulation
-  // while (mc_sim->WillExecuteNextCase())
-  //  concurrency::parallel_for(0, mc_sim->GetTotalNumOfExecutions(), //(auto
-  //  i=0; i<mc_sim->GetTotalNumOfExecutions(); i++)
-  Parallel::For(0, mc_sim->GetTotalNumOfExecutions(), gcnew System::Action<int>(mail_loop));
-  return 0;
-  //{
-  //  SimulationCase& simcase = EquuleusCase(*mc_sim, ini_fname);
-  //  mclog.AddLoggable(&simcase);
-  //  if (mc_sim->GetNumOfExecutionsDone() == 0)
-  //  {
-  //    mclog.WriteHeaders();
-  //  }
-  //  simcase.Initialize();
-
-  //  mclog.WriteValues();
-  //  simcase.Main();
-  //  mclog.WriteValues();
-  //  mclog.ClearLoggables();
-  //}
-}
+// Simulator includes
+#include "Interface/InitInput/IniAccess.h"
+#include "Interface/LogOutput/InitLog.hpp"
+#include "Interface/LogOutput/Logger.h"
+#include "Simulation/MCSim/InitMcSim.hpp"
+#include "Simulation/MCSim/SimulationObject.h"
+
+// Add custom include files
+#include "Simulation/Case/SampleCase.h"
+
+/**
+ * @class MCResult
+ * @brief Loggable to write the summary rows of the simulation cases into the Monte-Carlo log
+ */
+class MCResult : public ILoggable {
+ public:
+  /**
+   * @fn Set
+   * @brief Set the summary of a case
+   * @param [in] case_id: Index of the case
+   * @param [in] header: Header of the case
+   * @param [in] value: Value of the case
+   */
+  void Set(const size_t case_id, const std::string& header, const std::string& value) {
+    case_id_ = case_id;
+    header_ = header;
+    value_ = value;
+  }
+  virtual std::string GetLogHeader() const { return WriteScalar("case", "-") + header_; }
+  virtual std::string GetLogValue() const { return WriteScalar(case_id_) + value_; }
+
+ private:
+  size_t case_id_ = 0;  //!< Index of the case
+  std::string header_;  //!< Header of the case
+  std::string value_;   //!< Value of the case
+};
+
+int main(int argc, char *argv[]) {
+  using namespace std::chrono;
+
+  system_clock::time_point start, end;
+  start = system_clock::now();
+
+  std::string ini_file = "../../data/SampleSat/ini/SampleSimBase.ini";
+
+  // Parsing arguments:  S2E_PARALLEL [ini_file] [number of threads]
+  if (argc > 1) {
+    ini_file = std::string(argv[1]);
+  }
+  IniAccess ini(ini_file);
+  unsigned int num_threads = (unsigned int)ini.ReadInt("MC_EXECUTION", "NumOfThreads");
+  if (argc > 2) {
+    num_threads = (unsigned int)atoi(argv[2]);
+  }
+  if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+  if (num_threads == 0) num_threads = 1;
+
+  MCSimExecutor *mc_sim = InitMCSim(ini_file);
+  const size_t num_cases = mc_sim->IsEnabled() ? (size_t)mc_sim->GetTotalNumOfExecutions() : 1;
+
+  Logger *mc_logger = InitLogMC(ini_file, true);
+  const std::string log_path = mc_logger->GetLogPath();
+
+  std::cout << "Starting Monte-Carlo simulation..." << std::endl;
+  std::cout << "\tIni file: " << ini_file << std::endl;
+  std::cout << "\tNumber of cases: " << num_cases << ", Number of threads: " << num_threads << std::endl;
+
+  std::vector<std::string> headers(num_cases), values(num_cases);
+  std::atomic<size_t> next_case_id(0);
+  std::mutex setup_mutex;
+  auto worker = [&]() {
+    // Each thread takes the next case when it finishes a case
+    for (size_t case_id = next_case_id++; case_id < num_cases; case_id = next_case_id++) {
+      // The random values of a case depend only on the seeds and the case ID, so the results do not depend on the thread scheduling
+      MCSimExecutor *case_mc_sim = mc_sim->CreateCaseExecutor(case_id);
+      case_mc_sim->RandomizeAllParameters();
+      SampleCase *simcase;
+      {
+        // The initialization is serialized since the file loaders in the libraries are not written for concurrent use
+        std::lock_guard<std::mutex> lock(setup_mutex);
+        simcase = new SampleCase(ini_file, *case_mc_sim, log_path);
+        simcase->Initialize();
+        SimulationObject::SetAllParameters(*case_mc_sim);
+      }
+
+      case_mc_sim->AtTheBeginningOfEachCase();
+      simcase->Main();
+      headers[case_id] = simcase->GetLogHeader();
+      values[case_id] = simcase->GetLogValue();
+      case_mc_sim->AtTheEndOfEachCase();
+
+      delete simcase;
+      delete case_mc_sim;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < num_threads; i++) threads.push_back(std::thread(worker));
+  for (auto &thread : threads) thread.join();
+
+  // Merge the results in the case order
+  MCResult result;
+  mc_logger->AddLoggable(&result);
+  for (size_t case_id = 0; case_id < num_cases; case_id++) {
+    result.Set(case_id, headers[case_id], values[case_id]);
+    if (case_id == 0) mc_logger->WriteHeaders();
+    mc_logger->WriteValues();
+  }
+  delete mc_logger;
+
+  delete mc_sim;
+
+  end = system_clock::now();
+  double time = static_cast<double>(duration_cast<microseconds>(end - start).count() / 1000000.0);
+  std::cout << std::endl << "Simulation execution time: " << time << "sec" << std::endl << std::endl;
 
-void mail_loop(int idx) {
-  COSMOSWrapper& cosmos_wrapper = COSMOSWrapper();
-  HardwareMessage& hw_msg = HardwareMessage();
-
-  SimulationCase& simcase = EquuleusCase(*mc_sim, ini_fname, cosmos_wrapper, hw_msg);
-  // mclog.AddLoggable(&simcase);
-  // if (mc_sim->GetNumOfExecutionsDone() == 0)
-  //{
-  //   mclog.WriteHeaders();
-  // }
-  simcase.Initialize();
-
-  // mclog.WriteValues();
-  simcase.Main();
-  // mclog.WriteValues();
-  // mclog.ClearLoggables();
+  return EXIT_SUCCESS;
 }
@@ -0,0 +1,89 @@
+/**
+ * @file BenchMultiSpacecraft.cpp
+ * @brief Comparison of the wall time of the serial and the concurrent update of multiple spacecraft sharing the global environment
+ * @note Run it in a directory where the relative paths in the ini files are valid, or give the path to the base ini file as the argument.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "../Spacecraft/SampleSpacecraft/SampleSat.h"
+#include "MultiSpacecraftCase.h"
+
+namespace {
+
+/**
+ * @class BenchCase
+ * @brief Case with copies of the first sample spacecraft
+ */
+class BenchCase : public MultiSpacecraftCase {
+ public:
+  BenchCase(const std::string ini_base, const int num_spacecraft) : MultiSpacecraftCase(ini_base), num_spacecraft_(num_spacecraft) {}
+
+  void Initialize() {
+    sim_config_.sat_file_.assign(num_spacecraft_, sim_config_.sat_file_[0]);
+    for (int sat_id = 0; sat_id < num_spacecraft_; sat_id++) AddSpacecraft(new SampleSat(&sim_config_, glo_env_, &rel_info_, sat_id));
+    glo_env_->Reset();
+  }
+  void Main() {}
+  std::string GetLogHeader() const { return ""; }
+  std::string GetLogValue() const { return ""; }
+
+  /**
+   * @fn Step
+   * @brief Update the global environment and all spacecraft
+   */
+  void Step() {
+    glo_env_->Update();
+    UpdateAllSpacecraft();
+  }
+  /**
+   * @fn Checksum
+   * @brief Sum of the positions and the angular velocities of all spacecraft weighted by their IDs
+   */
+  double Checksum() const {
+    double checksum = 0.0;
+    for (size_t i = 0; i < spacecraft_.size(); i++) {
+      const Dynamics& dynamics = spacecraft_[i]->GetDynamics();
+      for (size_t j = 0; j < 3; j++) {
+        checksum += (double)(i + 1) * (dynamics.GetOrbit().GetSatPosition_i()[j] + dynamics.GetAttitude().GetOmega_b()[j]);
+      }
+    }
+    return checksum;
+  }
+
+ private:
+  int num_spacecraft_;  //!< Number of the spacecraft
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::string ini_base = (argc > 1) ? argv[1] : "../../data/SampleSat/ini/SampleSimBase.ini";
+  const int num_steps = 200;
+
+  printf("spacecraft, threads, time [ms/step], speedup, identical\n");
+  for (const int num_spacecraft : {4, 8}) {
+    double serial_ms = 0.0;
+    double serial_checksum = 0.0;
+    for (const size_t num_threads : {1, 2, 4}) {
+      BenchCase bench_case(ini_base, num_spacecraft);
+      bench_case.SetNumOfThreads(num_threads);
+      bench_case.Initialize();
+
+      auto start = std::chrono::steady_clock::now();
+      for (int step = 0; step < num_steps; step++) bench_case.Step();
+      auto end = std::chrono::steady_clock::now();
+      const double time_ms = std::chrono::duration<double, std::milli>(end - start).count() / num_steps;
+      const double checksum = bench_case.Checksum();
+      if (num_threads == 1) {
+        serial_ms = time_ms;
+        serial_checksum = checksum;
+      }
+
+      printf("%d, %zu, %.3f, %.2f, %s\n", num_spacecraft, num_threads, time_ms, serial_ms / time_ms, checksum == serial_checksum ? "yes" : "no");
+    }
+  }
+  return 0;
+}
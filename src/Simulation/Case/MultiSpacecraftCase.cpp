@@ -0,0 +1,106 @@
+/**
+ * @file MultiSpacecraftCase.cpp
+ * @brief Base class of simulation scenarios with multiple spacecraft updated concurrently
+ */
+
+#include "MultiSpacecraftCase.h"
+
+#include <Library/utils/DependencyStages.h>
+
+#include <algorithm>
+#include <iostream>
+
+MultiSpacecraftCase::MultiSpacecraftCase(std::string ini_base) : SimulationCase(ini_base) {
+  SetNumOfThreads((size_t)std::max(sim_config_.num_of_spacecraft_threads_, 1));
+}
+
+MultiSpacecraftCase::MultiSpacecraftCase(std::string ini_base, const MCSimExecutor& mc_sim, const std::string log_path)
+    : SimulationCase(ini_base, mc_sim, log_path) {
+  SetNumOfThreads((size_t)std::max(sim_config_.num_of_spacecraft_threads_, 1));
+}
+
+MultiSpacecraftCase::~MultiSpacecraftCase() {
+  // The spacecraft are removed from the relative information before it is destructed
+  for (auto itr = spacecraft_.begin(); itr != spacecraft_.end(); ++itr) delete *itr;
+}
+
+void MultiSpacecraftCase::Main() {
+  glo_env_->Reset();  // for MonteCarlo Sim
+  while (!glo_env_->GetSimTime().GetState().finish) {
+    // Logging
+    if (glo_env_->GetSimTime().GetState().log_output) {
+      sim_config_.main_logger_->WriteValues();
+    }
+    // Checkpoint
+    UpdateCheckpoint();
+
+    // Global Environment Update
+    glo_env_->Update();
+    // Spacecraft Update
+    UpdateAllSpacecraft();
+    // Interactions between the spacecraft
+    UpdateInteractions();
+
+    // Debug output
+    if (glo_env_->GetSimTime().GetState().disp_output) {
+      std::cout << "Progresss: " << glo_env_->GetSimTime().GetProgressionRate() << "%\r";
+    }
+  }
+}
+
+void MultiSpacecraftCase::SetNumOfThreads(const size_t num_of_threads) {
+  if (num_of_threads > 1) {
+    thread_pool_.reset(new ThreadPool(num_of_threads));
+  } else {
+    thread_pool_.reset();
+  }
+  rel_info_.SetThreadPool(thread_pool_.get());
+}
+
+void MultiSpacecraftCase::AddSpacecraft(Spacecraft* spacecraft) {
+  spacecraft_.push_back(spacecraft);
+  is_stages_updated_ = false;
+}
+
+void MultiSpacecraftCase::UpdateAllSpacecraft() {
+  const SimTime* sim_time = &(glo_env_->GetSimTime());
+  if (thread_pool_ == nullptr) {
+    for (auto itr = spacecraft_.begin(); itr != spacecraft_.end(); ++itr) (*itr)->Update(sim_time);
+  } else {
+    if (!is_stages_updated_) BuildStages();
+    for (auto stage = stages_.begin(); stage != stages_.end(); ++stage) {
+      thread_pool_->Run(stage->size(), [stage, sim_time](const size_t index) { (*stage)[index]->Update(sim_time); });
+    }
+  }
+
+  // Barrier: the states of all spacecraft after the update are copied into the relative information
+  rel_info_.Update();
+}
+
+void MultiSpacecraftCase::UpdateInteractions() {}
+
+void MultiSpacecraftCase::SaveCaseState(CheckpointWriter& writer) const {
+  writer.Write((uint64_t)spacecraft_.size());
+  for (auto itr = spacecraft_.begin(); itr != spacecraft_.end(); ++itr) (*itr)->SaveState(writer);
+}
+
+void MultiSpacecraftCase::LoadCaseState(CheckpointReader& reader) {
+  if (!reader.ReadSize(spacecraft_.size(), "spacecraft")) return;
+  for (auto itr = spacecraft_.begin(); itr != spacecraft_.end(); ++itr) (*itr)->LoadState(reader);
+}
+
+void MultiSpacecraftCase::BuildStages() {
+  DependencyStages dependency_stages;
+  std::vector<size_t> spacecraft_stages;
+  for (auto itr = spacecraft_.begin(); itr != spacecraft_.end(); ++itr) {
+    TickDependencies dependencies;
+    (*itr)->DeclareUpdateDependencies(dependencies);
+    spacecraft_stages.push_back(dependency_stages.Add(dependencies.GetReads(), dependencies.GetWrites()));
+  }
+
+  stages_.assign(dependency_stages.GetNumOfStages(), std::vector<Spacecraft*>());
+  for (size_t i = 0; i < spacecraft_.size(); i++) {
+    stages_[spacecraft_stages[i]].push_back(spacecraft_[i]);
+  }
+  is_stages_updated_ = true;
+}
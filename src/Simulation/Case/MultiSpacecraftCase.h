@@ -0,0 +1,104 @@
+/**
+ * @file MultiSpacecraftCase.h
+ * @brief Base class of simulation scenarios with multiple spacecraft updated concurrently
+ */
+
+#pragma once
+
+#include <Library/utils/ThreadPool.h>
+#include <RelativeInformation/RelativeInformation.h>
+
+#include <memory>
+#include <vector>
+
+#include "../Spacecraft/Spacecraft.h"
+#include "./SimulationCase.h"
+
+/**
+ * @class MultiSpacecraftCase
+ * @brief Base class of simulation scenarios with multiple spacecraft updated concurrently
+ * @details After the update of the global environment, all spacecraft are updated on a thread pool. The spacecraft are grouped into stages by
+ * their declared dependencies (Spacecraft::DeclareUpdateDependencies), so a spacecraft whose orbit refers to another spacecraft keeps the order
+ * of the serial update. All updates finish at the barrier before the states are copied into the relative information and the interactions between the
+ * spacecraft (e.g. inter-satellite links and ground stations) are calculated in UpdateInteractions. The results are identical to the serial
+ * update in the registration order.
+ * @note During the concurrent update, the spacecraft must not read the other spacecraft without declaring it. The relative information read
+ * there is calculated from the states copied at the barrier of the previous step. The global environment is only read.
+ */
+class MultiSpacecraftCase : public SimulationCase {
+ public:
+  /**
+   * @fn MultiSpacecraftCase
+   * @brief Constructor
+   * @note The number of threads is num_of_spacecraft_threads in the SIM_SETTING section. 1 is used when it is not given.
+   */
+  MultiSpacecraftCase(std::string ini_base);
+  /**
+   * @fn MultiSpacecraftCase
+   * @brief Constructor for Monte-Carlo Simulation
+   * @note The number of threads is num_of_spacecraft_threads as the other constructor. Keep it 1 when the cases run concurrently (NumOfThreads
+   * in the MC_EXECUTION section) to avoid running more threads than the hardware threads.
+   */
+  MultiSpacecraftCase(std::string ini_base, const MCSimExecutor& mc_sim, const std::string log_path);
+  /**
+   * @fn ~MultiSpacecraftCase
+   * @brief Destructor. The added spacecraft are deleted.
+   */
+  virtual ~MultiSpacecraftCase();
+
+  /**
+   * @fn Main
+   * @brief Override function of Main in SimulationCase
+   */
+  virtual void Main();
+
+  /**
+   * @fn SetNumOfThreads
+   * @brief Set the number of threads to update the spacecraft
+   * @param [in] num_of_threads: Number of threads including the simulation thread. 1 means the serial update in the registration order.
+   */
+  void SetNumOfThreads(const size_t num_of_threads);
+
+ protected:
+  RelativeInformation rel_info_;         //!< Relative information of the spacecraft
+  std::vector<Spacecraft*> spacecraft_;  //!< Spacecraft in the registration order
+
+  /**
+   * @fn AddSpacecraft
+   * @brief Register a spacecraft to be updated. The case takes the ownership.
+   * @note Call this in Initialize. Create the spacecraft with rel_info_ when the relative information is used.
+   */
+  void AddSpacecraft(Spacecraft* spacecraft);
+  /**
+   * @fn UpdateAllSpacecraft
+   * @brief Update all spacecraft and copy their states into the relative information
+   */
+  void UpdateAllSpacecraft();
+  /**
+   * @fn UpdateInteractions
+   * @brief Virtual function to calculate the interactions between the spacecraft after all spacecraft are updated
+   */
+  virtual void UpdateInteractions();
+
+  /**
+   * @fn SaveCaseState
+   * @brief Override function of SaveCaseState in SimulationCase. The spacecraft are written in the registration order.
+   */
+  virtual void SaveCaseState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCaseState
+   * @brief Override function of LoadCaseState in SimulationCase
+   */
+  virtual void LoadCaseState(CheckpointReader& reader);
+
+ private:
+  std::unique_ptr<ThreadPool> thread_pool_;       //!< Thread pool for the concurrent update. nullptr for the serial update.
+  std::vector<std::vector<Spacecraft*>> stages_;  //!< Spacecraft grouped into the stages updated in order
+  bool is_stages_updated_ = false;                //!< Are the stages built for the current spacecraft
+
+  /**
+   * @fn BuildStages
+   * @brief Group the spacecraft into the stages by their dependencies
+   */
+  void BuildStages();
+};
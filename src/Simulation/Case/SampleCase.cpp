@@ -12,6 +12,8 @@ using std::string;
 
 SampleCase::SampleCase(string ini_base) : SimulationCase(ini_base) {}
 
+SampleCase::SampleCase(string ini_base, const MCSimExecutor& mc_sim, const string log_path) : SimulationCase(ini_base, mc_sim, log_path) {}
+
 SampleCase::~SampleCase() { delete sample_sat_; }
 
 void SampleCase::Initialize() {
@@ -33,6 +35,9 @@ void SampleCase::Initialize() {
   // Start the simulation
   cout << "\nSimulationDateTime \n";
   glo_env_->GetSimTime().PrintStartDateTime();
+
+  // Restart from the checkpoint when it is set
+  RestartFromCheckpoint();
 }
 
 void SampleCase::Main() {
@@ -42,6 +47,8 @@ void SampleCase::Main() {
     if (glo_env_->GetSimTime().GetState().log_output) {
       sim_config_.main_logger_->WriteValues();
     }
+    // Checkpoint
+    UpdateCheckpoint();
 
     // Global Environment Update
     glo_env_->Update();
@@ -57,6 +64,16 @@ void SampleCase::Main() {
   }
 }
 
+void SampleCase::SaveCaseState(CheckpointWriter& writer) const {
+  sample_sat_->SaveState(writer);
+  sample_gs_->SaveState(writer);
+}
+
+void SampleCase::LoadCaseState(CheckpointReader& reader) {
+  sample_sat_->LoadState(reader);
+  sample_gs_->LoadState(reader);
+}
+
 string SampleCase::GetLogHeader() const {
   string str_tmp = "";
 
@@ -20,6 +20,11 @@ class SampleCase : public SimulationCase {
    * @brief Constructor
    */
   SampleCase(std::string ini_base);
+  /**
+   * @fn SampleCase
+   * @brief Constructor for Monte-Carlo Simulation
+   */
+  SampleCase(std::string ini_base, const MCSimExecutor& mc_sim, const std::string log_path);
 
   /**
    * @fn ~SampleCase
@@ -50,6 +55,18 @@ class SampleCase : public SimulationCase {
    */
   virtual std::string GetLogValue() const;
 
+ protected:
+  /**
+   * @fn SaveCaseState
+   * @brief Override function of SaveCaseState in SimulationCase
+   */
+  virtual void SaveCaseState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCaseState
+   * @brief Override function of LoadCaseState in SimulationCase
+   */
+  virtual void LoadCaseState(CheckpointReader& reader);
+
  private:
   SampleSat* sample_sat_;  //!< Instance of spacecraft
   SampleGS* sample_gs_;    //!< Instance of ground station
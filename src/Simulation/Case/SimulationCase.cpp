@@ -6,10 +6,57 @@
 #include "SimulationCase.h"
 
 #include <Interface/InitInput/IniAccess.h>
+#include <Library/utils/Macros.hpp>
 
 #include <Interface/LogOutput/InitLog.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
 #include <string>
 
+static const char kCheckpointMagic[8] = "S2ECKPT";  //!< Magic number of the checkpoint file
+static const uint32_t kCheckpointVersion = 4;       //!< Version of the checkpoint format. Increment it when the written states are changed.
+
+/**
+ * @fn ReadCheckpointHeader
+ * @brief Read and check the header of the checkpoint
+ * @param [in] reader: Checkpoint reader
+ * @param [out] seed: Random seed of the simulation which wrote the checkpoint
+ * @return True when the header is valid
+ */
+static bool ReadCheckpointHeader(CheckpointReader& reader, uint64_t& seed) {
+  char magic[8];
+  uint32_t version = 0;
+  reader.Read(magic);
+  if (reader.IsValid() && std::memcmp(magic, kCheckpointMagic, sizeof(magic)) != 0) reader.SetError("not a checkpoint file");
+  reader.Read(version);
+  if (reader.IsValid() && version != kCheckpointVersion) reader.SetError("checkpoint version " + std::to_string(version) + " is not supported");
+  reader.Read(seed);
+  return reader.IsValid();
+}
+
+/**
+ * @fn InitRandomContext
+ * @brief Make the random context of a simulation case with the seed in the initialization file
+ * @param [in] ini_base: Path to the base initialization file
+ * @param [in] case_id: ID of the simulation case
+ * @param [in] restart_file: Path to the checkpoint to restart from. Its seed is used when the seed in the initialization file is zero.
+ */
+static libra::RandomContext InitRandomContext(const std::string ini_base, const uint32_t case_id, const std::string restart_file = "") {
+  IniAccess simbase_ini = IniAccess(ini_base);
+  uint64_t seed = (uint32_t)simbase_ini.ReadInt("RAND", "Rand_Seed");
+  if (seed == 0 && !restart_file.empty()) {
+    std::ifstream file(restart_file, std::ios::in | std::ios::binary);
+    CheckpointReader reader(file);
+    ReadCheckpointHeader(reader, seed);
+  }
+  // The seed is varied by time when it is zero
+  if (seed == 0) seed = std::random_device()();
+  return libra::RandomContext(seed, case_id);
+}
+
 SimulationCase::SimulationCase(std::string ini_base) {
   IniAccess simbase_ini = IniAccess(ini_base);
   const char* section = "SIM_SETTING";
@@ -20,6 +67,12 @@ SimulationCase::SimulationCase(std::string ini_base) {
   sim_config_.gs_file_ = simbase_ini.ReadString(section, "gs_file");
   sim_config_.inter_sat_comm_file_ = simbase_ini.ReadString(section, "inter_sat_comm_file");
   sim_config_.gnss_file_ = simbase_ini.ReadString(section, "gnss_file");
+  sim_config_.num_of_component_threads_ = simbase_ini.ReadInt(section, "num_of_component_threads");
+  sim_config_.num_of_spacecraft_threads_ = simbase_ini.ReadInt(section, "num_of_spacecraft_threads");
+  checkpoint_interval_s_ = simbase_ini.ReadDouble("CHECKPOINT", "checkpoint_interval_sec");
+  next_checkpoint_time_s_ = checkpoint_interval_s_;
+  if (simbase_ini.ReadEnable("CHECKPOINT", "restart")) restart_file_ = simbase_ini.ReadString("CHECKPOINT", "restart_file");
+  sim_config_.random_context_ = InitRandomContext(ini_base, 0, restart_file_);
   glo_env_ = new GlobalEnvironment(&sim_config_);
 }
 SimulationCase::SimulationCase(std::string ini_base, const MCSimExecutor& mc_sim, const std::string log_path) {
@@ -29,13 +82,99 @@ SimulationCase::SimulationCase(std::string ini_base, const MCSimExecutor& mc_sim
   // Log for Monte Carlo Simulation
   std::string log_file_name = "default" + std::to_string(mc_sim.GetNumOfExecutionsDone()) + ".csv";
   // ToDo: Consider that `enable_inilog = false` is fine or not?
-  sim_config_.main_logger_ = new Logger(log_file_name, log_path, ini_base, false, mc_sim.LogHistory());
+  sim_config_.main_logger_ = new Logger(log_file_name, log_path, ini_base, false, mc_sim.LogHistory(), ReadLogFormat(ini_base, "log_format"));
+  InitLogAsync(sim_config_.main_logger_, ini_base);
   sim_config_.num_of_simulated_spacecraft_ = simbase_ini.ReadInt(section, "num_of_simulated_spacecraft");
   sim_config_.sat_file_ = simbase_ini.ReadStrVector(section, "sat_file");
   sim_config_.gs_file_ = simbase_ini.ReadString(section, "gs_file");
   sim_config_.inter_sat_comm_file_ = simbase_ini.ReadString(section, "inter_sat_comm_file");
   sim_config_.gnss_file_ = simbase_ini.ReadString(section, "gnss_file");
+  sim_config_.num_of_component_threads_ = simbase_ini.ReadInt(section, "num_of_component_threads");
+  sim_config_.num_of_spacecraft_threads_ = simbase_ini.ReadInt(section, "num_of_spacecraft_threads");
+  // Checkpoints are not used in the Monte-Carlo simulation
+  // Random numbers depend only on the seed and the case ID, not on the execution order of the cases
+  sim_config_.random_context_ = InitRandomContext(ini_base, (uint32_t)mc_sim.GetNumOfExecutionsDone());
   // Global Environment
   glo_env_ = new GlobalEnvironment(&sim_config_);
 }
 SimulationCase::~SimulationCase() { delete glo_env_; }
+
+void SimulationCase::SaveCaseState(CheckpointWriter& writer) const { UNUSED(writer); }
+
+void SimulationCase::LoadCaseState(CheckpointReader& reader) { UNUSED(reader); }
+
+void SimulationCase::UpdateCheckpoint() {
+  if (checkpoint_interval_s_ <= 0.0) return;
+  // Allow the rounding error of the accumulated elapsed time
+  const double elapsed_time_s = glo_env_->GetSimTime().GetElapsedSec();
+  if (elapsed_time_s < next_checkpoint_time_s_ - 1.0e-6) return;
+  while (next_checkpoint_time_s_ < elapsed_time_s + 1.0e-6) next_checkpoint_time_s_ += checkpoint_interval_s_;
+
+  char file_name[64];
+  snprintf(file_name, sizeof(file_name), "checkpoint_%012.3f.bin", elapsed_time_s);
+  const std::string file_path = sim_config_.main_logger_->GetLogPath() + file_name;
+  if (!SaveCheckpoint(file_path)) std::cerr << "Error writing checkpoint: " << file_path << std::endl;
+}
+
+void SimulationCase::RestartFromCheckpoint() {
+  if (restart_file_.empty()) return;
+  std::string error_message;
+  if (!LoadCheckpoint(restart_file_, error_message)) {
+    std::cerr << "Error restarting from checkpoint: " << restart_file_ << ": " << error_message << std::endl;
+    exit(1);
+  }
+  std::cout << "Restart from the checkpoint at " << glo_env_->GetSimTime().GetElapsedSec() << " sec" << std::endl;
+}
+
+bool SimulationCase::SaveCheckpoint(const std::string& file_path) {
+  // The checkpoint is renamed after it is completely written not to leave a broken checkpoint when the program is killed
+  const std::string temporary_file_path = file_path + ".tmp";
+  {
+    std::ofstream file(temporary_file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    CheckpointWriter writer(file);
+    writer.Write(kCheckpointMagic);
+    writer.Write(kCheckpointVersion);
+    writer.Write(sim_config_.random_context_.GetSeed());
+    glo_env_->SaveState(writer);
+    SaveCaseState(writer);
+    sim_config_.main_logger_->SaveState(writer);
+    writer.WriteSection("SimulationCase");
+    writer.Write(next_checkpoint_time_s_);
+    file.close();
+    if (!writer.IsValid() || file.fail()) {
+      std::remove(temporary_file_path.c_str());
+      return false;
+    }
+  }
+#ifdef WIN32
+  std::remove(file_path.c_str());  // rename does not overwrite an existing file on Windows
+#endif
+  // rename replaces the existing checkpoint atomically on POSIX
+  if (std::rename(temporary_file_path.c_str(), file_path.c_str()) != 0) {
+    std::remove(temporary_file_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool SimulationCase::LoadCheckpoint(const std::string& file_path, std::string& error_message) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  if (!file.is_open()) {
+    error_message = "file is not found";
+    return false;
+  }
+  CheckpointReader reader(file);
+  uint64_t seed = 0;
+  if (ReadCheckpointHeader(reader, seed) && seed != sim_config_.random_context_.GetSeed()) {
+    reader.SetError("Rand_Seed is different from the checkpoint");
+  }
+  glo_env_->LoadState(reader);
+  LoadCaseState(reader);
+  sim_config_.main_logger_->LoadState(reader);
+  if (reader.ReadSection("SimulationCase")) reader.Read(next_checkpoint_time_s_);
+  if (reader.IsValid() && file.peek() != std::ifstream::traits_type::eof()) reader.SetError("unexpected data at the end of the checkpoint");
+
+  error_message = reader.GetErrorMessage();
+  return reader.IsValid();
+}
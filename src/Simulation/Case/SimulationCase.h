@@ -7,6 +7,7 @@
 
 #include <Environment/Global/GlobalEnvironment.h>
 #include <Interface/LogOutput/ILoggable.h>
+#include <Library/utils/Checkpoint.hpp>
 #include <Simulation/MCSim/MCSimExecutor.h>
 
 #include "../SimulationConfig.h"
@@ -72,4 +73,49 @@ class SimulationCase : public ILoggable {
  protected:
   SimulationConfig sim_config_;  //!< Simulation setting
   GlobalEnvironment* glo_env_;   //!< Global Environment
+
+  /**
+   * @fn SaveCaseState
+   * @brief Virtual function to write the states of the user defined objects (e.g. spacecraft) into the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveCaseState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCaseState
+   * @brief Virtual function to read the states written by SaveCaseState
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadCaseState(CheckpointReader& reader);
+  /**
+   * @fn UpdateCheckpoint
+   * @brief Write a checkpoint when the checkpoint interval has passed
+   * @note Call this in each step after the log output and before the update of the global environment.
+   */
+  void UpdateCheckpoint();
+  /**
+   * @fn RestartFromCheckpoint
+   * @brief Restore the states from the restart file when it is set in the initialization file. The program exits when the restore fails.
+   * @note Call this at the end of Initialize after all objects are created and the log headers are written.
+   */
+  void RestartFromCheckpoint();
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write all states into the checkpoint file
+   * @param [in] file_path: Path to the checkpoint file
+   * @return True when the checkpoint is written
+   */
+  bool SaveCheckpoint(const std::string& file_path);
+  /**
+   * @fn LoadCheckpoint
+   * @brief Read all states from the checkpoint file
+   * @param [in] file_path: Path to the checkpoint file
+   * @param [out] error_message: Reason of the failure
+   * @return True when all states are restored
+   */
+  bool LoadCheckpoint(const std::string& file_path, std::string& error_message);
+
+ private:
+  double checkpoint_interval_s_ = 0.0;   //!< Interval of the checkpoints [s]. Checkpoints are not written when it is zero.
+  double next_checkpoint_time_s_ = 0.0;  //!< Elapsed time of the next checkpoint [s]
+  std::string restart_file_;             //!< Path to the checkpoint to restart from. Empty when the simulation starts from the beginning.
 };
@@ -0,0 +1,244 @@
+/**
+ * @file TestCheckpoint.cpp
+ * @brief Test codes for the checkpoint and the restart of the simulation case with GoogleTest
+ * @note The sample initialization files are copied into a temporary directory with the paths replaced by S2E_TEST_DATA_DIR, S2E_TEST_SOURCE_DIR,
+ *       and S2E_TEST_EXT_LIB_DIR given by CMake, so the test runs in any working directory. The logs and the checkpoints are written there too.
+ */
+#include <gtest/gtest.h>
+
+#include <Interface/InitInput/IniAccess.h>
+#include <Interface/LogOutput/Logger.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../GroundStation/SampleGroundStation/SampleGS.h"
+#include "../Spacecraft/SampleSpacecraft/SampleSat.h"
+#include "SimulationCase.h"
+
+namespace {
+
+namespace fs = std::filesystem;
+
+/**
+ * @class CheckpointCase
+ * @brief Sample spacecraft and ground station logged in the given format
+ * @note The case is made with the constructor for the Monte-Carlo simulation without the log history, so only the log of this class is written.
+ */
+class CheckpointCase : public SimulationCase {
+ public:
+  CheckpointCase(const std::string& ini_base, const std::string& log_path, const MCSimExecutor& mc_sim, const std::string& log_file_name,
+                 const LogFormat format)
+      : SimulationCase(ini_base, mc_sim, log_path), logger_(new Logger(log_file_name, log_path, ini_base, false, true, format)) {}
+  ~CheckpointCase() {
+    delete sample_sat_;
+    delete sample_gs_;
+    delete logger_;
+  }
+
+  void Initialize() {
+    sample_sat_ = new SampleSat(&sim_config_, glo_env_, 0);
+    sample_gs_ = new SampleGS(&sim_config_, 0);
+    glo_env_->LogSetup(*logger_);
+    sample_sat_->LogSetup(*logger_);
+    sample_gs_->LogSetup(*logger_);
+    logger_->WriteHeaders();
+    glo_env_->Reset();
+  }
+  void Main() {}
+  std::string GetLogHeader() const { return ""; }
+  std::string GetLogValue() const { return ""; }
+
+  /**
+   * @fn WriteLog
+   * @brief Log the current step. The checkpoint is taken after this as SampleCase::Main.
+   */
+  void WriteLog() {
+    if (glo_env_->GetSimTime().GetState().log_output) logger_->WriteValues();
+  }
+  /**
+   * @fn Update
+   * @brief Update the global environment, the spacecraft, and the ground station
+   */
+  void Update() {
+    glo_env_->Update();
+    sample_sat_->Update(&(glo_env_->GetSimTime()));
+    sample_gs_->Update(glo_env_->GetCelesInfo().GetEarthRotation(), *sample_sat_);
+  }
+  /**
+   * @fn Step
+   * @brief Log and update a step
+   */
+  void Step() {
+    WriteLog();
+    Update();
+  }
+
+  using SimulationCase::LoadCheckpoint;
+  using SimulationCase::SaveCheckpoint;
+
+  const Dynamics& GetDynamics() const { return sample_sat_->GetDynamics(); }
+  std::string GetLogFilePath() const { return logger_->GetFilePath(); }
+
+ private:
+  Logger* logger_;                   //!< Log of the case
+  SampleSat* sample_sat_ = nullptr;  //!< Spacecraft
+  SampleGS* sample_gs_ = nullptr;    //!< Ground station
+
+  void SaveCaseState(CheckpointWriter& writer) const {
+    sample_sat_->SaveState(writer);
+    sample_gs_->SaveState(writer);
+    logger_->SaveState(writer);
+  }
+  void LoadCaseState(CheckpointReader& reader) {
+    sample_sat_->LoadState(reader);
+    sample_gs_->LoadState(reader);
+    logger_->LoadState(reader);
+  }
+};
+
+/**
+ * @fn ReadFile
+ * @brief Read all bytes of a file
+ */
+std::vector<char> ReadFile(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @fn ReplaceAll
+ * @brief Replace all occurrences of a string
+ */
+std::string ReplaceAll(std::string text, const std::string& from, const std::string& to) {
+  for (size_t pos = text.find(from); pos != std::string::npos; pos = text.find(from, pos + to.size())) text.replace(pos, from.size(), to);
+  return text;
+}
+
+/**
+ * @fn IniPath
+ * @brief Convert a path to be written in the initialization files
+ * @note The path is made relative to the working directory since inih takes a slash after a space as the start of an inline comment.
+ */
+std::string IniPath(const fs::path& path) {
+  const fs::path relative_path = fs::relative(path);
+  return (relative_path.empty() ? path : relative_path).generic_string();
+}
+
+}  // namespace
+
+/**
+ * @class CheckpointTest
+ * @brief Fixture to copy the sample initialization files into a temporary directory
+ */
+class CheckpointTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const fs::path source_ini_dir = fs::path(S2E_TEST_DATA_DIR) / "SampleSat" / "ini";
+    if (!fs::exists(source_ini_dir / "SampleSimBase.ini")) GTEST_SKIP() << "The sample initialization files are not found in " << source_ini_dir;
+
+    temp_dir_ = fs::temp_directory_path() / ("s2e_checkpoint_test_" + std::to_string(std::random_device()()));
+    const fs::path ini_dir = temp_dir_ / "ini";
+    const fs::path log_dir = temp_dir_ / "logs";
+    fs::create_directories(ini_dir);
+    fs::create_directories(log_dir);
+    log_path_ = IniPath(log_dir) + "/";
+
+    // The sample files refer to each other with the paths relative to a directory two levels below the repository
+    for (const fs::directory_entry& entry : fs::recursive_directory_iterator(source_ini_dir)) {
+      const fs::path copied_path = ini_dir / fs::relative(entry.path(), source_ini_dir);
+      if (entry.is_directory()) {
+        fs::create_directories(copied_path);
+      } else if (entry.path().extension() == ".ini") {
+        std::ifstream source_file(entry.path());
+        std::stringstream text;
+        text << source_file.rdbuf();
+        std::string replaced = ReplaceAll(text.str(), "../../data/SampleSat/ini/", IniPath(ini_dir) + "/");
+        replaced = ReplaceAll(replaced, "../../data/SampleSat/logs/", log_path_);
+        replaced = ReplaceAll(replaced, "../../../ExtLibraries/", IniPath(S2E_TEST_EXT_LIB_DIR) + "/");
+        replaced = ReplaceAll(replaced, "../../../s2e-core/", IniPath(S2E_TEST_SOURCE_DIR) + "/");
+        std::ofstream copied_file(copied_path);
+        copied_file << replaced;
+      } else {
+        fs::copy_file(entry.path(), copied_path);
+      }
+    }
+    ini_base_ = IniPath(ini_dir / "SampleSimBase.ini");
+
+    // SPICE stops the program when a kernel is not found
+    IniAccess ini_file(ini_base_);
+    for (const char* keyword : {"TLS", "TPC1", "TPC2", "TPC3", "BSP"}) {
+      const std::string kernel_path = ini_file.ReadString("FURNSH_PATH", keyword);
+      if (!fs::exists(kernel_path)) GTEST_SKIP() << "The SPICE kernel is not found: " << kernel_path;
+    }
+  }
+  void TearDown() override {
+    std::error_code error_code;
+    if (!temp_dir_.empty()) fs::remove_all(temp_dir_, error_code);
+  }
+
+  /**
+   * @fn ExpectRestartIdentical
+   * @brief Checkpoint the case, restore it into a new case, step both, and compare the states and the logs
+   */
+  void ExpectRestartIdentical(const LogFormat format) {
+    const int num_steps_before = 300;
+    const int num_steps_after = 300;
+    // The Monte-Carlo simulation without the log history does not write the default log
+    MCSimExecutor mc_sim(2);
+    mc_sim.LogHistory(false);
+
+    std::string checkpoint_path;
+    std::string original_log_path;
+    libra::Vector<3> position_i;
+    libra::Quaternion quaternion_i2b;
+    libra::Vector<3> omega_b;
+    {
+      CheckpointCase original(ini_base_, log_path_, mc_sim, "checkpoint_original.csv", format);
+      original.Initialize();
+      for (int i = 0; i < num_steps_before; i++) original.Step();
+      original.WriteLog();
+      original_log_path = original.GetLogFilePath();
+      checkpoint_path = log_path_ + "checkpoint.bin";
+      ASSERT_TRUE(original.SaveCheckpoint(checkpoint_path));
+      original.Update();
+      for (int i = 0; i < num_steps_after; i++) original.Step();
+      position_i = original.GetDynamics().GetOrbit().GetSatPosition_i();
+      quaternion_i2b = original.GetDynamics().GetAttitude().GetQuaternion_i2b();
+      omega_b = original.GetDynamics().GetAttitude().GetOmega_b();
+    }
+
+    std::string restarted_log_path;
+    {
+      CheckpointCase restarted(ini_base_, log_path_, mc_sim, "checkpoint_restarted.csv", format);
+      restarted.Initialize();
+      std::string error_message;
+      ASSERT_TRUE(restarted.LoadCheckpoint(checkpoint_path, error_message)) << error_message;
+      restarted.Update();
+      for (int i = 0; i < num_steps_after; i++) restarted.Step();
+      restarted_log_path = restarted.GetLogFilePath();
+      for (size_t i = 0; i < 3; i++) {
+        EXPECT_EQ(position_i[i], restarted.GetDynamics().GetOrbit().GetSatPosition_i()[i]);
+        EXPECT_EQ(omega_b[i], restarted.GetDynamics().GetAttitude().GetOmega_b()[i]);
+      }
+      for (size_t i = 0; i < 4; i++) EXPECT_EQ(quaternion_i2b[i], restarted.GetDynamics().GetAttitude().GetQuaternion_i2b()[i]);
+    }
+
+    // The log files are closed when the cases are deleted
+    const std::vector<char> original_log = ReadFile(original_log_path);
+    EXPECT_FALSE(original_log.empty());
+    EXPECT_TRUE(original_log == ReadFile(restarted_log_path));
+  }
+
+  fs::path temp_dir_;     //!< Temporary directory of the initialization files, the logs, and the checkpoints
+  std::string ini_base_;  //!< Path to the copied base initialization file
+  std::string log_path_;  //!< Path to the log directory with the trailing slash
+};
+
+TEST_F(CheckpointTest, RestartWithCsvLog) { ExpectRestartIdentical(LogFormat::kCsv); }
+
+TEST_F(CheckpointTest, RestartWithBinaryLog) { ExpectRestartIdentical(LogFormat::kBinary); }
@@ -88,3 +88,19 @@ std::string GroundStation::GetLogValue() const {
   }
   return str_tmp;
 }
+
+void GroundStation::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("GroundStation");
+  writer.Write(gs_id_);
+  writer.Write(gs_position_i_);
+  for (int i = 0; i < num_sc_; i++) writer.Write(is_visible_.at(i));
+}
+
+void GroundStation::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("GroundStation")) return;
+  int gs_id = 0;
+  reader.Read(gs_id);
+  if (reader.IsValid() && gs_id != gs_id_) reader.SetError("ground station " + std::to_string(gs_id_) + " is expected");
+  reader.Read(gs_position_i_);
+  for (int i = 0; i < num_sc_; i++) reader.Read(is_visible_[i]);
+}
@@ -17,7 +17,7 @@
  * @class GroundStation
  * @brief Base class of ground station
  */
-class GroundStation : public ILoggable {
+class GroundStation : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn GroundStation
@@ -58,6 +58,18 @@ class GroundStation : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveState
+   * @brief Write the position in the inertial frame and the visibility of the spacecraft
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   // Getters
   /**
    * @fn GetGsId
@@ -22,3 +22,13 @@ void SampleGS::Update(const CelestialRotation& celes_rotation, const SampleSat&
   GroundStation::Update(celes_rotation, spacecraft);
   components_->GetGsCalculator()->Update(spacecraft, spacecraft.GetInstalledComponents().GetAntenna(), *this, *(components_->GetAntenna()));
 }
+
+void SampleGS::SaveState(CheckpointWriter& writer) const {
+  GroundStation::SaveState(writer);
+  components_->GetGsCalculator()->SaveState(writer);
+}
+
+void SampleGS::LoadState(CheckpointReader& reader) {
+  GroundStation::LoadState(reader);
+  components_->GetGsCalculator()->LoadState(reader);
+}
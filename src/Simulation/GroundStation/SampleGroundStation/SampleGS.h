@@ -48,6 +48,16 @@ class SampleGS : public GroundStation {
    * @brief Override function of Update in GroundStation class
    */
   virtual void Update(const CelestialRotation& celes_rotation, const SampleSat& spacecraft);
+  /**
+   * @fn SaveState
+   * @brief Override function of SaveState in GroundStation class. The components are written with it.
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Override function of LoadState in GroundStation class
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
  private:
   SampleGSComponents* components_;  //!< Ground station related components
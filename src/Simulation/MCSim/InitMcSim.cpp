@@ -95,5 +95,9 @@ MCSimExecutor* InitMCSim(std::string file_name) {
     mc_sim->AddInitParameter(so_str, ip_str, mean_or_min, sigma_or_max, rnd_type);
   }
 
+  // Seed of the randomization. The seed is varied by time when it is zero.
+  unsigned long seed = (unsigned long)ini_file.ReadInt("MC_EXECUTION", "Seed");
+  if (seed != 0) mc_sim->SetSeed(seed, true);
+
   return mc_sim;
 }
@@ -9,33 +9,11 @@
 
 using namespace std;
 
-random_device InitParameter::rnd_;
-mt19937 InitParameter::mt_;
-uniform_real_distribution<>* InitParameter::uniform_dist_;
-normal_distribution<>* InitParameter::normal_dist_;
-
 InitParameter::InitParameter() {
-  // Generate object when the first execution
-  static bool initial_setup_done = false;
-  if (!initial_setup_done) {
-    SetSeed();
-    InitParameter::uniform_dist_ = new uniform_real_distribution<>(0.0, 1.0);
-    InitParameter::normal_dist_ = new normal_distribution<>(0.0, 1.0);
-    initial_setup_done = true;
-  }
-
   // No randomization when SetRandomConfig is not called（No setting in MCSim.ini）
   rnd_type_ = NoRandomization;
 }
 
-void InitParameter::SetSeed(unsigned long seed, bool is_deterministic) {
-  if (is_deterministic) {
-    InitParameter::mt_.seed(seed);
-  } else {
-    InitParameter::mt_.seed(InitParameter::rnd_());
-  }
-}
-
 void InitParameter::GetDouble(double& dst) const {
   if (rnd_type_ == NoRandomization) {
     ;
@@ -60,7 +38,8 @@ void InitParameter::GetQuaternion(Quaternion& dst_quat) const {
   dst_quat.normalize();
 }
 
-void InitParameter::Randomize() {
+void InitParameter::Randomize(const libra::RandomStream& stream) {
+  rand_stream_ = stream;
   switch (rnd_type_) {
     case NoRandomization:
       gen_NoRandomization();
@@ -94,9 +73,9 @@ void InitParameter::Randomize() {
   }
 }
 
-double InitParameter::Uniform_1d(double lb, double ub) { return lb + (*InitParameter::uniform_dist_)(InitParameter::mt_) * (ub - lb); }
+double InitParameter::Uniform_1d(double lb, double ub) { return lb + rand_stream_.GenerateUniform() * (ub - lb); }
 
-double InitParameter::Normal_1d(double mean, double std) { return mean + (*InitParameter::normal_dist_)(InitParameter::mt_) * (std); }
+double InitParameter::Normal_1d(double mean, double std) { return mean + rand_stream_.GenerateNormal() * (std); }
 
 void InitParameter::gen_NoRandomization() { val_.clear(); }
 
@@ -6,9 +6,9 @@
 #pragma once
 
 #include <Library/math/Quaternion.hpp>
+#include <Library/math/RandomStream.hpp>
 #include <Library/math/Vector.hpp>
 #include <cmath>
-#include <random>
 #include <string>
 #include <vector>
 
@@ -44,11 +44,6 @@ class InitParameter {
   InitParameter();
 
   // Setter
-  /**
-   * @fn SetSeed
-   * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
-   */
-  static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
   /**
    * @fn SetRandomConfig
    * @brief Set randomization parameters
@@ -78,8 +73,9 @@ class InitParameter {
   /**
    * @fn Randomize
    * @brief Randomize values with randomization parameters
+   * @param [in] stream: Random stream used for this randomization
    */
-  void Randomize();
+  void Randomize(const libra::RandomStream& stream);
 
  private:
   std::vector<double> val_;  //!< Randomized value
@@ -88,22 +84,19 @@ class InitParameter {
   std::vector<double> sigma_or_max_;  //!< standard deviation or maximum value. Refer comment in gen_[RandomizationType] function.
 
   // For randomization
-  RandomizationType rnd_type_;                             //!< Randomization type
-  static std::random_device rnd_;                          //!< Non-deterministic random number generator with time information
-  static std::mt19937 mt_;                                 //!< Deterministic random number generator
-  static std::uniform_real_distribution<>* uniform_dist_;  //!< Uniform random number generator
-  static std::normal_distribution<>* normal_dist_;         //!< Normal random number generator
+  RandomizationType rnd_type_;       //!< Randomization type
+  libra::RandomStream rand_stream_;  //!< Random stream of the current randomization
 
   /**
    * @fn Uniform_1d
    * @brief Generate 1-dimensional uniform distribution random number
    */
-  static double Uniform_1d(double lb, double ub);
+  double Uniform_1d(double lb, double ub);
   /**
    * @fn Normal_1d
    * @brief Generate 1-dimensional normal distribution random number
    */
-  static double Normal_1d(double mean, double std);
+  double Normal_1d(double mean, double std);
 
   // Generate randomized value
   /**
@@ -5,12 +5,35 @@
 
 #include "MCSimExecutor.h"
 
+#include <random>
+
 using std::string;
 
+/**
+ * @fn HashParameterName
+ * @brief Make the stream ID of a parameter from its name with the 32 bit FNV-1a hash
+ * @note std::hash is not used since the result depends on the implementation of the standard library.
+ */
+static uint32_t HashParameterName(const string& name) {
+  uint32_t hash = 0x811c9dc5;
+  for (const char c : name) {
+    hash ^= (uint8_t)c;
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
 MCSimExecutor::MCSimExecutor(unsigned long long total_num_of_executions) : total_num_of_executions_(total_num_of_executions) {
   num_of_executions_done_ = 0;
   enabled_ = total_num_of_executions_ > 1 ? true : false;
   log_history_ = !enabled_;
+  SetSeed();
+}
+
+MCSimExecutor::~MCSimExecutor() {
+  for (auto ip : ip_list_) {
+    delete ip.second;
+  }
 }
 
 bool MCSimExecutor::WillExecuteNextCase() {
@@ -59,8 +82,26 @@ void MCSimExecutor::GetInitParameterQuaternion(string so_name, string ip_name, Q
 
 void MCSimExecutor::RandomizeAllParameters() {
   for (auto ip : ip_list_) {
-    ip.second->Randomize();
+    ip.second->Randomize(libra::RandomStream(seed_, (uint32_t)num_of_executions_done_, 0, HashParameterName(ip.first)));
+  }
+}
+
+MCSimExecutor* MCSimExecutor::CreateCaseExecutor(const unsigned long long case_id) const {
+  MCSimExecutor* case_executor = new MCSimExecutor(total_num_of_executions_);
+  case_executor->enabled_ = enabled_;
+  case_executor->log_history_ = log_history_;
+  case_executor->seed_ = seed_;
+  case_executor->num_of_executions_done_ = case_id;
+  for (auto ip : ip_list_) {
+    case_executor->ip_list_[ip.first] = new InitParameter(*ip.second);
   }
+  return case_executor;
 }
 
-void MCSimExecutor::SetSeed(unsigned long seed, bool is_deterministic) { InitParameter::SetSeed(seed, is_deterministic); }
+void MCSimExecutor::SetSeed(unsigned long seed, bool is_deterministic) {
+  if (is_deterministic) {
+    seed_ = seed;
+  } else {
+    seed_ = std::random_device()();
+  }
+}
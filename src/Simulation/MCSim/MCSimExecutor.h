@@ -6,6 +6,7 @@
 #pragma once
 
 #include <Library/math/Vector.hpp>
+#include <cstdint>
 #include <map>
 #include <string>
 //#include "SimulationObject.h"
@@ -23,6 +24,7 @@ class MCSimExecutor {
   unsigned long long num_of_executions_done_;   //!< Number of executed case
   bool enabled_;                                //!< Flag to execute Monte-Carlo Simulation or not
   bool log_history_;                            //!< Flag to store the log for each case or not
+  uint64_t seed_;                               //!< Seed of the randomization of the parameters
 
   std::map<std::string, InitParameter*> ip_list_;  //!< List of InitParameters read from MCSim.ini
 
@@ -34,6 +36,13 @@ class MCSimExecutor {
    * @brief Constructor
    */
   MCSimExecutor(unsigned long long total_num_of_executions);
+  /**
+   * @fn ~MCSimExecutor
+   * @brief Destructor
+   */
+  ~MCSimExecutor();
+  MCSimExecutor(const MCSimExecutor&) = delete;
+  MCSimExecutor& operator=(const MCSimExecutor&) = delete;
 
   // Setter
   /**
@@ -55,7 +64,7 @@ class MCSimExecutor {
    * @fn SetSeed
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
    */
-  static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
 
   // Getter
   /**
@@ -127,8 +136,18 @@ class MCSimExecutor {
   /**
    * @fn RandomizeAllParameters
    * @brief Randomize all initialized parameter
+   * @note The random values depend only on the seed, the number of executed case, and the name of the parameter.
    */
   void RandomizeAllParameters();
+
+  /**
+   * @fn CreateCaseExecutor
+   * @brief Create an executor which holds a copy of the parameters and the seed for a simulation case
+   * @details Used to execute the cases in parallel. RandomizeAllParameters of the created executor draws the parameters of the case.
+   * @param [in] case_id: Index of the case. It is returned by GetNumOfExecutionsDone of the created executor.
+   * @return Executor for the case. The caller must delete it.
+   */
+  MCSimExecutor* CreateCaseExecutor(const unsigned long long case_id) const;
 };
 
 void MCSimExecutor::Enable(bool enabled) { enabled_ = enabled; }
@@ -62,13 +62,13 @@ class SimulationObject {
 
   /**
    * @fn SetAllParameters
-   * @brief Execute all SetParameter function for all SimulationObject instance
+   * @brief Execute all SetParameter function for all SimulationObject instance created in the current thread
    */
   static void SetAllParameters(const MCSimExecutor& mc_sim);
 
  private:
   std::string name_;  //!< Name to distinguish the target variable in initialize file for Monte-Carlo simulation
-  static std::map<std::string, SimulationObject*> so_list_;  //!< list of objects with simulation parameters
+  static thread_local std::map<std::string, SimulationObject*> so_list_;  //!< list of objects with simulation parameters in each thread
 };
 
 /**
@@ -8,19 +8,23 @@
 #include <vector>
 
 #include "../Interface/LogOutput/Logger.h"
+#include "../Library/math/RandomContext.hpp"
 
 /**
  * @struct SimulationConfig
  * @brief Simulation setting information
  */
 struct SimulationConfig {
-  std::string ini_base_fname_;         //!< Base file name for initialization
-  Logger* main_logger_;                //!< Main logger
-  int num_of_simulated_spacecraft_;    //!< Number of simulated spacecraft
-  std::vector<std::string> sat_file_;  //!< File name list for spacecraft initialization
-  std::string gs_file_;                //!< File name for ground station initialization
-  std::string inter_sat_comm_file_;    //!< File name for inter-satellite communication initialization
-  std::string gnss_file_;              //!< File name for GNSS initialization
+  std::string ini_base_fname_;           //!< Base file name for initialization
+  Logger* main_logger_;                  //!< Main logger
+  int num_of_simulated_spacecraft_;      //!< Number of simulated spacecraft
+  int num_of_component_threads_ = 1;     //!< Number of threads to execute the components of each spacecraft
+  int num_of_spacecraft_threads_ = 1;    //!< Number of threads to update the spacecraft in MultiSpacecraftCase
+  std::vector<std::string> sat_file_;    //!< File name list for spacecraft initialization
+  std::string gs_file_;                  //!< File name for ground station initialization
+  std::string inter_sat_comm_file_;      //!< File name for inter-satellite communication initialization
+  std::string gnss_file_;                //!< File name for GNSS initialization
+  libra::RandomContext random_context_;  //!< Random context of the simulation case. Spacecraft make their contexts from it.
 
   /**
    * @fn ~SimulationConfig
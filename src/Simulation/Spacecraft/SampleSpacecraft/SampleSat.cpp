@@ -12,6 +12,14 @@
 #include "SampleComponents.h"
 
 SampleSat::SampleSat(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, const int sat_id) : Spacecraft(sim_config, glo_env, sat_id) {
+  libra::RandomContext::Scope random_scope(random_context_);
+  sample_components_ = new SampleComponents(dynamics_, structure_, local_env_, glo_env, sim_config, &clock_gen_, sat_id);
+  components_ = sample_components_;
+}
+
+SampleSat::SampleSat(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, RelativeInformation* rel_info, const int sat_id)
+    : Spacecraft(sim_config, glo_env, rel_info, sat_id) {
+  libra::RandomContext::Scope random_scope(random_context_);
   sample_components_ = new SampleComponents(dynamics_, structure_, local_env_, glo_env, sim_config, &clock_gen_, sat_id);
   components_ = sample_components_;
 }
@@ -21,6 +21,11 @@ class SampleSat : public Spacecraft {
    * @brief Constructor
    */
   SampleSat(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, const int sat_id);
+  /**
+   * @fn SampleSat
+   * @brief Constructor with the relative information
+   */
+  SampleSat(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, RelativeInformation* rel_info, const int sat_id);
 
   /**
    * @fn GetInstalledComponents
@@ -5,15 +5,18 @@
 
 #include "Spacecraft.h"
 
+#include <algorithm>
+
 #include <Interface/LogOutput/LogUtility.h>
 #include <Interface/LogOutput/Logger.h>
 
-Spacecraft::Spacecraft(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, const int sat_id) : sat_id_(sat_id) {
+Spacecraft::Spacecraft(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, const int sat_id)
+    : sat_id_(sat_id), random_context_(sim_config->random_context_.CreateSatelliteContext(sat_id)) {
   Initialize(sim_config, glo_env, sat_id);
 }
 
 Spacecraft::Spacecraft(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, RelativeInformation* rel_info, const int sat_id)
-    : sat_id_(sat_id) {
+    : sat_id_(sat_id), random_context_(sim_config->random_context_.CreateSatelliteContext(sat_id)) {
   Initialize(sim_config, glo_env, rel_info, sat_id);
 }
 
@@ -29,11 +32,14 @@ Spacecraft::~Spacecraft() {
 }
 
 void Spacecraft::Initialize(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, const int sat_id) {
+  libra::RandomContext::Scope random_scope(random_context_);
   clock_gen_.ClearTimerCount();
+  clock_gen_.SetNumOfThreads((size_t)std::max(sim_config->num_of_component_threads_, 1));
   structure_ = new Structure(sim_config, sat_id);
   local_env_ = new LocalEnvironment(sim_config, glo_env, sat_id);
   dynamics_ = new Dynamics(sim_config, &(glo_env->GetSimTime()), &(local_env_->GetCelesInfo()), sat_id, structure_);
   disturbances_ = new Disturbances(sim_config, sat_id, structure_, glo_env);
+  dynamics_->SetOrbitAccelerationModel(disturbances_);
 
   sim_config->main_logger_->CopyFileToLogDir(sim_config->sat_file_[sat_id]);
 
@@ -41,11 +47,14 @@ void Spacecraft::Initialize(SimulationConfig* sim_config, const GlobalEnvironmen
 }
 
 void Spacecraft::Initialize(SimulationConfig* sim_config, const GlobalEnvironment* glo_env, RelativeInformation* rel_info, const int sat_id) {
+  libra::RandomContext::Scope random_scope(random_context_);
   clock_gen_.ClearTimerCount();
+  clock_gen_.SetNumOfThreads((size_t)std::max(sim_config->num_of_component_threads_, 1));
   structure_ = new Structure(sim_config, sat_id);
   local_env_ = new LocalEnvironment(sim_config, glo_env, sat_id);
   dynamics_ = new Dynamics(sim_config, &(glo_env->GetSimTime()), &(local_env_->GetCelesInfo()), sat_id, structure_, rel_info);
   disturbances_ = new Disturbances(sim_config, sat_id, structure_, glo_env);
+  dynamics_->SetOrbitAccelerationModel(disturbances_);
 
   sim_config->main_logger_->CopyFileToLogDir(sim_config->sat_file_[sat_id]);
 
@@ -71,7 +80,10 @@ void Spacecraft::Update(const SimTime* sim_time) {
   clock_gen_.UpdateComponents(sim_time);
 
   // Add generated force and torque by disturbances
-  dynamics_->AddAcceleration_i(disturbances_->GetAccelerationI());
+  if (!dynamics_->GetOrbit().GetIsAccelerationModelUsed()) {
+    // The acceleration disturbances are evaluated in the orbit integration stages when the model is used
+    dynamics_->AddAcceleration_i(disturbances_->GetAccelerationI());
+  }
   dynamics_->AddTorque_b(disturbances_->GetTorque());
   dynamics_->AddForce_b(disturbances_->GetForce());
 
@@ -83,4 +95,32 @@ void Spacecraft::Update(const SimTime* sim_time) {
   dynamics_->Update(sim_time, &(local_env_->GetCelesInfo()));
 }
 
+void Spacecraft::DeclareUpdateDependencies(TickDependencies& dependencies) const {
+  const int reference_sat_id = dynamics_->GetOrbit().GetReferenceSatId();
+  if (rel_info_ != nullptr && reference_sat_id >= 0) dependencies.Read(rel_info_->GetReferenceSatDynamics(reference_sat_id));
+  dependencies.Write(dynamics_);
+}
+
+void Spacecraft::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("Spacecraft");
+  writer.Write(sat_id_);
+  structure_->SaveState(writer);
+  dynamics_->SaveState(writer);
+  local_env_->SaveState(writer);
+  disturbances_->SaveState(writer);
+  clock_gen_.SaveState(writer);
+}
+
+void Spacecraft::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("Spacecraft")) return;
+  int sat_id = 0;
+  reader.Read(sat_id);
+  if (reader.IsValid() && sat_id != sat_id_) reader.SetError("spacecraft " + std::to_string(sat_id_) + " is expected");
+  structure_->LoadState(reader);
+  dynamics_->LoadState(reader);
+  local_env_->LoadState(reader);
+  disturbances_->LoadState(reader);
+  clock_gen_.LoadState(reader);
+}
+
 void Spacecraft::Clear(void) { dynamics_->ClearForceTorque(); }
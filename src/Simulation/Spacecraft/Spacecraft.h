@@ -9,6 +9,7 @@
 #include <Dynamics/Dynamics.h>
 #include <Environment/Global/ClockGenerator.h>
 #include <Environment/Local/LocalEnvironment.h>
+#include <Library/math/RandomContext.hpp>
 #include <RelativeInformation/RelativeInformation.h>
 
 #include "InstalledComponents.hpp"
@@ -58,6 +59,14 @@ class Spacecraft {
    * @brief Update all states related with the spacecraft
    */
   virtual void Update(const SimTime* sim_time);
+  /**
+   * @fn DeclareUpdateDependencies
+   * @brief Declare the objects read and written in Update which are shared with the other spacecraft
+   * @note The default declares the dynamics as written and the dynamics of the reference spacecraft of the orbit as read. Override this when
+   * the spacecraft reads the other spacecraft in Update (e.g. through the relative information).
+   * @param [out] dependencies: Objects read and written in Update
+   */
+  virtual void DeclareUpdateDependencies(TickDependencies& dependencies) const;
 
   /**
    * @fn Clear
@@ -70,6 +79,18 @@ class Spacecraft {
    * @brief Logger setting for the spacecraft specific information
    */
   virtual void LogSetup(Logger& logger);
+  /**
+   * @fn SaveState
+   * @brief Write the states of the spacecraft. The components registered in the clock generator are written with it.
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
   // Getters
   /**
@@ -104,12 +125,13 @@ class Spacecraft {
   inline int GetSatID() const { return sat_id_; }
 
  protected:
-  ClockGenerator clock_gen_;         //!< Origin of clock for the spacecraft
-  Dynamics* dynamics_;               //!< Dynamics information of the spacecraft
-  RelativeInformation* rel_info_;    //!< Relative information with respect to the other spacecraft
-  LocalEnvironment* local_env_;      //!< Local environment information around the spacecraft
-  Disturbances* disturbances_;       //!< Disturbance information acting on the spacecraft
-  Structure* structure_;             //!< Structure information of the spacecraft
-  InstalledComponents* components_;  //!< Components information installed on the spacecraft
-  const int sat_id_;                 //!< ID of the spacecraft
+  ClockGenerator clock_gen_;             //!< Origin of clock for the spacecraft
+  Dynamics* dynamics_;                   //!< Dynamics information of the spacecraft
+  RelativeInformation* rel_info_;        //!< Relative information with respect to the other spacecraft
+  LocalEnvironment* local_env_;          //!< Local environment information around the spacecraft
+  Disturbances* disturbances_;           //!< Disturbance information acting on the spacecraft
+  Structure* structure_;                 //!< Structure information of the spacecraft
+  InstalledComponents* components_;      //!< Components information installed on the spacecraft
+  const int sat_id_;                     //!< ID of the spacecraft
+  libra::RandomContext random_context_;  //!< Random context of the spacecraft. Construct the components in the scope of this context.
 };
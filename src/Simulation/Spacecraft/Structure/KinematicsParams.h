@@ -25,7 +25,7 @@ class KinematicsParams {
    * @fn ~KinematicsParams
    * @brief Destructor
    */
-  ~KinematicsParams(){};
+  ~KinematicsParams() = default;
 
   // Getter
   /**
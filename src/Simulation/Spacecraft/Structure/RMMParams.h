@@ -22,7 +22,7 @@ class RMMParams {
    * @fn ~RMMParams
    * @brief Destructor
    */
-  ~RMMParams(){};
+  ~RMMParams() = default;
 
   // Getter
   /**
@@ -27,3 +27,23 @@ void Structure::Initialize(SimulationConfig* sim_config, const int sat_id) {
   surfaces_ = InitSurfaces(ini_fname);
   rmm_params_ = new RMMParams(InitRMMParams(ini_fname));
 }
+
+void Structure::SaveState(CheckpointWriter& writer) const {
+  writer.WriteSection("Structure");
+  writer.Write(*kinnematics_params_);
+  writer.Write((uint64_t)surfaces_.size());
+  for (const Surface& surface : surfaces_) {
+    writer.Write(surface);
+  }
+  writer.Write(*rmm_params_);
+}
+
+void Structure::LoadState(CheckpointReader& reader) {
+  if (!reader.ReadSection("Structure")) return;
+  reader.Read(*kinnematics_params_);
+  if (!reader.ReadSize(surfaces_.size(), "surfaces")) return;
+  for (Surface& surface : surfaces_) {
+    reader.Read(surface);
+  }
+  reader.Read(*rmm_params_);
+}
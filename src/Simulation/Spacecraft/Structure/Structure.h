@@ -4,6 +4,7 @@
  */
 
 #pragma once
+#include <Library/utils/Checkpoint.hpp>
 #include <Simulation/SimulationConfig.h>
 
 #include <vector>
@@ -34,6 +35,18 @@ class Structure {
    * @brief Initialize function
    */
   void Initialize(SimulationConfig* sim_config, const int sat_id);
+  /**
+   * @fn SaveState
+   * @brief Write the kinematics, surface, and RMM parameters which can be changed by the components
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Read the states written by SaveState. The parameters are overwritten in place to keep the references from the other objects.
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   // Getter
   /**
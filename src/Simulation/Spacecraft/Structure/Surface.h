@@ -23,7 +23,7 @@ class Surface {
    * @fn ~Surface
    * @brief Destructor
    */
-  ~Surface(){};
+  ~Surface() = default;
 
   // Getter
   /**